@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <future>
+
 #include <XRCore.h>
 #include <rendering/XRRender.h>
 #include <input/XRInput.h>
@@ -43,6 +45,23 @@ namespace OpenXRProvider
 		/// Class Destructor
 		~XRProvider();
 
+		/// Start creating a provider so the app can load its assets meanwhile. The instance and xr system are created right away on a worker thread.
+		/// The rest (session, swapchains, input) needs the app's graphics context, so it runs when get() is called on the returned future - call it
+		/// on the thread with the graphics context current. Errors from any phase are rethrown from get(). If the future is destroyed without
+		/// get() being called, the destructor waits for the worker thread to finish and then destroys the core (and its instance)
+		/// @param[in] xrAppInfo			App metadata used to create an instance and session to the active OpenXR runtime
+		/// @param[in] xrAppGraphicsInfo	App graphics metadata based on current active api
+		/// @param[in] xrRenderInfo			Information needed to create swapchain textures that the app will render to
+		/// @param[in] pProgressCallback	(optional) Called at the start of each initialization phase, on the thread running that phase
+		/// @param[in] pUserContext			(optional) App data passed back to the progress callback
+		/// @return		Future of the ready provider (owned by the app)
+		static std::future< XRProvider * > CreateAsync(
+			XRAppInfo xrAppInfo,
+			XRAppGraphicsInfo xrAppGraphicsInfo,
+			XRRenderInfo xrRenderInfo,
+			Callback_XRInitProgress pProgressCallback = nullptr,
+			void *pUserContext = nullptr );
+
 		/// OpenXR Core System
 		XRCore* Core() const { return m_pXRCoreSystem; }
 
@@ -53,6 +72,19 @@ namespace OpenXRProvider
 		XRInput *Input() const { return m_pXRInputManager; }
 
 	  private:
+		/// Class Constructor for a core that already has an instance and xr system (used by CreateAsync)
+		/// @param[in] pXRCore				Core with an instance and xr system. The provider takes ownership
+		/// @param[in] xrAppGraphicsInfo	App graphics metadata based on current active api
+		/// @param[in] xrRenderInfo			Information needed to create swapchain textures that the app will render to
+		/// @param[in] pProgressCallback	Called at the start of each remaining initialization phase
+		/// @param[in] pUserContext			App data passed back to the progress callback
+		XRProvider(
+			XRCore *pXRCore,
+			XRAppGraphicsInfo xrAppGraphicsInfo,
+			XRRenderInfo xrRenderInfo,
+			Callback_XRInitProgress pProgressCallback,
+			void *pUserContext );
+
 		/// Pointer to the OpenXR Core System
 		XRCore* m_pXRCoreSystem = nullptr;
 
@@ -27,6 +27,8 @@
 
 namespace OpenXRProvider
 {
+	struct XRDispatchTable;
+
 	class XRBaseExt : public XRBase
 	{
      public:
@@ -44,6 +46,9 @@ namespace OpenXRProvider
 		/// Setter for activation status of this extension
 		void IsActive( bool val ) { m_bIsActive = val; }
 
+		/// Function pointers of the instance this extension is enabled on (set when the extension is activated, filled once the instance is created)
+		const XRDispatchTable *m_pXRDispatchTable = nullptr;
+
 	  private:
 		bool m_bIsActive = false;
 	};
@@ -0,0 +1,143 @@
+/* Copyright 2021 Rune Berg (GitHub: https://github.com/1runeberg, Twitter: https://twitter.com/1runeberg)
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *  BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ *  GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+ *  DAMAGE.
+ *
+ */
+
+
+#pragma once
+
+#include <XRCommon.h>
+
+namespace OpenXRProvider
+{
+	/// Everything the provider negotiates with a runtime at startup that stays the same from launch to launch
+	struct XRRuntimeCapabilities
+	{
+		/// Name of the runtime (from xrGetInstanceProperties)
+		std::string RuntimeName;
+
+		/// Version of the runtime
+		uint64_t RuntimeVersion = 0;
+
+		/// Vendor id of the xr system
+		uint32_t VendorId = 0;
+
+		/// Hash of the names and versions of every instance extension the runtime supports
+		uint64_t ExtensionsHash = 0;
+
+		/// Primary stereo view configuration views (one for each eye)
+		std::vector< XrViewConfigurationView > ViewConfigViews;
+
+		/// Swapchain formats supported by the runtime in order of preference
+		std::vector< int64_t > SwapchainFormats;
+
+		/// Hash of the app's requested color and depth formats the chosen formats were picked for
+		uint64_t RequestedFormatsHash = 0;
+
+		/// Chosen swapchain color format
+		int64_t ColorFormat = 0;
+
+		/// Chosen swapchain depth format (0 if depth isn't handled)
+		int64_t DepthFormat = 0;
+	};
+
+	/// On-disk cache of a runtime's capabilities so later launches can skip most of the startup negotiation (and its logging).
+	/// The cache is only used if the runtime's name, version, vendor id and extension list are unchanged
+	class XRCapabilityCache
+	{
+	  public:
+		// ** FUNCTIONS (PUBLIC) **/
+
+		/// Class Constructor. Loads the cache file if there is one
+		/// @param[in]	sCacheFile	Absolute path and filename of the cache file
+		XRCapabilityCache( const char *sCacheFile );
+
+		/// Class Destructor
+		~XRCapabilityCache();
+
+		/// Check the runtime's extension list against the cache. Call with the result of the first (and only) extension enumeration
+		/// @param[in]	vExtensions		Extensions supported by the runtime
+		/// @return		If the runtime's extensions are unchanged since the cache was written
+		bool ValidateExtensions( const std::vector< XrExtensionProperties > &vExtensions );
+
+		/// Check the runtime against the cache. If it doesn't match, the cached capabilities are discarded and will be rewritten on Save
+		/// @param[in]	sRuntimeName		Name of the runtime
+		/// @param[in]	nRuntimeVersion		Version of the runtime
+		/// @param[in]	nVendorId			Vendor id of the xr system
+		/// @return		If the cached capabilities can be used
+		bool ValidateRuntime( const char *sRuntimeName, uint64_t nRuntimeVersion, uint32_t nVendorId );
+
+		/// Getter for whether the cached capabilities can be used (valid after ValidateRuntime)
+		/// @return		If the cache matches the active runtime
+		bool GetIsValid() const { return m_bIsValid; }
+
+		/// Getter for the capabilities (the cached ones if valid, otherwise the ones being negotiated that will be saved)
+		/// @return		The runtime capabilities
+		XRRuntimeCapabilities &GetCapabilities() { return m_xrCapabilities; }
+
+		/// Write the capabilities to the cache file
+		/// @return		If the cache file was written
+		bool Save();
+
+		/// Hash a block of memory (FNV-1a)
+		/// @param[in]	pData		Memory to hash
+		/// @param[in]	nSize		Size of the memory in bytes
+		/// @param[in]	nHash		(optional) Hash to continue from
+		/// @return		The hash
+		static uint64_t Hash( const void *pData, size_t nSize, uint64_t nHash = k_nHashSeed );
+
+	  private:
+		// ** FUNCTIONS (PRIVATE) **/
+
+		/// Read the cache file
+		/// @return		If a complete cache was read
+		bool Load();
+
+		// ** MEMBER VARIABLES (PRIVATE) **/
+
+		/// Initial value of hashes (FNV-1a offset basis)
+		static const uint64_t k_nHashSeed = 14695981039346656037ULL;
+
+		/// Version of the cache file format
+		static const uint32_t k_nFileVersion = 1;
+
+		/// Most view configuration views a cache file can have (the provider only uses the primary stereo configuration)
+		static const uint32_t k_nMaxViewConfigViews = 2;
+
+		/// Most swapchain formats a cache file can have, well above what runtimes list
+		static const uint32_t k_nMaxSwapchainFormats = 128;
+
+		/// If a complete cache file was loaded
+		bool m_bIsLoaded = false;
+
+		/// If the runtime's extensions matched the cache
+		bool m_bExtensionsMatch = false;
+
+		/// If the cached capabilities can be used
+		bool m_bIsValid = false;
+
+		/// Absolute path and filename of the cache file
+		std::string m_sCacheFile;
+
+		/// The runtime capabilities
+		XRRuntimeCapabilities m_xrCapabilities;
+	};
+} // namespace OpenXRProvider
@@ -0,0 +1,218 @@
+/* Copyright 2021 Rune Berg (GitHub: https://github.com/1runeberg, Twitter: https://twitter.com/1runeberg)
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *  BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ *  GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+ *  DAMAGE.
+ *
+ */
+
+
+#pragma once
+
+#include <chrono>
+
+#include <XRCommon.h>
+
+namespace OpenXRProvider
+{
+#if defined( XR_USE_PLATFORM_WIN32 )
+	static const char *s_TimeConversionExtensionName = XR_KHR_WIN32_CONVERT_PERFORMANCE_COUNTER_TIME_EXTENSION_NAME;
+#elif defined( XR_USE_TIMESPEC )
+	static const char *s_TimeConversionExtensionName = XR_KHR_CONVERT_TIMESPEC_TIME_EXTENSION_NAME;
+#else
+	static const char *s_TimeConversionExtensionName = "";
+#endif
+
+	/// Fixed bucket histogram of latencies. Nothing is allocated after construction. Record and query from the same thread
+	class XRLatencyHistogram
+	{
+	  public:
+		/// Width of each bucket in nanoseconds (0.1 ms)
+		static const XrDuration k_nBucketWidth = 100000;
+
+		/// Number of buckets. Latencies beyond the last bucket are counted in it
+		static const uint32_t k_nBucketCount = 512;
+
+		// ** FUNCTIONS (PUBLIC) **/
+
+		/// Add a latency sample
+		/// @param[in]	nLatency	Latency in nanoseconds (negative values are counted as 0)
+		void Record( XrDuration nLatency );
+
+		/// Drop all samples
+		void Reset();
+
+		/// Getter for the number of samples recorded since the last reset
+		/// @return		Number of samples
+		uint64_t GetCount() const { return m_nCount; }
+
+		/// Getter for the smallest sample
+		/// @return		Smallest latency in nanoseconds (0 if there are no samples)
+		XrDuration GetMin() const { return m_nCount > 0 ? m_nMin : 0; }
+
+		/// Getter for the largest sample
+		/// @return		Largest latency in nanoseconds
+		XrDuration GetMax() const { return m_nMax; }
+
+		/// Getter for the mean of all samples
+		/// @return		Mean latency in nanoseconds (0 if there are no samples)
+		XrDuration GetMean() const { return m_nCount > 0 ? ( XrDuration )( m_nSum / m_nCount ) : 0; }
+
+		/// Compute the p50/p95/p99 of the samples (to the bucket width)
+		/// @return		The percentiles in nanoseconds (all 0 if there are no samples)
+		XRFrameTimingPercentiles GetPercentiles() const;
+
+	  private:
+		// ** FUNCTIONS (PRIVATE) **/
+
+		/// Find the latency below which the given fraction of the samples fall
+		/// @param[in]	nPerMille	Fraction of samples in 1/1000ths
+		/// @return		Upper bound of the bucket holding the percentile in nanoseconds
+		XrDuration GetPercentile( uint32_t nPerMille ) const;
+
+		// ** MEMBER VARIABLES (PRIVATE) **/
+
+		/// Number of samples in each bucket
+		uint32_t m_nBuckets[ k_nBucketCount ] = {};
+
+		/// Number of samples
+		uint64_t m_nCount = 0;
+
+		/// Sum of all samples for the mean
+		uint64_t m_nSum = 0;
+
+		/// Smallest sample
+		XrDuration m_nMin = 0;
+
+		/// Largest sample
+		XrDuration m_nMax = 0;
+	};
+
+	/// Converts between XrTime and the host's steady clock and records end-to-end latency probes.
+	/// Uses the runtime's time conversion extension (Win32 performance counter or timespec) if it was enabled on the instance,
+	/// otherwise estimates the offset between the clocks from the frame timing reported by xrWaitFrame
+	class XRClock
+	{
+	  public:
+		// ** FUNCTIONS (PUBLIC) **/
+
+		/// Class Constructor
+		/// @param[in]	xrInstance				The active OpenXR instance
+		/// @param[in]	pXRDispatchTable		Function pointers of the active OpenXR instance (the clock is exact if it has the time conversion function)
+		/// @param[in]	pLogger					Pointer to the logger
+		XRClock( XrInstance xrInstance, const XRDispatchTable *pXRDispatchTable, std::shared_ptr< spdlog::logger > pLogger );
+
+		/// Class Destructor
+		~XRClock();
+
+		/// Current time of the host's steady clock
+		/// @return		Steady clock time in nanoseconds
+		static XrDuration GetSteadyTimeNs()
+		{
+			return std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now().time_since_epoch() ).count();
+		}
+
+		/// Getter for whether conversions are exact (done by the runtime) rather than estimated from the frame timing
+		/// @return		If the runtime's time conversion extension is used
+		bool GetIsExact() const { return m_bIsExact; }
+
+		/// Getter for whether conversions can be made (always true if exact, otherwise once a frame has been waited on)
+		/// @return		If the clock is calibrated
+		bool GetIsCalibrated() const { return m_bIsCalibrated; }
+
+		/// Current time in the runtime's clock
+		/// @return		Current XrTime (0 if not calibrated)
+		XrTime Now() const { return ToXrTime( GetSteadyTimeNs() ); }
+
+		/// Convert a steady clock time to the runtime's clock
+		/// @param[in]	nSteadyTimeNs	Steady clock time in nanoseconds
+		/// @return		XrTime (0 if not calibrated)
+		XrTime ToXrTime( XrDuration nSteadyTimeNs ) const { return m_bIsCalibrated ? nSteadyTimeNs + m_nOffset : 0; }
+
+		/// Convert an XrTime to the steady clock
+		/// @param[in]	xrTime		Time in the runtime's clock
+		/// @return		Steady clock time in nanoseconds (0 if not calibrated)
+		XrDuration ToSteadyTimeNs( XrTime xrTime ) const { return m_bIsCalibrated ? xrTime - m_nOffset : 0; }
+
+		/// Recalibrate the clock. Exact clocks requery the runtime at most once every k_nExactQueryInterval (the clocks can drift slowly over a long session),
+		/// estimated clocks use the frame timing of an xrWaitFrame call
+		/// @param[in]	xrPredictedDisplayTime		(optional) Predicted display time returned by xrWaitFrame
+		/// @param[in]	nPredictedDisplayPeriod		(optional) Predicted display period returned by xrWaitFrame
+		/// @param[in]	nWaitEndTimeNs				(optional) Steady clock time xrWaitFrame returned at
+		void Calibrate( XrTime xrPredictedDisplayTime = 0, XrDuration nPredictedDisplayPeriod = 0, XrDuration nWaitEndTimeNs = 0 );
+
+		/// Add a latency sample to one of the probes
+		/// @param[in]	eProbe		Which probe to record
+		/// @param[in]	nLatency	Latency in nanoseconds
+		void RecordLatency( EXRLatencyProbe eProbe, XrDuration nLatency ) { m_xrLatencyHistograms[ eProbe ].Record( nLatency ); }
+
+		/// Getter for the histogram of a latency probe
+		/// @param[in]	eProbe		Which probe
+		/// @return		The probe's histogram
+		XRLatencyHistogram &GetLatencyHistogram( EXRLatencyProbe eProbe ) { return m_xrLatencyHistograms[ eProbe ]; }
+
+		/// Log the mean and percentiles of every latency probe
+		void LogLatencies();
+
+	  private:
+		// ** FUNCTIONS (PRIVATE) **/
+
+		/// Ask the runtime for the XrTime of the current steady clock time
+		/// @param[out]	nOffset		XrTime minus steady clock time in nanoseconds
+		/// @return		If the runtime converted the time
+		bool QueryOffset( XrDuration &nOffset );
+
+		// ** MEMBER VARIABLES (PRIVATE) **/
+
+		/// Number of frames the estimated offset is taken over
+		static const uint32_t k_nEstimateFrames = 90;
+
+		/// Time between requeries of the runtime by exact clocks in nanoseconds (the clocks only drift slowly)
+		static const XrDuration k_nExactQueryInterval = 1000000000;
+
+		/// The active OpenXR instance
+		XrInstance m_xrInstance = XR_NULL_HANDLE;
+
+		/// Function pointers of the active OpenXR instance
+		const XRDispatchTable *m_pXRDispatchTable = nullptr;
+
+		/// Pointer to the logger
+		std::shared_ptr< spdlog::logger > m_pXRLogger;
+
+		/// If the runtime converts the times
+		bool m_bIsExact = false;
+
+		/// If an offset is available
+		bool m_bIsCalibrated = false;
+
+		/// XrTime minus steady clock time in nanoseconds
+		XrDuration m_nOffset = 0;
+
+		/// Steady clock time of the last runtime query in nanoseconds (exact clocks only)
+		XrDuration m_nLastQueryTime = 0;
+
+		/// Smallest display lead seen in the current estimate window (estimated clocks only)
+		XrDuration m_nEstimateMinOffset = 0;
+
+		/// Number of frames in the current estimate window
+		uint32_t m_nEstimateFrameCount = 0;
+
+		/// Latency histograms, one for each probe
+		XRLatencyHistogram m_xrLatencyHistograms[ LATENCY_PROBE_COUNT ];
+	};
+} // namespace OpenXRProvider
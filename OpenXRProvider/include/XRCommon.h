@@ -24,6 +24,8 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
+#include <cfloat>
 #include <cmath>
 #include <iostream>
 #include <string>
@@ -49,6 +51,9 @@
 #include <openxr/openxr_reflection.h>
 #include <openxr/xr_linear.h>
 
+// Provider dispatch table
+#include <XRDispatchTable.h>
+
 
 namespace OpenXRProvider
 {
@@ -66,53 +71,125 @@ namespace OpenXRProvider
 	XR_ENUM_TYPE_STRINGIFY( XrSessionState );
 	XR_ENUM_TYPE_STRINGIFY( XrReferenceSpaceType );
 
-	/// Execute a call to the OpenXR api and evaluate the result, will log success and fail and throw an exception if request
-	#define XR_CALL( xrCall, xrLogger, bThrow ) CheckXrResult( xrCall, xrLogger, bThrow, #xrCall, __FILE__, __LINE__ );
-	inline XrResult CheckXrResult(
-		XrResult xrResult,
-		std::shared_ptr< spdlog::logger > xrLogger,
-		bool bThrow,
-		const char *xrCall = nullptr,
-		const char *srcFile = nullptr,
-		int srcLineNum = 0 )
+	/// Log every successful OpenXR call made through XR_CALL (compiled out unless the build defines XR_CALL_LOG_SUCCESS=1)
+	#ifndef XR_CALL_LOG_SUCCESS
+	#define XR_CALL_LOG_SUCCESS 0
+	#endif
+
+	/// Result counters of a single XR_CALL / XR_CALL_SILENT call site. Constant initialized, so call sites pay no static init guard
+	struct XRCallSite
 	{
-		if ( XR_UNQUALIFIED_SUCCESS( xrCall ) )
+		/// The OpenXR call as written in source
+		const char *Call;
+
+		/// Source file of the call site
+		const char *File;
+
+		/// Source line of the call site
+		int Line;
+
+		/// Number of calls that returned XR_SUCCESS
+		std::atomic< uint32_t > SuccessCount { 0 };
+
+		/// Number of calls that returned a qualified success (e.g. XR_SESSION_LOSS_PENDING, XR_EVENT_UNAVAILABLE)
+		std::atomic< uint32_t > QualifiedSuccessCount { 0 };
+
+		/// Number of calls that failed
+		std::atomic< uint32_t > ErrorCount { 0 };
+
+		/// If this call site has been added to the list of call sites
+		std::atomic< bool > IsRegistered { false };
+
+		/// Next call site in the list of call sites
+		XRCallSite *Next = nullptr;
+
+		constexpr XRCallSite( const char *sCall, const char *sFile, int nLine )
+			: Call( sCall )
+			, File( sFile )
+			, Line( nLine )
+		{
+		}
+
+		/// Count a result from this call site (registers the call site on its first result)
+		/// @param[in]	xrResult	The result of the OpenXR call
+		inline void Record( XrResult xrResult );
+
+		/// Retrieve the first call site that has recorded a result, follow Next for the rest. Only call sites in the calling module are listed
+		/// @return		First call site in the list (nullptr if no calls have been made)
+		static inline XRCallSite *GetFirst();
+	};
+
+	/// Head of the list of call sites that have recorded a result
+	inline std::atomic< XRCallSite * > s_pXRCallSites { nullptr };
+
+	inline void XRCallSite::Record( XrResult xrResult )
+	{
+		if ( XR_UNQUALIFIED_SUCCESS( xrResult ) )
+			SuccessCount.fetch_add( 1, std::memory_order_relaxed );
+		else if ( XR_SUCCEEDED( xrResult ) )
+			QualifiedSuccessCount.fetch_add( 1, std::memory_order_relaxed );
+		else
+			ErrorCount.fetch_add( 1, std::memory_order_relaxed );
+
+		if ( IsRegistered.load( std::memory_order_relaxed ) || IsRegistered.exchange( true ) )
+			return;
+
+		Next = s_pXRCallSites.load();
+		while ( !s_pXRCallSites.compare_exchange_weak( Next, this ) )
+		{
+		}
+	}
+
+	inline XRCallSite *XRCallSite::GetFirst() { return s_pXRCallSites.load(); }
+
+	/// Execute a call to the OpenXR api and evaluate the result, will log failures (and successes if XR_CALL_LOG_SUCCESS is on) and throw an exception if requested
+	#define XR_CALL( xrCall, xrLogger, bThrow )                                                                                                                   \
+		[ & ]() -> XrResult {                                                                                                                                     \
+			static XRCallSite s_xrCallSite( #xrCall, __FILE__, __LINE__ );                                                                                        \
+			return CheckXrResult( xrCall, *( xrLogger ), bThrow, s_xrCallSite );                                                                                  \
+		}()
+	inline XrResult CheckXrResult( XrResult xrResult, spdlog::logger &xrLogger, bool bThrow, XRCallSite &xrCallSite )
+	{
+		xrCallSite.Record( xrResult );
+
+		if ( XR_FAILED( xrResult ) )
 		{
 			const char *xrEnumStr = XrEnumToString( xrResult );
 			std::string eMessage = "Error on OpenXR call ";
-			if ( xrCall )
-				eMessage.append( xrCall );
+			eMessage.append( xrCallSite.Call );
 
-			xrLogger->error( "{}. Error ({}) {} in file {} line {}", eMessage, std::to_string( xrResult ), xrEnumStr, srcFile, srcLineNum );
+			xrLogger.error( "{}. Error ({}) {} in file {} line {}", eMessage, std::to_string( xrResult ), xrEnumStr, xrCallSite.File, xrCallSite.Line );
 
 			if ( bThrow )
 				throw std::runtime_error( eMessage );
 		}
+#if XR_CALL_LOG_SUCCESS
 		else
 		{
-			xrLogger->info( "Success: {}", xrCall );
+			xrLogger.trace( "Success ({}): {}", XrEnumToString( xrResult ), xrCallSite.Call );
 		}
+#endif
 
 		return xrResult;
 	}
 
 	/// Execute a call to the OpenXR api and evaluate the result, will log failures only
-	#define XR_CALL_SILENT( xrCall, xrLogger ) CheckXrResult( xrCall, xrLogger, #xrCall, __FILE__, __LINE__ );
-	inline XrResult CheckXrResult(
-		XrResult xrResult,
-		std::shared_ptr< spdlog::logger > xrLogger,
-		const char *xrCall = nullptr,
-		const char *srcFile = nullptr,
-		int srcLineNum = 0 )
+	#define XR_CALL_SILENT( xrCall, xrLogger )                                                                                                                    \
+		[ & ]() -> XrResult {                                                                                                                                     \
+			static XRCallSite s_xrCallSite( #xrCall, __FILE__, __LINE__ );                                                                                        \
+			return CheckXrResult( xrCall, *( xrLogger ), s_xrCallSite );                                                                                          \
+		}()
+	inline XrResult CheckXrResult( XrResult xrResult, spdlog::logger &xrLogger, XRCallSite &xrCallSite )
 	{
-		if ( XR_UNQUALIFIED_SUCCESS( xrCall ) )
+		xrCallSite.Record( xrResult );
+
+		if ( XR_FAILED( xrResult ) )
 		{
 			const char *xrEnumStr = XrEnumToString( xrResult );
 			std::string eMessage = "Error on OpenXR call ";
-			if ( xrCall )
-				eMessage.append( xrCall );
+			eMessage.append( xrCallSite.Call );
 
-			xrLogger->error( "{}. Error ({}) {} in file {} line {}", eMessage, std::to_string( xrResult ), xrEnumStr, srcFile, srcLineNum );
+			xrLogger.error( "{}. Error ({}) {} in file {} line {}", eMessage, std::to_string( xrResult ), xrEnumStr, xrCallSite.File, xrCallSite.Line );
 		}
 
 		return xrResult;
@@ -142,6 +219,56 @@ namespace OpenXRProvider
 		EXT_INSTANCE_HAND_TRACKING = 1
 	};
 
+	/// Timed parts of a frame recorded by the frame telemetry
+	enum EXRFrameTiming
+	{
+		FRAME_TIMING_WAIT = 0,				// xrWaitFrame (time blocked by the runtime's frame throttling)
+		FRAME_TIMING_BEGIN = 1,				// xrBeginFrame
+		FRAME_TIMING_LOCATE_VIEWS = 2,		// xrLocateViews
+		FRAME_TIMING_ACQUIRE = 3,			// Acquire and wait for the eye swapchain images
+		FRAME_TIMING_RELEASE = 4,			// Release the eye and layer swapchain images
+		FRAME_TIMING_END = 5,				// xrEndFrame
+		FRAME_TIMING_DISPLAY_DELTA = 6,		// Predicted display time difference to the previous frame
+		FRAME_TIMING_COUNT = 7
+	};
+
+	/// End-to-end latencies measured by the clock's latency probes
+	enum EXRLatencyProbe
+	{
+		LATENCY_INPUT_AGE = 0,				// Age of an input change (lastChangeTime) when the app reads it after xrSyncActions
+		LATENCY_POSE_TO_SUBMIT = 1,			// CPU time from locating the frame's eye poses to xrEndFrame
+		LATENCY_DISPLAY_LEAD = 2,			// How far ahead of now the predicted display time is when xrWaitFrame returns
+		LATENCY_PROBE_COUNT = 3
+	};
+
+	/// Composition layer types that can be submitted on top of (or under) the projection layer
+	enum EXRLayerType
+	{
+		LAYER_QUAD = 0,
+		LAYER_CYLINDER = 1,		// Requires XR_KHR_composition_layer_cylinder
+		LAYER_EQUIRECT = 2		// Requires XR_KHR_composition_layer_equirect
+	};
+
+	/// Session lifecycle events sent to session callbacks when a lost session is recreated
+	enum EXRSessionEvent
+	{
+		SESSION_EVENT_DESTROYING = 0,	// Session is about to be destroyed, release everything created from it
+		SESSION_EVENT_CREATED = 1,		// New session was created, rebuild what was released (the session begins once the runtime reports it ready)
+		SESSION_EVENT_STOPPING = 2,		// Session is about to be ended, stop calling the runtime's frame functions
+		SESSION_EVENT_READY = 3			// Session was begun, frame functions can be called again
+	};
+
+	/// Phases of provider initialization reported while creating a provider asynchronously
+	enum EXRInitPhase
+	{
+		INIT_PHASE_INSTANCE = 0,		// Instance creation, extensions and xr system (worker thread)
+		INIT_PHASE_SESSION = 1,			// Session and reference space (graphics thread)
+		INIT_PHASE_RENDER = 2,			// View configurations, swapchains and swapchain images (graphics thread)
+		INIT_PHASE_INPUT = 3,			// Input profiles (graphics thread)
+		INIT_PHASE_READY = 4,			// Provider is ready to use
+		INIT_PHASE_FAILED = 5			// Initialization failed, the error is rethrown from the provider future
+	};
+
 
 	//** STRUCTS */
 
@@ -169,6 +296,10 @@ namespace OpenXRProvider
 		/// The absolute path and filename of the log file the OpenXR Provider library will write in to (optional)
 		const char *LogFile;
 
+		/// The absolute path and filename of the runtime capability cache (optional). If set, later launches on the same runtime skip most of the
+		/// startup negotiation and its logging
+		const char *CapabilityCacheFile = nullptr;
+
 		/// Struct Constructor
 		/// @param[in]	appName						Name of the application using the OpenXR Provider library
 		/// @param[in]	appVersion					Version of the application using the OpenXR Provider library
@@ -196,6 +327,34 @@ namespace OpenXRProvider
 		}
 	};
 
+	/// Bounds and tuning for dynamic resolution scaling. Scales are relative to the runtime's recommended image rect size
+	struct XRDynamicResolutionInfo
+	{
+		/// If the render rect should be scaled based on reported frame times. Swapchains are allocated at MaxScale when enabled at creation
+		bool Enabled = false;
+
+		/// Smallest scale the render rect can drop to
+		float MinScale = 0.5f;
+
+		/// Largest scale the render rect can grow to (clamped to the runtime's max image rect size)
+		float MaxScale = 1.0f;
+
+		/// How much the scale changes per adjustment
+		float ScaleStep = 0.05f;
+
+		/// Fraction of the predicted display period the slowest of the cpu/gpu frame times must stay under. Going above drops the scale
+		float TargetFrameTimeRatio = 0.9f;
+
+		/// Fraction of the predicted display period the slowest of the cpu/gpu frame times must stay under before the scale goes up again
+		float IncreaseFrameTimeRatio = 0.75f;
+
+		/// Consecutive frames over budget before the scale drops (keep low to drop pixels before frames)
+		uint32_t DecreaseFrameCount = 2;
+
+		/// Consecutive frames with headroom before the scale goes up (keep high to avoid oscillating)
+		uint32_t IncreaseFrameCount = 45;
+	};
+
 	/// Information needed to create swapchain textures that the app will render to
 	struct XRRenderInfo
 	{
@@ -216,6 +375,21 @@ namespace OpenXRProvider
 		/// If the application plans to send depth textures along with the color textures
 		bool EnableDepthTextureSupport;
 
+		/// If both eyes should render to a single swapchain with an array size of two (one slice per eye) instead of one swapchain per eye.
+		/// Overrides TextureArraySize. Needed for single-pass stereo rendering (e.g. multiview or layered rendering)
+		bool UseStereoTextureArray;
+
+		/// Dynamic resolution scaling (disabled by default). Set Enabled before creating the render manager so swapchains are allocated large enough
+		XRDynamicResolutionInfo DynamicResolution;
+
+		/// If one complete framebuffer (color + depth) should be built per swapchain image when the swapchain images are generated.
+		/// Retrieve the one matching this frame's acquired images with XRRender::GetRenderTarget. The app's graphics context must be current
+		bool CacheRenderTargets = false;
+
+		/// If the render target cache should share a single transient depth buffer per eye instead of one per swapchain image.
+		/// Only used when there is no depth swapchain
+		bool ShareTransientDepth = true;
+
 		/// Struct Constructor
 		/// @param[in]		vRequestTextureFormats		Requested texture color formats  in order of preference (e.g. GL_RGBA16,
 		/// DXGI_FORMAT_R8G8B8A8_UNORM_SRGB, etc)
@@ -225,17 +399,109 @@ namespace OpenXRProvider
 		/// @param[in]		nTextureMipCount			The texture Mip count for each image in the swapchain
 		/// @param[in]		bEnableDepthTextureSupport	(optional: false) If depth composition (XR_KHR_composition_layer_depth) should be enabled if runtime
 		/// supports it
+		/// @param[in]		bUseStereoTextureArray		(optional: false) If both eyes should share a single texture array swapchain
 		XRRenderInfo(
 			std::vector< int64_t > vRequestTextureFormats,
 			std::vector< int64_t > vRequestDepthFormats,
 			uint32_t nTextureArraySize,
 			uint32_t nTextureMipCount,
-			bool bEnableDepthTextureSupport = false )
+			bool bEnableDepthTextureSupport = false,
+			bool bUseStereoTextureArray = false )
 			: RequestTextureFormats( vRequestTextureFormats )
 			, RequestDepthFormats( vRequestDepthFormats )
 			, TextureArraySize( nTextureArraySize )
 			, TextureMipCount( nTextureMipCount )
 			, EnableDepthTextureSupport( bEnableDepthTextureSupport )
+			, UseStereoTextureArray( bUseStereoTextureArray )
+		{
+		}
+	};
+
+	/// Depth range of the app's projection, submitted with every projection view (XR_KHR_composition_layer_depth) so the runtime can reproject positionally
+	struct XRDepthSubmitInfo
+	{
+		/// Distance in meters to the near plane of the app's projection
+		float NearZ = 0.1f;
+
+		/// Distance in meters to the far plane of the app's projection (FLT_MAX for an infinite far plane)
+		float FarZ = FLT_MAX;
+
+		/// If the app renders with reversed-Z (depth of 1 at the near plane and 0 at the far plane)
+		bool ReversedZ = false;
+
+		/// If the depth swapchain images should be submitted with the projection layer
+		bool Submit = true;
+	};
+
+	/// Information needed to create a composition layer (quad, cylinder or equirect) with its own swapchain
+	struct XRLayerInfo
+	{
+		/// The type of composition layer
+		EXRLayerType LayerType;
+
+		/// Width of the layer's swapchain textures in pixels
+		uint32_t Width;
+
+		/// Height of the layer's swapchain textures in pixels
+		uint32_t Height;
+
+		/// Number of frames between content updates (1 = every frame). The compositor resamples the last image in between
+		uint32_t UpdateInterval;
+
+		/// If the layer is rendered to only once (XR_SWAPCHAIN_CREATE_STATIC_IMAGE_BIT), useful for skyboxes and static panels
+		bool IsStatic;
+
+		/// Graphics api dependent color format (e.g. GL_RGBA16). A 0 uses the same format as the projection layer
+		int64_t Format = 0;
+
+		/// Submission order relative to the projection layer. Negative layers are submitted before it (e.g. skyboxes), the rest after it (e.g. HUDs)
+		int32_t Order = 1;
+
+		/// Space the layer pose is in. XR_NULL_HANDLE uses the app's tracking space
+		XrSpace Space = XR_NULL_HANDLE;
+
+		/// Pose of the center of the layer in Space
+		XrPosef Pose = { { 0.f, 0.f, 0.f, 1.f }, { 0.f, 0.f, -1.f } };
+
+		/// Which eye(s) the layer is visible to
+		XrEyeVisibility EyeVisibility = XR_EYE_VISIBILITY_BOTH;
+
+		/// Composition layer flags
+		XrCompositionLayerFlags LayerFlags = XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT;
+
+		/// QUAD: Size of the quad in meters
+		XrExtent2Df QuadSize = { 1.f, 1.f };
+
+		/// CYLINDER: Radius of the cylinder in meters
+		float CylinderRadius = 1.f;
+
+		/// CYLINDER: Angle in radians of the visible section of the cylinder
+		float CylinderCentralAngle = 1.570f;
+
+		/// CYLINDER: Width / height ratio of the visible section of the cylinder
+		float CylinderAspectRatio = 1.f;
+
+		/// EQUIRECT: Radius of the sphere in meters (0 for an infinite sphere)
+		float EquirectRadius = 0.f;
+
+		/// EQUIRECT: Texture coordinate scale
+		XrVector2f EquirectScale = { 1.f, 1.f };
+
+		/// EQUIRECT: Texture coordinate bias
+		XrVector2f EquirectBias = { 0.f, 0.f };
+
+		/// Struct Constructor
+		/// @param[in]		eLayerType			The type of composition layer
+		/// @param[in]		nWidth				Width of the layer's swapchain textures in pixels
+		/// @param[in]		nHeight				Height of the layer's swapchain textures in pixels
+		/// @param[in]		nUpdateInterval		(optional: 1) Number of frames between content updates
+		/// @param[in]		bIsStatic			(optional: false) If the layer will only be rendered to once
+		XRLayerInfo( EXRLayerType eLayerType, uint32_t nWidth, uint32_t nHeight, uint32_t nUpdateInterval = 1, bool bIsStatic = false )
+			: LayerType( eLayerType )
+			, Width( nWidth )
+			, Height( nHeight )
+			, UpdateInterval( nUpdateInterval )
+			, IsStatic( bIsStatic )
 		{
 		}
 	};
@@ -256,13 +522,150 @@ namespace OpenXRProvider
 		bool IsOrientationTracked;
 	};
 
+	/// Late latched poses written by the render manager into an app provided buffer the app binds on the GPU (e.g. a persistently mapped
+	/// uniform buffer). Laid out to match std140: column major mat4 arrays followed by a uvec4
+	struct XRLateLatchData
+	{
+		/// Maximum number of extra spaces (e.g. controller action spaces) that can be late latched
+		static const uint32_t k_nMaxSpaces = 4;
+
+		/// View matrix (inverse of the eye pose in the app's tracking space) for each eye
+		XrMatrix4x4f ViewMatrix[ 2 ];
+
+		/// Model matrix of each late latched space in the app's tracking space
+		XrMatrix4x4f SpaceMatrix[ k_nMaxSpaces ];
+
+		/// 1 if the matching space in SpaceMatrix had a valid pose, 0 otherwise
+		uint32_t SpaceValid[ k_nMaxSpaces ];
+	};
+
+	/// State of an input action (for one subaction path) at the last xrSyncActions. The value member depends on the action's type
+	struct XRActionState
+	{
+		union
+		{
+			XrBool32 Boolean;
+			float Float;
+			XrVector2f Vector2f { 0.f, 0.f };
+		};
+
+		/// Time of the last change of the state
+		XrTime LastChangeTime = 0;
+
+		/// If the action is bound and its action set is active (pose actions only report this)
+		XrBool32 IsActive = XR_FALSE;
+
+		/// If the state changed since the previous sync
+		XrBool32 ChangedSinceLastSync = XR_FALSE;
+	};
+
+	/// States of all registered input actions, filled once per xrSyncActions and indexed by action handle (XRInput::GetActionHandle)
+	struct XRActionStateSnapshot
+	{
+		/// Number of successful syncs so far (the snapshot belongs to this sync)
+		uint64_t SyncIndex = 0;
+
+		/// Time of the sync in the runtime's clock (0 if the clock isn't calibrated yet)
+		XrTime SyncTime = 0;
+
+		/// Action states, indexed by action handle
+		std::vector< XRActionState > States;
+	};
+
+	/// Type of an input event, generated by diffing action states between syncs
+	enum EXRInputEventType
+	{
+		INPUT_EVENT_PRESSED = 0,				// Boolean action changed to true
+		INPUT_EVENT_RELEASED = 1,				// Boolean action changed to false
+		INPUT_EVENT_ANALOG = 2,					// Float or vector2f action moved past the event threshold since its last event
+		INPUT_EVENT_POSE_TRACKING_GAINED = 3,	// Pose action became active (a device providing it is bound and tracked)
+		INPUT_EVENT_POSE_TRACKING_LOST = 4		// Pose action is no longer active
+	};
+
+	/// An input event. Compact so a queue of them stays in a few cache lines
+	struct XRInputEvent
+	{
+		/// Handle of the action (and subaction path) the event is for (XRInput::GetActionHandle)
+		uint32_t ActionHandle = 0;
+
+		/// Type of the event
+		EXRInputEventType Type = INPUT_EVENT_PRESSED;
+
+		/// When the change happened in the runtime's clock (lastChangeTime, or the sync time for pose events)
+		XrTime Time = 0;
+
+		/// New value of the action: x for booleans (0 or 1) and floats, x and y for vector2f actions
+		XrVector2f Value { 0.f, 0.f };
+	};
+
+	/// Frame stats - timings of a single frame in nanoseconds, indexed by EXRFrameTiming
+	struct XRFrameStats
+	{
+		uint64_t FrameIndex = 0;
+		XrTime PredictedDisplayTime = 0;
+		XrDuration PredictedDisplayPeriod = 0;
+		XrDuration Durations[ FRAME_TIMING_COUNT ] = {};
+
+		/// If the runtime wanted the app to render this frame
+		bool ShouldRender = false;
+
+		/// If display periods were skipped since the previous frame (the display time jumped by more than one period)
+		bool MissedFrame = false;
+
+		/// Number of display periods skipped since the previous frame
+		uint32_t MissedFrameCount = 0;
+	};
+
+	/// Rolling percentiles of a frame timing in nanoseconds
+	struct XRFrameTimingPercentiles
+	{
+		XrDuration P50 = 0;
+		XrDuration P95 = 0;
+		XrDuration P99 = 0;
+	};
+
+	// Frame token - timing info for a single frame, handed from the frame pacing thread to the render thread when pipelined
+	struct XRFrameToken
+	{
+		uint64_t FrameIndex = 0;
+		XrTime PredictedDisplayTime = 0;
+		XrDuration PredictedDisplayPeriod = 0;
+		bool ShouldRender = false;
+
+		/// How long the pacing thread was blocked in xrWaitFrame for this frame (nanoseconds)
+		XrDuration WaitDuration = 0;
+
+		/// Steady clock time xrWaitFrame returned at (nanoseconds)
+		XrDuration WaitEndTime = 0;
+	};
+
 	//** CUSTOM TYPES */
 
-	/// Event callback function used for registering functions to the Event Handler
-	typedef void ( *Callback_XREvent )( XrEventDataBuffer );
+	/// Event callback function used for registering functions to the Event Handler. The event is only valid for the duration of the call
+	typedef void ( *Callback_XREvent )( const XrEventDataBuffer &xrEvent, void *pUserContext );
+
+	/// Session lifecycle callback function used for registering functions that release and rebuild session resources (e.g. swapchains, action spaces)
+	typedef void ( *Callback_XRSession )( EXRSessionEvent eXRSessionEvent, void *pUserContext );
+	struct XRSessionCallback
+	{
+		/// Function to call on session lifecycle events
+		Callback_XRSession callback;
+
+		/// App data passed back to the callback (also identifies the callback when deregistering)
+		void *userContext = nullptr;
+	};
+
+	/// Progress callback for asynchronous provider initialization. Called at the start of each phase on the thread running it
+	typedef void ( *Callback_XRInitProgress )( EXRInitPhase eXRInitPhase, void *pUserContext );
 	struct XRCallback
 	{
+		/// Event type to receive (XR_TYPE_EVENT_DATA_BUFFER to receive all events)
 		XrStructureType type;
+
+		/// Function to call when an event of the type is polled
 		Callback_XREvent callback;
+
+		/// App data passed back to the callback (e.g. the object that handles the event)
+		void *userContext = nullptr;
 	};
 }
@@ -24,6 +24,10 @@
 #pragma once
 
 #include <XRCommon.h>
+#include <XRDeferredLog.h>
+#include <XRCapabilityCache.h>
+#include <XRClock.h>
+#include <XRSpaceRegistry.h>
 #include <XREventHandler.h>
 #include <rendering/XRGraphicsAwareTypes.h>
 #include <extensions/XRExtHandTracking.h>
@@ -47,11 +51,20 @@ namespace OpenXRProvider
 		/// @param[in] bEnableDepth			Whether depth texture support should be enabled if the runtime supports it
 		XRCore( XRAppInfo xrAppInfo, XRAppGraphicsInfo xrAppGraphicsInfo, bool bEnableDepth );
 
+		/// Class Constructor that only creates the instance and retrieves the xr system (no graphics context needed).
+		/// CreateSession must be called before the core can be used
+		/// @param[in] xrAppInfo			App metadata used to create an instance to the active OpenXR runtime
+		/// @param[in] bEnableDepth			Whether depth texture support should be enabled if the runtime supports it
+		XRCore( XRAppInfo xrAppInfo, bool bEnableDepth );
+
 		/// Class Destructor
 		~XRCore();
 
-		/// Poll for OpenXR events so app can act on it (e.g. Session state changes, visibility mask changes, etc)
-		void PollXREvents();
+		/// Poll for OpenXR events so app can act on it (e.g. Session state changes, visibility mask changes, etc).
+		/// Drains the event queue, dispatching each event to its registered callbacks
+		/// @param[in]	nMaxEvents	(optional: 0) Maximum number of events to dispatch this call (0 to drain all pending events)
+		/// @return		Number of events dispatched
+		uint32_t PollXREvents( uint32_t nMaxEvents = 0 );
 
 		/// Getter for the array of extensions names that are active in the current OpenXR session
 		/// @return		Array of extensions names that are active in the current OpenXR session
@@ -69,10 +82,38 @@ namespace OpenXRProvider
 		/// @return		If  depth textures are supported and runtime supports it
 		bool GetIsDepthSupported() const { return m_bIsDepthSupported; }
 
+		/// Getter if cylinder composition layers are supported and enabled (XR_KHR_composition_layer_cylinder)
+		/// @return		If the runtime supports cylinder layers
+		bool GetIsCylinderLayerSupported() const { return m_bIsCylinderLayerSupported; }
+
+		/// Getter if equirect composition layers are supported and enabled (XR_KHR_composition_layer_equirect)
+		/// @return		If the runtime supports equirect layers
+		bool GetIsEquirectLayerSupported() const { return m_bIsEquirectLayerSupported; }
+
+		/// Getter if spaces can be located in a single call per frame (XR_KHR_locate_spaces, needs an OpenXR SDK that has it)
+		/// @return		If the runtime's batched space location extension is enabled
+		bool GetIsLocateSpacesSupported() const { return m_bIsLocateSpacesSupported; }
+
+		/// Getter if XrTime can be converted to the host clock by the runtime (XR_KHR_win32_convert_performance_counter_time)
+		/// @return		If the runtime's time conversion extension is enabled
+		bool GetIsTimeConversionSupported() const { return m_bIsTimeConversionSupported; }
+
+		/// Getter for the clock that converts between XrTime and the host's steady clock and records latency probes
+		/// @return		Pointer to the clock
+		XRClock *GetClock() const { return m_pXRClock; }
+
 		/// Getter for the logger object
 		/// @return		Pointer to the logger object
 		std::shared_ptr< spdlog::logger > GetLogger() const { return m_pLogger; }
 
+		/// Getter for the runtime capability cache
+		/// @return		Pointer to the capability cache (nullptr if the app didn't provide a cache file)
+		XRCapabilityCache *GetCapabilityCache() const { return m_pXRCapabilityCache; }
+
+		/// Getter for the deferred log that formats and writes messages from per-frame code on a background thread
+		/// @return		Pointer to the deferred log (writes to the same sinks as GetLogger)
+		XRDeferredLog *GetDeferredLog() const { return m_pXRDeferredLog; }
+
 		/// Getter for the Event Handler object that broadcasts events to listeners via their registered callback functions
 		/// @return		Pointer to the event handler object
 		XREventHandler *GetXREventHandler() const { return m_pXREventHandler; }
@@ -85,6 +126,10 @@ namespace OpenXRProvider
 		/// @return		Active OpenXR instance
 		XrInstance GetXRInstance() const { return m_xrInstance; } 
 
+		/// Getter for the function pointers of the active OpenXR instance
+		/// @return		Dispatch table of the active OpenXR instance
+		const XRDispatchTable *GetDispatchTable() const { return &m_xrDispatchTable; }
+
 		/// Getter for the active OpenXR session
 		/// @return		The active OpenXR session
 		XrSession GetXRSession() const { return m_xrSession; }
@@ -93,6 +138,18 @@ namespace OpenXRProvider
 		/// @return		The current app reference space
 		XrSpace GetXRSpace() const { return m_xrSpace; }
 
+		/// Getter for the headset (HMD) view space
+		/// @return		The view space
+		XrSpace GetXRViewSpace() const { return m_xrViewSpace; }
+
+		/// Getter for the space registry. Every registered space is located in the reference space with a single LocateSpaces call
+		/// @return		The space registry
+		XRSpaceRegistry *GetSpaceRegistry() const { return m_pXRSpaceRegistry; }
+
+		/// Getter for the slot of the headset (HMD) view space in the space registry
+		/// @return		Slot of the view space
+		uint32_t GetViewSpaceSlot() const { return m_nViewSpaceSlot; }
+
 		/// Getter for the current OpenXR System Id
 		/// @return		The current OpenXR System Id of the active OpenXR runtime
 		XrSystemId GetXRSystemId() const { return m_xrSystemId; }			
@@ -105,14 +162,53 @@ namespace OpenXRProvider
 		/// @param[in]	xrSession	Set the active OpenXR session
 		void SetXRSession( XrSession xrSession ) { m_xrSession = xrSession; }
 
-		/// Call OpenXR xrBeginSession to start app frame synchronization
-		/// @return	XrResult	The result of the xrEndSession call
+		/// Call OpenXR xrBeginSession to start app frame synchronization. Called by PollXREvents when the session becomes ready,
+		/// does nothing if the session is already running. Session callbacks get SESSION_EVENT_READY once it has begun
+		/// @return	XrResult	The result of the xrBeginSession call
 		XrResult XRBeginSession();
 
-		/// Call OpenXR xrEndSession to allow runtime to safely transition back to idle
+		/// Call OpenXR xrEndSession to allow runtime to safely transition back to idle. Called by PollXREvents when the session is stopping,
+		/// does nothing if the session isn't running. Session callbacks get SESSION_EVENT_STOPPING before it's ended
 		/// @return	XrResult	The result of the xrEndSession call
 		XrResult XREndSession();
 
+		/// Getter for the current session state (as last reported by the runtime)
+		/// @return		The current session state
+		XrSessionState GetSessionState() const { return m_xrSessionState; }
+
+		/// Getter for whether the session has been begun and not yet ended
+		/// @return		If the session is running
+		bool GetIsSessionRunning() const { return m_bSessionRunning; }
+
+		/// Getter for whether the session was lost and is waiting to be recreated
+		/// @return		If the session is lost
+		bool GetIsSessionLost() const { return m_bSessionLost.load( std::memory_order_relaxed ); }
+
+		/// Flag the session as lost if an OpenXR call reported so. PollXREvents recreates lost sessions. Safe to call from any thread
+		/// @param[in]	xrResult	Result of an OpenXR call on the session
+		void CheckSessionLost( XrResult xrResult )
+		{
+			if ( xrResult == XR_ERROR_SESSION_LOST )
+				m_bSessionLost.store( true, std::memory_order_relaxed );
+		}
+
+		/// Destroy the session and create a new one, keeping the instance, system and everything created from them (action sets, paths, etc).
+		/// Session callbacks release and rebuild what depends on the session. Call on the thread with the app's graphics context
+		/// @return		If the session was recreated. False if the xr system isn't available yet (e.g. headset asleep), try again later
+		bool RecreateSession();
+
+		/// Register a callback that releases and rebuilds session resources when the session is recreated
+		/// @param[in]	xrSessionCallback	Callback function and app data to register
+		void RegisterSessionCallback( XRSessionCallback xrSessionCallback );
+
+		/// Deregister a session callback
+		/// @param[in]	pUserContext	App data the callback was registered with
+		void DeregisterSessionCallback( void *pUserContext );
+
+		/// Create the session and reference space for a core created without graphics info. Call on the thread with the app's graphics context
+		/// @param[in] xrAppGraphicsInfo	App graphics metadata based on current active api
+		void CreateSession( XRAppGraphicsInfo xrAppGraphicsInfo );
+
 	  private:
 		// ** FUNCTIONS (PRIVATE) **/
 
@@ -130,7 +226,11 @@ namespace OpenXRProvider
 		/// Execute all registered callback functions. Used after an OpenXR poll and an event state has been triggered by the runtime
 		/// @param[in]	xrEventType	The type of OpenXR event that triggered the callback
 		/// @param[in]	eXREventData
-		void ExecuteCallbacks( XrEventDataBuffer xrEvent );
+		void ExecuteCallbacks( const XrEventDataBuffer &xrEvent );
+
+		/// Track the session state and drive the session lifecycle (begin when ready, end when stopping, recreate when lost)
+		/// @param[in]	xrEventDataSessionStateChanged	The session state change event
+		void UpdateSessionState( const XrEventDataSessionStateChanged &xrEventDataSessionStateChanged );
 
 		/// Load the current OpenXR runtime and retrieve its system properties
 		/// @return		Result of the OpenXR calls to retrieve the xr system properties from the active OpenXR runtime
@@ -148,6 +248,18 @@ namespace OpenXRProvider
 		///  If depth textures are supported
 		bool m_bIsDepthSupported = false;
 
+		/// If cylinder composition layers are supported
+		bool m_bIsCylinderLayerSupported = false;
+
+		/// If equirect composition layers are supported
+		bool m_bIsEquirectLayerSupported = false;
+
+		/// If the platform's time conversion extension is supported
+		bool m_bIsTimeConversionSupported = false;
+
+		/// If batched space location is supported
+		bool m_bIsLocateSpacesSupported = false;
+
 		/// Version of the application using this library
 		uint32_t m_nAppVersion;
 
@@ -172,6 +284,15 @@ namespace OpenXRProvider
 		/// Pointer to the logger
 		std::shared_ptr< spdlog::logger > m_pLogger;
 
+		/// Pointer to the deferred log (per-frame messages)
+		XRDeferredLog *m_pXRDeferredLog = nullptr;
+
+		/// Pointer to the runtime capability cache (optional)
+		XRCapabilityCache *m_pXRCapabilityCache = nullptr;
+
+		/// Pointer to the clock bridging XrTime and the host's steady clock
+		XRClock *m_pXRClock = nullptr;
+
 		/// Pointer to the active Event Handler that broadcasts events to listeners via their registered callback functions
 		XREventHandler *m_pXREventHandler = nullptr;
 
@@ -181,6 +302,9 @@ namespace OpenXRProvider
 		/// The current OpenXR instance
 		XrInstance m_xrInstance = XR_NULL_HANDLE;
 
+		/// Function pointers of the current OpenXR instance
+		XRDispatchTable m_xrDispatchTable;
+
 		/// Results of the last call to the OpenXR api
 		XrResult m_xrLastCallResult = XR_SUCCESS;
 
@@ -193,6 +317,18 @@ namespace OpenXRProvider
 		/// Current session state
 		XrSessionState m_xrSessionState = { XR_SESSION_STATE_UNKNOWN }; 
 
+		/// If the session has been begun and not yet ended
+		bool m_bSessionRunning = false;
+
+		/// If the session was lost (XR_ERROR_SESSION_LOST or XR_SESSION_STATE_LOSS_PENDING) and needs to be recreated
+		std::atomic< bool > m_bSessionLost { false };
+
+		/// Callbacks that release and rebuild session resources when the session is recreated
+		std::vector< XRSessionCallback > m_vXRSessionCallbacks;
+
+		/// The app's graphics info the session was created with (for recreating the session)
+		XRAppGraphicsInfo *m_pXRAppGraphicsInfo = nullptr;
+
 		/// The application space which represents the user's play space
 		XrSpace m_xrSpace = XR_NULL_HANDLE;		
 
@@ -205,6 +341,12 @@ namespace OpenXRProvider
 		/// The headset (HMD) view space
 		XrSpace m_xrViewSpace = XR_NULL_HANDLE;
 
+		/// Registry of all spaces located each frame (reference, view, action spaces, etc)
+		XRSpaceRegistry *m_pXRSpaceRegistry = nullptr;
+
+		/// Slot of the view space in the space registry
+		uint32_t m_nViewSpaceSlot = 0;
+
 		/// The current predicted display time
 		XrTime m_xrPredictedDisplayTime = { 0 }; // The current display time, use this as a single point of truth for current frame time
 
@@ -0,0 +1,292 @@
+/* Copyright 2021 Rune Berg (GitHub: https://github.com/1runeberg, Twitter: https://twitter.com/1runeberg)
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *  BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ *  GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+ *  DAMAGE.
+ *
+ */
+
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+#include <XRCommon.h>
+#include <XRRingBuffer.h>
+
+namespace OpenXRProvider
+{
+	/// Maximum number of errors per second that a single XR_CALL_DEFERRED call site will log
+	static const uint32_t k_nXRCallErrorsPerSecond = 1;
+
+	/// Longest the idle deferred log thread sleeps before checking for dropped messages to report (in milliseconds)
+	static const uint32_t k_nDeferredLogIdleWaitMs = 1000;
+
+	/// Type of a raw argument captured by the deferred log
+	enum EXRLogArgType
+	{
+		LOG_ARG_INT = 0,
+		LOG_ARG_UINT = 1,
+		LOG_ARG_DOUBLE = 2,
+		LOG_ARG_STRING = 3
+	};
+
+	/// A raw log argument, copied as is by the calling thread and formatted later by the log thread
+	struct XRLogArg
+	{
+		/// Which member of the union holds the value
+		EXRLogArgType Type;
+
+		union
+		{
+			int64_t Int;
+			uint64_t UInt;
+			double Double;
+			const char *String;
+		};
+	};
+
+	/// A deferred log call site. There is one static instance per XR_LOG_DEFERRED / XR_CALL_DEFERRED call site holding the format string and rate limit
+	struct XRLogSite
+	{
+		/// Log level of the messages from this site
+		spdlog::level::level_enum Level;
+
+		/// fmt style format string of the messages from this site
+		const char *Format;
+
+		/// Maximum number of messages logged per second from this site (0 for no limit)
+		uint32_t MaxPerSecond;
+
+		/// Start of the current one second rate limit window (steady clock ns)
+		std::atomic< int64_t > WindowStart { 0 };
+
+		/// Number of messages from this site in the current rate limit window
+		std::atomic< uint32_t > WindowCount { 0 };
+
+		/// Number of messages dropped by the rate limit since the last logged message
+		std::atomic< uint32_t > SuppressedCount { 0 };
+
+		constexpr XRLogSite( spdlog::level::level_enum eLevel, const char *sFormat, uint32_t nMaxPerSecond )
+			: Level( eLevel )
+			, Format( sFormat )
+			, MaxPerSecond( nMaxPerSecond )
+		{
+		}
+	};
+
+	/// A log message waiting to be formatted
+	struct XRLogEntry
+	{
+		/// Maximum number of arguments a deferred message can have
+		static const uint32_t k_nMaxArgs = 6;
+
+		/// The call site that logged the message
+		XRLogSite *Site;
+
+		/// When the message was logged
+		spdlog::log_clock::time_point Time;
+
+		/// Number of arguments in Args
+		uint32_t ArgCount;
+
+		/// Number of messages from the same site that were dropped by the rate limit before this one
+		uint32_t SuppressedCount;
+
+		/// The raw arguments of the message
+		XRLogArg Args[ k_nMaxArgs ];
+	};
+
+	/// Logger backend that takes formatting and sink writes off the calling thread. Each logging thread copies the call site and raw arguments into its
+	/// own lock-free ring and a background thread formats them into the existing spdlog logger (and its sinks)
+	class XRDeferredLog
+	{
+	  public:
+		// ** FUNCTIONS (PUBLIC) **/
+
+		/// Number of messages each logging thread can have waiting before new ones are dropped
+		static const size_t k_nRingSize = 256;
+
+		/// Class Constructor. Starts the log thread
+		/// @param[in]	pLogger		The logger (and sinks) that messages are written to. Its sinks must be thread safe if it's also used directly
+		XRDeferredLog( std::shared_ptr< spdlog::logger > pLogger );
+
+		/// Class Destructor. Writes out all waiting messages and stops the log thread
+		~XRDeferredLog();
+
+		/// Queue a message. Only the site pointer and raw arguments are copied, string arguments must outlive the log thread (e.g. literals, XrEnumToString)
+		/// @param[in]	xrLogSite	The call site of the message (use XR_LOG_DEFERRED to create one)
+		/// @param[in]	args		Arithmetic, enum or static string arguments for the site's format string
+		template< typename... Args > void Log( XRLogSite &xrLogSite, const Args &... args )
+		{
+			static_assert( sizeof...( Args ) <= XRLogEntry::k_nMaxArgs, "Too many arguments for a deferred log message" );
+
+			if ( !m_pXRLogger->should_log( xrLogSite.Level ) || IsRateLimited( xrLogSite ) )
+				return;
+
+			XRLogEntry xrLogEntry;
+			xrLogEntry.Site = &xrLogSite;
+			xrLogEntry.Time = spdlog::log_clock::now();
+			xrLogEntry.ArgCount = 0;
+			xrLogEntry.SuppressedCount = xrLogSite.SuppressedCount.exchange( 0, std::memory_order_relaxed );
+			( AddArg( xrLogEntry, args ), ... );
+
+			Enqueue( xrLogEntry );
+		}
+
+		/// Getter for the number of messages that were dropped because a thread's ring was full
+		/// @return		Number of dropped messages
+		uint32_t GetDroppedCount() const { return m_nDroppedCount.load( std::memory_order_relaxed ); }
+
+	  private:
+		// ** FUNCTIONS (PRIVATE) **/
+
+		/// Ring of waiting messages for a single logging thread
+		typedef XRRingBuffer< XRLogEntry, k_nRingSize > XRLogRing;
+
+		/// Copy a raw argument into a log entry
+		/// @param[in,out]	xrLogEntry	The entry to add the argument to
+		/// @param[in]		arg			The argument to add
+		template< typename T > static void AddArg( XRLogEntry &xrLogEntry, const T &arg )
+		{
+			typedef typename std::decay< T >::type ArgType;
+			XRLogArg &xrLogArg = xrLogEntry.Args[ xrLogEntry.ArgCount++ ];
+
+			if constexpr ( std::is_convertible< ArgType, const char * >::value )
+			{
+				xrLogArg.Type = LOG_ARG_STRING;
+				xrLogArg.String = arg;
+			}
+			else if constexpr ( std::is_floating_point< ArgType >::value )
+			{
+				xrLogArg.Type = LOG_ARG_DOUBLE;
+				xrLogArg.Double = ( double )arg;
+			}
+			else if constexpr ( std::is_enum< ArgType >::value || std::is_signed< ArgType >::value )
+			{
+				static_assert( std::is_enum< ArgType >::value || std::is_integral< ArgType >::value, "Deferred log arguments must be arithmetic, enums or static strings" );
+				xrLogArg.Type = LOG_ARG_INT;
+				xrLogArg.Int = ( int64_t )arg;
+			}
+			else
+			{
+				static_assert( std::is_integral< ArgType >::value, "Deferred log arguments must be arithmetic, enums or static strings" );
+				xrLogArg.Type = LOG_ARG_UINT;
+				xrLogArg.UInt = ( uint64_t )arg;
+			}
+		}
+
+		/// Apply a call site's rate limit
+		/// @param[in]	xrLogSite	The call site of the message
+		/// @return		If the message should be dropped
+		bool IsRateLimited( XRLogSite &xrLogSite );
+
+		/// Push a message to the calling thread's ring (counts it as dropped if the ring is full)
+		/// @param[in]	xrLogEntry	The message to queue
+		void Enqueue( const XRLogEntry &xrLogEntry );
+
+		/// Retrieve the calling thread's ring, creating it on the thread's first message (each thread has one ring per deferred log)
+		/// @return		The calling thread's ring
+		XRLogRing *GetThreadRing();
+
+		/// Format a message and write it to the logger
+		/// @param[in]	xrLogEntry	The message to write
+		void Write( const XRLogEntry &xrLogEntry );
+
+		/// Format and write all waiting messages
+		/// @return		If any messages were written
+		bool Drain();
+
+		/// Check if any thread's ring has messages waiting (takes m_RingsMutex)
+		/// @return		If there are messages to write
+		bool HasWaitingMessages();
+
+		/// Log thread: drains the rings until the deferred log is destroyed, sleeping while there is nothing to write
+		void LogLoop();
+
+		// ** MEMBER VARIABLES (PRIVATE) **/
+
+		/// Unique id of this deferred log (so threads don't reuse a ring from a destroyed deferred log)
+		uint64_t m_nId = 0;
+
+		/// Logger the messages are written to
+		std::shared_ptr< spdlog::logger > m_pXRLogger;
+
+		/// Rings of every thread that has logged a message
+		std::vector< std::unique_ptr< XRLogRing > > m_vRings;
+
+		/// Thread that owns each ring in m_vRings (one ring per thread)
+		std::vector< std::thread::id > m_vRingOwners;
+
+		/// Guards m_vRings and m_vRingOwners (only taken when a thread's ring isn't in its cache and briefly by the log thread)
+		std::mutex m_RingsMutex;
+
+		/// Copy of the ring pointers the log thread drains without holding m_RingsMutex (refreshed when a ring is added)
+		std::vector< XRLogRing * > m_vDrainRings;
+
+		/// The log thread
+		std::thread m_LogThread;
+
+		/// If the log thread should keep running
+		std::atomic< bool > m_bIsRunning { false };
+
+		/// If the log thread is (about to be) asleep, so logging threads know to wake it
+		std::atomic< bool > m_bIsLogThreadWaiting { false };
+
+		/// Guards the log thread's sleep so a wakeup from a logging thread is never missed
+		std::mutex m_LogSignalMutex;
+
+		/// Wakes the log thread when a message is queued or the deferred log is destroyed
+		std::condition_variable m_LogSignal;
+
+		/// Number of messages dropped because a thread's ring was full
+		std::atomic< uint32_t > m_nDroppedCount { 0 };
+
+		/// Number of dropped messages already reported in the log
+		uint32_t m_nReportedDroppedCount = 0;
+	};
+
+	/// Queue a deferred message, formatted later on the log thread. At most nMaxPerSecond messages per second are logged from this call site (0 for no limit)
+	#define XR_LOG_DEFERRED( pDeferredLog, eLevel, nMaxPerSecond, sFormat, ... )                                                                                \
+		[ & ]() {                                                                                                                                                 \
+			static XRLogSite s_xrLogSite( eLevel, sFormat, nMaxPerSecond );                                                                                       \
+			( pDeferredLog )->Log( s_xrLogSite, ##__VA_ARGS__ );                                                                                                  \
+		}()
+
+	/// Execute a call to the OpenXR api and evaluate the result, failures are logged through the deferred log (rate limited). For per-frame calls
+	#define XR_CALL_DEFERRED( xrCall, pDeferredLog )                                                                                                              \
+		[ & ]() -> XrResult {                                                                                                                                     \
+			static XRCallSite s_xrCallSite( #xrCall, __FILE__, __LINE__ );                                                                                        \
+			static XRLogSite s_xrLogSite( spdlog::level::err, "Error on OpenXR call {}. Error ({}) {} in file {} line {}", k_nXRCallErrorsPerSecond );            \
+			return CheckXrResult( xrCall, *( pDeferredLog ), s_xrCallSite, s_xrLogSite );                                                                        \
+		}()
+	inline XrResult CheckXrResult( XrResult xrResult, XRDeferredLog &xrDeferredLog, XRCallSite &xrCallSite, XRLogSite &xrLogSite )
+	{
+		xrCallSite.Record( xrResult );
+
+		if ( XR_FAILED( xrResult ) )
+			xrDeferredLog.Log( xrLogSite, xrCallSite.Call, ( int32_t )xrResult, XrEnumToString( xrResult ), xrCallSite.File, xrCallSite.Line );
+
+		return xrResult;
+	}
+} // namespace OpenXRProvider
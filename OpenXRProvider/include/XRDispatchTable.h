@@ -0,0 +1,147 @@
+/* Copyright 2021 Rune Berg (GitHub: https://github.com/1runeberg, Twitter: https://twitter.com/1runeberg)
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *  BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ *  GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+ *  DAMAGE.
+ *
+ */
+
+
+#pragma once
+
+// Platform and graphic apis
+#include <rendering/XRGraphicsAPIDefines.h>
+#include <XRPlatformDefines.h>
+
+// OpenXR Headers
+#include <openxr/openxr.h>
+#include <openxr/openxr_platform.h>
+#include <openxr/openxr_reflection.h>
+
+//** FUNCTION LISTS */
+// Same shape as the XR_LIST_FUNCTIONS_* macros of newer openxr_reflection.h: _( name without the xr prefix, version or extension ).
+// The core list comes from the reflection header when it has one, otherwise from the list below (OpenXR 1.0)
+
+#ifdef XR_LIST_FUNCTIONS_XR_VERSION_1_0
+	#define XR_PROVIDER_LIST_FUNCTIONS_CORE( _ ) XR_LIST_FUNCTIONS_XR_VERSION_1_0( _ )
+#else
+	#define XR_PROVIDER_LIST_FUNCTIONS_CORE( _ )                \
+		_( GetInstanceProcAddr, VERSION_1_0 )                  \
+		_( EnumerateApiLayerProperties, VERSION_1_0 )          \
+		_( EnumerateInstanceExtensionProperties, VERSION_1_0 ) \
+		_( CreateInstance, VERSION_1_0 )                       \
+		_( DestroyInstance, VERSION_1_0 )                      \
+		_( GetInstanceProperties, VERSION_1_0 )                \
+		_( PollEvent, VERSION_1_0 )                            \
+		_( ResultToString, VERSION_1_0 )                       \
+		_( StructureTypeToString, VERSION_1_0 )                \
+		_( GetSystem, VERSION_1_0 )                            \
+		_( GetSystemProperties, VERSION_1_0 )                  \
+		_( EnumerateEnvironmentBlendModes, VERSION_1_0 )       \
+		_( CreateSession, VERSION_1_0 )                        \
+		_( DestroySession, VERSION_1_0 )                       \
+		_( EnumerateReferenceSpaces, VERSION_1_0 )             \
+		_( CreateReferenceSpace, VERSION_1_0 )                 \
+		_( GetReferenceSpaceBoundsRect, VERSION_1_0 )          \
+		_( CreateActionSpace, VERSION_1_0 )                    \
+		_( LocateSpace, VERSION_1_0 )                          \
+		_( DestroySpace, VERSION_1_0 )                         \
+		_( EnumerateViewConfigurations, VERSION_1_0 )          \
+		_( GetViewConfigurationProperties, VERSION_1_0 )       \
+		_( EnumerateViewConfigurationViews, VERSION_1_0 )      \
+		_( EnumerateSwapchainFormats, VERSION_1_0 )            \
+		_( CreateSwapchain, VERSION_1_0 )                      \
+		_( DestroySwapchain, VERSION_1_0 )                     \
+		_( EnumerateSwapchainImages, VERSION_1_0 )             \
+		_( AcquireSwapchainImage, VERSION_1_0 )                \
+		_( WaitSwapchainImage, VERSION_1_0 )                   \
+		_( ReleaseSwapchainImage, VERSION_1_0 )                \
+		_( BeginSession, VERSION_1_0 )                         \
+		_( EndSession, VERSION_1_0 )                           \
+		_( RequestExitSession, VERSION_1_0 )                   \
+		_( WaitFrame, VERSION_1_0 )                            \
+		_( BeginFrame, VERSION_1_0 )                           \
+		_( EndFrame, VERSION_1_0 )                             \
+		_( LocateViews, VERSION_1_0 )                          \
+		_( StringToPath, VERSION_1_0 )                         \
+		_( PathToString, VERSION_1_0 )                         \
+		_( CreateActionSet, VERSION_1_0 )                      \
+		_( DestroyActionSet, VERSION_1_0 )                     \
+		_( CreateAction, VERSION_1_0 )                         \
+		_( DestroyAction, VERSION_1_0 )                        \
+		_( SuggestInteractionProfileBindings, VERSION_1_0 )    \
+		_( AttachSessionActionSets, VERSION_1_0 )              \
+		_( GetCurrentInteractionProfile, VERSION_1_0 )         \
+		_( GetActionStateBoolean, VERSION_1_0 )                \
+		_( GetActionStateFloat, VERSION_1_0 )                  \
+		_( GetActionStateVector2f, VERSION_1_0 )               \
+		_( GetActionStatePose, VERSION_1_0 )                   \
+		_( SyncActions, VERSION_1_0 )                          \
+		_( EnumerateBoundSourcesForAction, VERSION_1_0 )       \
+		_( GetInputSourceLocalizedName, VERSION_1_0 )          \
+		_( ApplyHapticFeedback, VERSION_1_0 )                  \
+		_( StopHapticFeedback, VERSION_1_0 )
+#endif
+
+/// Functions of the instance extensions the provider supports (null in the table if the extension isn't enabled)
+#ifdef XR_USE_GRAPHICS_API_OPENGL
+	#define XR_PROVIDER_LIST_FUNCTIONS_GRAPHICS( _ ) _( GetOpenGLGraphicsRequirementsKHR, XR_KHR_opengl_enable )
+#else
+	#define XR_PROVIDER_LIST_FUNCTIONS_GRAPHICS( _ )
+#endif
+
+#if defined( XR_USE_PLATFORM_WIN32 )
+	#define XR_PROVIDER_LIST_FUNCTIONS_TIME_CONVERSION( _ ) _( ConvertWin32PerformanceCounterToTimeKHR, XR_KHR_win32_convert_performance_counter_time )
+#elif defined( XR_USE_TIMESPEC )
+	#define XR_PROVIDER_LIST_FUNCTIONS_TIME_CONVERSION( _ ) _( ConvertTimespecTimeToTimeKHR, XR_KHR_convert_timespec_time )
+#else
+	#define XR_PROVIDER_LIST_FUNCTIONS_TIME_CONVERSION( _ )
+#endif
+
+#ifdef XR_KHR_locate_spaces
+	#define XR_PROVIDER_LIST_FUNCTIONS_LOCATE_SPACES( _ ) _( LocateSpacesKHR, XR_KHR_locate_spaces )
+#else
+	#define XR_PROVIDER_LIST_FUNCTIONS_LOCATE_SPACES( _ )
+#endif
+
+#define XR_PROVIDER_LIST_FUNCTIONS_EXTENSIONS( _ )          \
+	XR_PROVIDER_LIST_FUNCTIONS_GRAPHICS( _ )                \
+	XR_PROVIDER_LIST_FUNCTIONS_TIME_CONVERSION( _ )         \
+	XR_PROVIDER_LIST_FUNCTIONS_LOCATE_SPACES( _ )           \
+	_( GetVisibilityMaskKHR, XR_KHR_visibility_mask )      \
+	_( CreateHandTrackerEXT, XR_EXT_hand_tracking )        \
+	_( DestroyHandTrackerEXT, XR_EXT_hand_tracking )       \
+	_( LocateHandJointsEXT, XR_EXT_hand_tracking )
+
+namespace OpenXRProvider
+{
+	/// Function pointers of an OpenXR instance, retrieved once after the instance is created. Calls through the table go straight to the
+	/// top of the instance's dispatch chain (api layer or runtime) instead of through the loader's exported trampolines
+	struct XRDispatchTable
+	{
+#define XR_PROVIDER_DISPATCH_MEMBER( name, version ) PFN_xr##name xr##name = nullptr;
+		XR_PROVIDER_LIST_FUNCTIONS_CORE( XR_PROVIDER_DISPATCH_MEMBER )
+		XR_PROVIDER_LIST_FUNCTIONS_EXTENSIONS( XR_PROVIDER_DISPATCH_MEMBER )
+#undef XR_PROVIDER_DISPATCH_MEMBER
+
+		/// Retrieve every function in the table from an instance. Functions of extensions that aren't enabled are left null
+		/// @param[in]	xrInstance	The instance to retrieve the functions from
+		/// @return		XR_SUCCESS if all core functions were retrieved, otherwise the first failed retrieval
+		XrResult Load( XrInstance xrInstance );
+	};
+} // namespace OpenXRProvider
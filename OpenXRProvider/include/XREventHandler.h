@@ -24,9 +24,17 @@
 #pragma once
 
 #include <XRCommon.h>
+#include <XRRingBuffer.h>
 
 namespace OpenXRProvider
 {
+	/// Number of events a subscriber's event ring can hold
+	static const size_t k_nEventRingSize = 16;
+
+	/// Lock-free ring that receives copies of polled events for a consumer on another thread.
+	/// The thread calling XRCore::PollXREvents is the only producer, the subscribing thread is the only consumer (Pop)
+	typedef XRRingBuffer< XrEventDataBuffer, k_nEventRingSize > XREventRing;
+
 	class XREventHandler : public XRBase
 	{
 	  public:
@@ -39,27 +47,105 @@ namespace OpenXRProvider
 		/// Class Destructor
 		~XREventHandler();
 
-		/// Register a callback to the OpenXR Provider event system
-		/// @param[in] pLogger	Pointer to the logger object
-		inline void RegisterCallback( XRCallback *pXRCallback ) { m_pXRCallbacks.push_back( pXRCallback ); }
+		/// Register a callback to the OpenXR Provider event system. Don't register or de-register callbacks from inside a callback
+		/// @param[in] pXRCallback	Pointer to the callback to register (must stay valid until it is de-registered)
+		void RegisterCallback( XRCallback *pXRCallback );
 
 		/// De-register a registered callback in the OpenXR Provider event system
 		/// @param[in] pXRCallback	Pointer to callback that needs de-registering
-		inline void DeregisterCallback( XRCallback *pXRCallback )
+		void DeregisterCallback( XRCallback *pXRCallback );
+
+		/// Register a ring to receive copies of events of the given types (e.g. for audio, physics or networking threads). Register before polling starts
+		/// or from the polling thread. Events are dropped (and counted) if the ring is full
+		/// @param[in]	pXREventRing	The subscriber's ring (must stay valid until it is de-registered)
+		/// @param[in]	vEventTypes		Event types to copy into the ring (XR_TYPE_EVENT_DATA_BUFFER for all events, don't combine it with other types)
+		void RegisterEventRing( XREventRing *pXREventRing, const std::vector< XrStructureType > &vEventTypes );
+
+		/// De-register a ring from all the event types it was registered for. Call from the polling thread or while no events are being polled
+		/// @param[in]	pXREventRing	The subscriber's ring
+		void DeregisterEventRing( XREventRing *pXREventRing );
+
+		/// Getter for the number of events that couldn't be copied into a full subscriber ring
+		/// @return		Number of dropped events (across all rings)
+		uint32_t GetDroppedEventCount() const { return m_nDroppedEventCount.load( std::memory_order_relaxed ); }
+
+		/// Getter for the callbacks registered for an event type
+		/// @param[in]	xrEventType		The event type (XR_TYPE_EVENT_DATA_BUFFER for the callbacks that receive all events)
+		/// @return		Callback function pointers registered for the event type, or for other unlisted extension event types if xrEventType isn't listed
+		const std::vector< XRCallback * > &GetXRCallbacks( XrStructureType xrEventType ) const { return m_vXRCallbacks[ GetEventSlot( xrEventType ) ]; }
+
+		/// Call every callback and fill every ring registered for the event's type and for all events
+		/// @param[in]	xrEvent		The polled event
+		void Dispatch( const XrEventDataBuffer &xrEvent );
+
+	  private:
+		// ** FUNCTIONS (PRIVATE) **/
+
+		/// Number of slots for core event types (their XrStructureType values are all below this and are used as the slot directly)
+		static const uint32_t k_nCoreEventSlots = 64;
+
+		/// Slots for extension event types (their XrStructureType values are too large to index with)
+		enum EXREventSlot
 		{
-			m_pXRCallbacks.erase( std::remove( m_pXRCallbacks.begin(), m_pXRCallbacks.end(), pXRCallback ), m_pXRCallbacks.end() );
-			m_pXRCallbacks.shrink_to_fit();
+			EVENT_SLOT_PERF_SETTINGS = k_nCoreEventSlots,
+			EVENT_SLOT_VISIBILITY_MASK_CHANGED,
+			EVENT_SLOT_MAIN_SESSION_VISIBILITY_CHANGED,
+			EVENT_SLOT_DISPLAY_REFRESH_RATE_CHANGED,
+			EVENT_SLOT_OTHER,
+			EVENT_SLOT_COUNT
+		};
+
+		/// Retrieve the subscriber table slot of an event type
+		/// @param[in]	xrEventType		The event type
+		/// @return		Index into m_vXRCallbacks
+		static uint32_t GetEventSlot( XrStructureType xrEventType )
+		{
+			if ( ( uint32_t )xrEventType < k_nCoreEventSlots )
+				return ( uint32_t )xrEventType;
+
+			switch ( xrEventType )
+			{
+				case XR_TYPE_EVENT_DATA_PERF_SETTINGS_EXT:
+					return EVENT_SLOT_PERF_SETTINGS;
+
+				case XR_TYPE_EVENT_DATA_VISIBILITY_MASK_CHANGED_KHR:
+					return EVENT_SLOT_VISIBILITY_MASK_CHANGED;
+
+				case XR_TYPE_EVENT_DATA_MAIN_SESSION_VISIBILITY_CHANGED_EXTX:
+					return EVENT_SLOT_MAIN_SESSION_VISIBILITY_CHANGED;
+
+				case XR_TYPE_EVENT_DATA_DISPLAY_REFRESH_RATE_CHANGED_FB:
+					return EVENT_SLOT_DISPLAY_REFRESH_RATE_CHANGED;
+
+				default:
+					return EVENT_SLOT_OTHER;
+			}
 		}
 
-		/// Getter for the array of callback function pointers
-		/// @return		Array of callback function pointers that are currently registered in the OpenXR Provider event system
-		std::vector< XRCallback * > GetXRCallbacks() { return m_pXRCallbacks; }
+		/// Call the callbacks in a slot
+		/// @param[in]	nSlot		The subscriber table slot
+		/// @param[in]	xrEvent		The polled event
+		void DispatchSlot( uint32_t nSlot, const XrEventDataBuffer &xrEvent );
+
+		// ** MEMBER VARIABLES (PRIVATE) **/
 
-	  private:
 		/// Results of the last call to the OpenXR api
 		XrResult m_xrLastCallResult = XR_SUCCESS;
 
-		/// Array of callback function pointers that are currently registered in the OpenXR Provider event system
-		std::vector< XRCallback * > m_pXRCallbacks;
+		/// Callback function pointers that are currently registered in the OpenXR Provider event system, indexed by event slot
+		std::vector< XRCallback * > m_vXRCallbacks[ EVENT_SLOT_COUNT ];
+
+		/// A subscriber ring and the event type it was registered for
+		struct XREventRingSubscription
+		{
+			XrStructureType Type;
+			XREventRing *Ring;
+		};
+
+		/// Subscriber rings that are currently registered, indexed by event slot
+		std::vector< XREventRingSubscription > m_vXREventRings[ EVENT_SLOT_COUNT ];
+
+		/// Number of events that couldn't be copied into a full subscriber ring
+		std::atomic< uint32_t > m_nDroppedEventCount { 0 };
 	};
 }
@@ -0,0 +1,96 @@
+/* Copyright 2021 Rune Berg (GitHub: https://github.com/1runeberg, Twitter: https://twitter.com/1runeberg)
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *  BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ *  GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+ *  DAMAGE.
+ *
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace OpenXRProvider
+{
+	/// Fixed capacity, lock-free single producer / single consumer ring buffer.
+	/// Push must only be called from one thread and Pop from one (other) thread. Nothing is allocated after construction
+	/// @tparam T	Type of the items in the ring, copied in and out by value
+	/// @tparam N	Capacity of the ring, must be a power of two
+	template< typename T, size_t N > class XRRingBuffer
+	{
+		static_assert( N > 0 && ( N & ( N - 1 ) ) == 0, "XRRingBuffer capacity must be a power of two" );
+
+		static const size_t k_nMask = N - 1;
+
+	  public:
+		// ** FUNCTIONS (PUBLIC) **/
+
+		/// Add an item to the ring (producer thread only)
+		/// @param[in]	item	The item to copy into the ring
+		/// @return		If the item was added. False if the ring is full
+		bool Push( const T &item )
+		{
+			const size_t nTail = m_nTail.load( std::memory_order_relaxed );
+			if ( nTail - m_nHead.load( std::memory_order_acquire ) == N )
+				return false;
+
+			m_Items[ nTail & k_nMask ] = item;
+			m_nTail.store( nTail + 1, std::memory_order_release );
+			return true;
+		}
+
+		/// Take the oldest item out of the ring (consumer thread only)
+		/// @param[out]	item	The item to copy the oldest entry to
+		/// @return		If an item was retrieved. False if the ring is empty
+		bool Pop( T &item )
+		{
+			const size_t nHead = m_nHead.load( std::memory_order_relaxed );
+			if ( nHead == m_nTail.load( std::memory_order_acquire ) )
+				return false;
+
+			item = m_Items[ nHead & k_nMask ];
+			m_nHead.store( nHead + 1, std::memory_order_release );
+			return true;
+		}
+
+		/// Getter for the number of items currently in the ring. Only a snapshot if the other thread is active
+		/// @return		Number of items waiting to be popped
+		size_t GetSize() const { return m_nTail.load( std::memory_order_acquire ) - m_nHead.load( std::memory_order_acquire ); }
+
+		/// Getter for the capacity of the ring
+		/// @return		Maximum number of items the ring can hold
+		static constexpr size_t GetCapacity() { return N; }
+
+		/// Drop all items in the ring. Only safe while neither the producer nor the consumer is active
+		void Clear() { m_nHead.store( m_nTail.load( std::memory_order_relaxed ), std::memory_order_relaxed ); }
+
+	  private:
+		// ** MEMBER VARIABLES (PRIVATE) **/
+
+		/// Read position, only written by the consumer. Kept on its own cache line to avoid false sharing with the producer
+		alignas( 64 ) std::atomic< size_t > m_nHead { 0 };
+
+		/// Write position, only written by the producer
+		alignas( 64 ) std::atomic< size_t > m_nTail { 0 };
+
+		/// Item storage
+		T m_Items[ N ];
+	};
+} // namespace OpenXRProvider
@@ -0,0 +1,174 @@
+/* Copyright 2021 Rune Berg (GitHub: https://github.com/1runeberg, Twitter: https://twitter.com/1runeberg)
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *  BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ *  GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+ *  DAMAGE.
+ *
+ */
+
+
+#pragma once
+
+#include <XRCommon.h>
+
+namespace OpenXRProvider
+{
+	/// Results of the last LocateSpaces call in structure of arrays form, indexed by space slot
+	struct XRSpaceLocations
+	{
+		/// Time the spaces were located at
+		XrTime Time = 0;
+
+		/// Position of each space in the base space
+		std::vector< XrVector3f > Positions;
+
+		/// Orientation of each space in the base space
+		std::vector< XrQuaternionf > Orientations;
+
+		/// Linear velocity of each space (only if velocities were requested)
+		std::vector< XrVector3f > LinearVelocities;
+
+		/// Angular velocity of each space (only if velocities were requested)
+		std::vector< XrVector3f > AngularVelocities;
+
+		/// Validity and tracking state of each pose (0 for empty slots and spaces that couldn't be located)
+		std::vector< XrSpaceLocationFlags > LocationFlags;
+
+		/// Validity and tracking state of each velocity
+		std::vector< XrSpaceVelocityFlags > VelocityFlags;
+	};
+
+	/// Flat registry of spaces (reference, view, action spaces, etc) that are all located in a single pass each frame
+	class XRSpaceRegistry
+	{
+	  public:
+		// ** FUNCTIONS (PUBLIC) **/
+
+		/// Class Constructor
+		/// @param[in]	pXRDispatchTable	Function pointers of the active OpenXR instance (spaces are located in one call if it has xrLocateSpacesKHR)
+		/// @param[in]	pLogger				Pointer to the logger
+		XRSpaceRegistry( const XRDispatchTable *pXRDispatchTable, std::shared_ptr< spdlog::logger > pLogger );
+
+		/// Class Destructor. Spaces are owned by whoever added them, the registry never destroys them
+		~XRSpaceRegistry();
+
+		/// Setter for the session the registered spaces belong to
+		/// @param[in]	xrSession	The active session
+		void SetSession( XrSession xrSession ) { m_xrSession = xrSession; }
+
+		/// Setter for the space all other spaces are located in (usually the app's reference space)
+		/// @param[in]	xrBaseSpace		The base space
+		void SetBaseSpace( XrSpace xrBaseSpace ) { m_xrBaseSpace = xrBaseSpace; }
+
+		/// Getter for the space all other spaces are located in
+		/// @return		The base space
+		XrSpace GetBaseSpace() const { return m_xrBaseSpace; }
+
+		/// Add a space to the registry
+		/// @param[in]	xrSpace		The space to locate every LocateSpaces call
+		/// @return		Slot of the space in the registry and in the location arrays
+		uint32_t AddSpace( XrSpace xrSpace );
+
+		/// Replace the space in a slot (e.g. after the session and its spaces were recreated). The slot stays the same
+		/// @param[in]	nSlot		Slot of the space
+		/// @param[in]	xrSpace		The new space (XR_NULL_HANDLE to skip the slot until a space is set again)
+		void SetSpace( uint32_t nSlot, XrSpace xrSpace );
+
+		/// Remove a space from the registry. Its slot may be reused by later AddSpace calls
+		/// @param[in]	nSlot		Slot of the space
+		void RemoveSpace( uint32_t nSlot );
+
+		/// Getter for the space in a slot
+		/// @param[in]	nSlot		Slot of the space
+		/// @return		The space or XR_NULL_HANDLE
+		XrSpace GetSpace( uint32_t nSlot ) const { return nSlot < m_vSpaces.size() ? m_vSpaces[ nSlot ] : XR_NULL_HANDLE; }
+
+		/// Getter for the number of slots (the size of each location array)
+		/// @return		Number of slots
+		uint32_t GetSlotCount() const { return ( uint32_t )m_vSpaces.size(); }
+
+		/// Setter for whether LocateSpaces also retrieves velocities
+		/// @param[in]	bIncludeVelocities	If velocities should be located
+		void SetIncludeVelocities( bool bIncludeVelocities ) { m_bIncludeVelocities = bIncludeVelocities; }
+
+		/// Locate every registered space in the base space
+		/// @param[in]	xrTime		Time to locate the spaces at (usually the predicted display time of the current frame)
+		/// @return		Number of spaces with a valid position or orientation
+		uint32_t LocateSpaces( XrTime xrTime );
+
+		/// Getter for the results of the last LocateSpaces call
+		/// @return		Locations of all spaces, indexed by slot
+		const XRSpaceLocations &GetLocations() const { return m_xrLocations; }
+
+		/// Getter for the pose of a space from the last LocateSpaces call
+		/// @param[in]	nSlot		Slot of the space
+		/// @param[out]	xrPose		Pose of the space in the base space
+		/// @return		If both the position and orientation of the pose are valid
+		bool GetPose( uint32_t nSlot, XrPosef &xrPose ) const;
+
+	  private:
+		// ** FUNCTIONS (PRIVATE) **/
+
+		/// Locate all spaces in a single call with XR_KHR_locate_spaces
+		/// @return		Result of xrLocateSpacesKHR
+		XrResult LocateSpacesBatched();
+
+		// ** MEMBER VARIABLES (PRIVATE) **/
+
+		/// Function pointers of the active OpenXR instance
+		const XRDispatchTable *m_pXRDispatchTable = nullptr;
+
+		/// Pointer to the logger
+		std::shared_ptr< spdlog::logger > m_pXRLogger;
+
+		/// Session the registered spaces belong to
+		XrSession m_xrSession = XR_NULL_HANDLE;
+
+		/// Space all other spaces are located in
+		XrSpace m_xrBaseSpace = XR_NULL_HANDLE;
+
+		/// Registered spaces, indexed by slot (XR_NULL_HANDLE for empty slots)
+		std::vector< XrSpace > m_vSpaces;
+
+		/// Removed slots that can be reused
+		std::vector< uint32_t > m_vFreeSlots;
+
+		/// If LocateSpaces also retrieves velocities
+		bool m_bIncludeVelocities = false;
+
+		/// Results of the last LocateSpaces call
+		XRSpaceLocations m_xrLocations;
+
+#ifdef XR_KHR_locate_spaces
+		/// Compact list of the non-empty slots' spaces, passed to xrLocateSpacesKHR
+		std::vector< XrSpace > m_vBatchSpaces;
+
+		/// Slot of each space in m_vBatchSpaces
+		std::vector< uint32_t > m_vBatchSlots;
+
+		/// Output of xrLocateSpacesKHR
+		std::vector< XrSpaceLocationDataKHR > m_vBatchLocations;
+
+		/// Velocity output of xrLocateSpacesKHR
+		std::vector< XrSpaceVelocityDataKHR > m_vBatchVelocities;
+
+		/// If the compact lists need to be rebuilt (a slot changed)
+		bool m_bBatchDirty = true;
+#endif
+	};
+} // namespace OpenXRProvider
@@ -60,6 +60,9 @@ namespace OpenXRProvider
 
 		void Init( const XrInstance xrInstance, XrSession xrSession );
 
+		/// Destroy both hand trackers (e.g. before the session they were created from is destroyed). Init creates them again
+		void DestroyHandTrackers();
+
 		void LocateHandJoints( XrHandEXT eHand, XrSpace xrSpace, XrTime xrTime, XrHandJointsMotionRangeEXT eMotionrange = XR_HAND_JOINTS_MOTION_RANGE_UNOBSTRUCTED_EXT);
 
 		bool IsActive_Left() const { return bIsHandTrackingActive_Left; }
@@ -109,7 +112,5 @@ namespace OpenXRProvider
 
 		/// The active OpenXR Instance
 		XrInstance m_xrInstance = XR_NULL_HANDLE;
-
-		PFN_xrLocateHandJointsEXT xrLocateHandJointsEXT = nullptr;
 	};
 } // namespace OpenXRProvider
\ No newline at end of file
@@ -0,0 +1,192 @@
+/* Copyright 2021 Rune Berg (GitHub: https://github.com/1runeberg, Twitter: https://twitter.com/1runeberg)
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *  BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ *  GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+ *  DAMAGE.
+ *
+ */
+
+
+#pragma once
+
+#include <XRCommon.h>
+#include <input/XRInputProfileTable.h>
+
+namespace OpenXRProvider
+{
+	/// An action set in an action manifest. Strings are offsets into the manifest's string table
+	struct XRManifestActionSet
+	{
+		uint32_t Name = 0;
+		uint32_t LocalizedName = 0;
+		uint32_t Priority = 0;
+	};
+
+	/// An action in an action manifest
+	struct XRManifestAction
+	{
+		/// Index of the action set the action belongs to
+		uint32_t ActionSet = 0;
+
+		uint32_t Name = 0;
+		uint32_t LocalizedName = 0;
+		XrActionType Type = XR_ACTION_TYPE_BOOLEAN_INPUT;
+
+		/// Range of the action's subaction paths in the manifest's path list
+		uint32_t FirstSubactionPath = 0;
+		uint32_t SubactionPathCount = 0;
+	};
+
+	/// A path in an action manifest (subaction path or interaction profile) with its precomputed hash (XRPathHash)
+	struct XRManifestPath
+	{
+		uint32_t Path = 0;
+		uint32_t Padding = 0;
+		uint64_t Hash = 0;
+	};
+
+	/// A suggested binding in an action manifest. Bindings are sorted by interaction profile
+	struct XRManifestBinding
+	{
+		/// Index of the interaction profile in the manifest's profile list
+		uint32_t Profile = 0;
+
+		/// Index of the action
+		uint32_t Action = 0;
+
+		/// Full binding path (e.g. /user/hand/left/input/trigger/click) and its hash
+		uint32_t Path = 0;
+		uint32_t Padding = 0;
+		uint64_t Hash = 0;
+	};
+
+	/// Declarative description of an app's action sets, actions and suggested bindings, loaded from a text manifest so bindings
+	/// can change without rebuilding the app. The parsed manifest is compiled to a flat binary cache, later launches load the
+	/// cache as is (no parsing or string copies) as long as the text manifest is unchanged. Manifest format, one entry per line:
+	///
+	///		# comment
+	///		actionset <name> "<localized name>" <priority>
+	///		action <action set> <name> "<localized name>" <boolean|float|vector2f|pose|vibration> [subaction paths...]
+	///		binding <interaction profile> <action> <binding path>
+	///
+	/// Action names must be unique across action sets. Action set and action names follow the OpenXR naming rules (lower case letters,
+	/// numbers, '-', '_' and '.', up to XR_MAX_ACTION_SET_NAME_SIZE - 1 and XR_MAX_ACTION_NAME_SIZE - 1 characters), localized names
+	/// must fit XR_MAX_LOCALIZED_ACTION_SET_NAME_SIZE - 1 and XR_MAX_LOCALIZED_ACTION_NAME_SIZE - 1 characters
+	class XRActionManifest
+	{
+	  public:
+		// ** FUNCTIONS (PUBLIC) **/
+
+		/// Class Constructor
+		/// @param[in]	pLogger		Pointer to the logger
+		XRActionManifest( std::shared_ptr< spdlog::logger > pLogger );
+
+		/// Class Destructor
+		~XRActionManifest();
+
+		/// Load a manifest, from the compiled cache if it matches the text manifest, otherwise by parsing the text manifest (and then
+		/// writing the cache). If the text manifest is missing, any complete and consistent cache is used as is since there is no
+		/// source to check it against (e.g. an app that only ships the compiled manifest). Delete the cache to force a failure instead
+		/// @param[in]	sManifestFile	Absolute path and filename of the text manifest
+		/// @param[in]	sCacheFile		(optional) Absolute path and filename of the compiled cache
+		/// @return		If a valid manifest was loaded
+		bool Load( const char *sManifestFile, const char *sCacheFile = nullptr );
+
+		/// Getter for whether the manifest was loaded from the compiled cache
+		/// @return		If the compiled cache was used
+		bool GetIsFromCache() const { return m_bIsFromCache; }
+
+		/// Getter for a string of the manifest
+		/// @param[in]	nOffset		Offset of the string in the string table
+		/// @return		The string
+		const char *GetString( uint32_t nOffset ) const { return m_vStrings.data() + nOffset; }
+
+		/// Getter for the action sets
+		const std::vector< XRManifestActionSet > &GetActionSets() const { return m_vActionSets; }
+
+		/// Getter for the actions
+		const std::vector< XRManifestAction > &GetActions() const { return m_vActions; }
+
+		/// Getter for the subaction paths of all actions
+		const std::vector< XRManifestPath > &GetSubactionPaths() const { return m_vSubactionPaths; }
+
+		/// Getter for the interaction profiles
+		const std::vector< XRManifestPath > &GetProfiles() const { return m_vProfiles; }
+
+		/// Getter for the suggested bindings, sorted by interaction profile
+		const std::vector< XRManifestBinding > &GetBindings() const { return m_vBindings; }
+
+	  private:
+		// ** FUNCTIONS (PRIVATE) **/
+
+		/// Parse a text manifest
+		/// @param[in]	sSource		Contents of the text manifest
+		/// @return		If the manifest is valid
+		bool Parse( const std::string &sSource );
+
+		/// Load the compiled cache
+		/// @param[in]	sCacheFile		Absolute path and filename of the compiled cache
+		/// @param[in]	nSourceHash		Hash of the text manifest the cache must have been compiled from (0 to accept any)
+		/// @return		If a complete cache was loaded. A cache whose counts don't match its file size, or that has any index or string
+		///				offset out of range, is treated as a cache miss
+		bool LoadCompiled( const char *sCacheFile, uint64_t nSourceHash );
+
+		/// Write the compiled cache
+		/// @param[in]	sCacheFile		Absolute path and filename of the compiled cache
+		/// @param[in]	nSourceHash		Hash of the text manifest
+		/// @return		If the cache was written
+		bool SaveCompiled( const char *sCacheFile, uint64_t nSourceHash ) const;
+
+		/// Add a string to the string table
+		/// @param[in]	sString		The string
+		/// @return		Offset of the string
+		uint32_t AddString( const std::string &sString );
+
+		/// Add a path to a path list, reusing an existing entry for the same path
+		/// @param[in]	vPaths		The path list
+		/// @param[in]	sPath		The path
+		/// @return		Index of the path in the list
+		uint32_t AddPath( std::vector< XRManifestPath > &vPaths, const std::string &sPath );
+
+		/// Discard everything loaded so far
+		void Clear();
+
+		// ** MEMBER VARIABLES (PRIVATE) **/
+
+		/// Identifies compiled cache files
+		static const uint32_t k_nFileMagic = 0x4D415258;
+
+		/// Version of the compiled cache format
+		static const uint32_t k_nFileVersion = 1;
+
+		/// Pointer to the logger
+		std::shared_ptr< spdlog::logger > m_pXRLogger;
+
+		/// If the manifest was loaded from the compiled cache
+		bool m_bIsFromCache = false;
+
+		/// All strings of the manifest, null terminated
+		std::vector< char > m_vStrings;
+
+		std::vector< XRManifestActionSet > m_vActionSets;
+		std::vector< XRManifestAction > m_vActions;
+		std::vector< XRManifestPath > m_vSubactionPaths;
+		std::vector< XRManifestPath > m_vProfiles;
+		std::vector< XRManifestBinding > m_vBindings;
+	};
+} // namespace OpenXRProvider
@@ -24,7 +24,11 @@
 #pragma once
 
 #include <XRCore.h>
+#include <XRRingBuffer.h>
 #include <rendering/XRRender.h>
+#include <input/XRPathTable.h>
+#include <input/XRInputProfile.h>
+#include <input/XRActionManifest.h>
 
 // Supported input profiles
 #include <input/XRInputProfile_GoogleDaydream.h>
@@ -42,6 +46,12 @@ namespace OpenXRProvider
 	class XRInput
 	{
 	  public:
+		/// Returned by GetActionHandle for actions (or subaction paths) that aren't registered
+		static const uint32_t k_nInvalidActionHandle = 0xFFFFFFFF;
+
+		/// Number of input events that can wait in the queue before new ones are dropped
+		static const size_t k_nInputEventRingSize = 256;
+
 		// ** FUNCTIONS (PUBLIC) **/
 
 		/// Class Constructor
@@ -52,32 +62,37 @@ namespace OpenXRProvider
 		/// Class Destructor
 		~XRInput();
 
+		/// Get the input profile object of an interaction profile, it is created on first use
+		/// @param[in]	xrDescriptor	Descriptor of the interaction profile (e.g. XRInputProfile_ValveIndex::Descriptor)
+		/// @return		The input profile object, holding the action bindings suggested for the profile
+		XRInputProfile *InputProfile( const XRInputProfileDesc &xrDescriptor );
+
 		/// Input Profile object: Google Daydream
-		XRInputProfile_GoogleDaydream *GoogleDaydream() const { return m_pXRInputProfile_GoogleDaydream; }
+		XRInputProfile *GoogleDaydream() { return InputProfile( XRInputProfile_GoogleDaydream::Descriptor ); }
 
 		/// Input Profile object: HTC Vive
-		XRInputProfile_HTCVive *HTCVive() const { return m_pXRInputProfile_HTCVive; }
+		XRInputProfile *HTCVive() { return InputProfile( XRInputProfile_HTCVive::Descriptor ); }
 
 		/// Input Profile object: HTC Vive Pro
-		XRInputProfile_HTCVivePro *HTCVivePro() const { return m_pXRInputProfile_HTCVivePro; }
+		XRInputProfile *HTCVivePro() { return InputProfile( XRInputProfile_HTCVivePro::Descriptor ); }
 
 		/// Input Profile object: Khronos Simple
-		XRInputProfile_KhronosSimple *KhronosSimple() const { return m_pXRInputProfile_KhronosSimple; }
+		XRInputProfile *KhronosSimple() { return InputProfile( XRInputProfile_KhronosSimple::Descriptor ); }
 
 		/// Input Profile object: Microsoft MR
-		XRInputProfile_MicrosoftMR *MicrosoftMR() const { return m_pXRInputProfile_MicrosoftMR; }
+		XRInputProfile *MicrosoftMR() { return InputProfile( XRInputProfile_MicrosoftMR::Descriptor ); }
 
 		/// Input Profile object: Microsoft XBox
-		XRInputProfile_MicrosoftXBox *MicrosoftXBox() const { return m_pXRInputProfile_MicrosoftXBox; }
+		XRInputProfile *MicrosoftXBox() { return InputProfile( XRInputProfile_MicrosoftXBox::Descriptor ); }
 
 		/// Input Profile object: Oculus Go
-		XRInputProfile_OculusGo *OculusGo() const { return m_pXRInputProfile_OculusGo; }
+		XRInputProfile *OculusGo() { return InputProfile( XRInputProfile_OculusGo::Descriptor ); }
 
 		/// Input Profile object: Oculus Touch
-		XRInputProfile_OculusTouch *OculusTouch() const { return m_pXRInputProfile_OculusTouch; }
+		XRInputProfile *OculusTouch() { return InputProfile( XRInputProfile_OculusTouch::Descriptor ); }
 
 		/// Input Profile object: Valve Index
-		XRInputProfile_ValveIndex* ValveIndex() const { return m_pXRInputProfile_ValveIndex; }
+		XRInputProfile *ValveIndex() { return InputProfile( XRInputProfile_ValveIndex::Descriptor ); }
 
 		/// Get the array of action sets
 		std::vector< XrActionSet > ActionSets() const { return m_vActionSets; }
@@ -124,6 +139,12 @@ namespace OpenXRProvider
 		/// @return		XrActionSuggestedBinding	Handle of the created action binding. Zero here means no action binding was created
 		XrActionSuggestedBinding CreateActionBinding( XrAction xrAction, const char *sControllerPath, const char *sComponentPath, std::vector< XrActionSuggestedBinding > *vActionBindings );
 
+		/// Bind an action to a binding from an interaction profile's descriptor table. Declare the binding constexpr to have it validated at compile time
+		/// @param[in]	xrAction					The handle of the action to bind a controller input to
+		/// @param[in]	xrInputBinding				The binding (interaction profile, user path and component)
+		/// @return		XrActionSuggestedBinding	The created action binding, added to the action bindings of the binding's input profile
+		XrActionSuggestedBinding CreateActionBinding( XrAction xrAction, const XRInputBinding &xrInputBinding );
+
 		/// Suggest controller bindings to the runtime
 		/// @param[in]	vActionBindings				Array of action bindings that will hold the new action binding
 		/// @param[in]	sInteractionProfilePath		The path to the interaction profile that we will suggest to the runtime (e.g. /interaction_profiles/valve/index_controller)
@@ -135,6 +156,24 @@ namespace OpenXRProvider
 		/// @param[in]	xrFilter		Optional filter to use. If specified, make sure actions belonging to this action set have activated the filter as well (e.g. /user/hand/left, etc)
 		void ActivateActionSet( XrActionSet xrActionSet, XrPath xrFilter = XR_NULL_PATH );
 
+		/// Create and activate every action set, action and suggested binding of an action manifest in one pass, ending with a single
+		/// attach of the action sets to the session. Call instead of (not in addition to) creating actions and bindings by hand
+		/// @param[in]	sManifestFile	Absolute path and filename of the text manifest (see XRActionManifest for the format)
+		/// @param[in]	sCacheFile		(optional) Absolute path and filename of the compiled manifest, used instead of the text
+		///								manifest if it is unchanged and (re)written otherwise
+		/// @return		XrResult		Result of the first call that failed, or XR_ERROR_VALIDATION_FAILURE if the manifest is invalid
+		XrResult LoadActionManifest( const char *sManifestFile, const char *sCacheFile = nullptr );
+
+		/// Get an action set created from an action manifest
+		/// @param[in]	sName			Name of the action set in the manifest
+		/// @return		XrActionSet		The action set or XR_NULL_HANDLE
+		XrActionSet GetManifestActionSet( const char *sName ) const;
+
+		/// Get an action created from an action manifest
+		/// @param[in]	sName			Name of the action in the manifest
+		/// @return		XrAction		The action or XR_NULL_HANDLE
+		XrAction GetManifestAction( const char *sName ) const;
+
 		/// Sync active action set data this frame. This must be called only during XR_SESSION_STATE_FOCUSED
 		/// @param[in]	vActionSets	array of active action sets to sync in this frame
 		/// @return		XrResult	Result of syncing the selected active action sets
@@ -146,6 +185,46 @@ namespace OpenXRProvider
 		/// @return		XrResult			Result of trying to get the pose from the pose action
 		XrResult GetActionPose( XrAction xrAction, XrTime xrTime, XrSpaceLocation *xrLocation );
 
+		/// Get the slot of a pose action's space in the core's space registry, to read its pose from the registry's batched locations
+		/// @param[in]	xrAction			The handle to the pose action
+		/// @param[out]	nSlot				Slot of the action space in the space registry
+		/// @return		If the action has an action space
+		bool GetActionSpaceSlot( XrAction xrAction, uint32_t &nSlot ) const
+		{
+			std::map< XrAction, uint32_t >::const_iterator const iter = m_mapActionSpaceSlot.find( xrAction );
+			if ( iter == m_mapActionSpaceSlot.end() )
+				return false;
+
+			nSlot = iter->second;
+			return true;
+		}
+
+		/// Get the compact handle of an input action, to index the action state snapshot with. Look these up once after creating the actions
+		/// @param[in]	xrAction			The handle of the action
+		/// @param[in]	xrSubactionPath		(optional) One of the action's filters (e.g. /user/hand/left) or XR_NULL_PATH for the combined state
+		/// @return		Index of the action's state in the snapshot or k_nInvalidActionHandle
+		uint32_t GetActionHandle( XrAction xrAction, XrPath xrSubactionPath = XR_NULL_PATH ) const;
+
+		/// Get the states of all input actions from the last call to SyncActiveActionSetsData(). Reading it makes no runtime calls
+		/// @return		The action state snapshot, indexed by action handle
+		const XRActionStateSnapshot &GetActionStateSnapshot() const { return m_xrActionStateSnapshot; }
+
+		/// Enable or disable input events. When enabled, every sync diffs the action states against the previous sync and queues an event
+		/// for each press, release, analog move and pose tracking change. Set before syncing starts
+		/// @param[in]	bEnabled			If input events should be generated
+		/// @param[in]	fAnalogThreshold	(optional) How far a float or vector2f action must move from its last event to queue a new one
+		void SetInputEventsEnabled( bool bEnabled, float fAnalogThreshold = 0.05f );
+
+		/// Take the oldest input event out of the queue. The queue is lock-free with a single consumer, so only one thread
+		/// (which can be different from the one syncing) may pop events
+		/// @param[out]	xrInputEvent	The oldest event
+		/// @return		If there was an event
+		bool PopInputEvent( XRInputEvent &xrInputEvent ) { return m_InputEvents.Pop( xrInputEvent ); }
+
+		/// Getter for the number of input events dropped because the queue was full
+		/// @return		Number of dropped events since input events were enabled
+		uint32_t GetDroppedInputEventCount() const { return m_nDroppedInputEvents.load( std::memory_order_relaxed ); }
+
 		/// Get the action state (boolean) from last call the SyncActiveActionSetsData()
 		/// @param[in]	xrActionState	The action state to update
 		/// @return		XrResult		Result of retrieving the action state
@@ -171,6 +250,10 @@ namespace OpenXRProvider
 		/// @return		const char*	The currently active interaction profile
 		const char* GetCurrentInteractionProfile( const char* sUserPath );
 
+		/// Getter for the intern table of path strings and XrPaths used by the input manager
+		/// @return		The path table
+		XRPathTable *GetPathTable() const { return m_pXRPathTable; }
+
 		/// Generate haptic feedback
 		/// @param[in]  xrAction		Haptics action
 		/// @param[in]	nDuration		Duration in nanoseconds
@@ -188,8 +271,44 @@ namespace OpenXRProvider
 	  private:
 		// ** FUNCTIONS (PRIVATE) **/
 
-		/// Generate all supported input profile objects
-		void GenerateInputProfiles();
+		/// Intern the paths of all supported interaction profiles and top level user paths so profile lookups need no runtime calls
+		void InternInputProfilePaths();
+
+		/// Record the age of an input change at the last sync in the clock's latency probes
+		/// @param[in]	bChangedSinceLastSync	If the action state changed since the previous sync
+		/// @param[in]	xrLastChangeTime		Time of the last change of the action state
+		void RecordInputAge( XrBool32 bChangedSinceLastSync, XrTime xrLastChangeTime );
+
+		/// Add an input action's states (the combined one and one for each filter) to the action state snapshot
+		/// @param[in]	xrActionSet		The action set the action belongs to
+		/// @param[in]	xrAction		The action
+		/// @param[in]	xrActionType	The input type of the action
+		/// @param[in]	nFilterCount	Number of filters
+		/// @param[in]	xrFilters		The action's filters (subaction paths)
+		void RegisterAction( XrActionSet xrActionSet, XrAction xrAction, XrActionType xrActionType, uint32_t nFilterCount, XrPath *xrFilters );
+
+		/// Retrieve the state of every registered action of an active action set into the action state snapshot
+		void UpdateActionStateSnapshot();
+
+		/// Queue the input events of an action handle whose state was just updated
+		/// @param[in]	nHandle		The action handle
+		/// @param[in]	bWasActive	If the action was active at the previous sync
+		void QueueInputEvents( uint32_t nHandle, XrBool32 bWasActive );
+
+		/// Attach all created action sets to the current session
+		/// @return		Result of xrAttachSessionActionSets
+		XrResult AttachActionSets();
+
+		/// Create the action space of a pose action on the current session
+		/// @param[in]	xrActionSpaceCreateInfo		Create info of the action space
+		/// @return		Result of xrCreateActionSpace
+		XrResult CreateActionSpace( const XrActionSpaceCreateInfo &xrActionSpaceCreateInfo );
+
+		/// Session callback registered with XRCore. Destroys the action spaces before the session is destroyed, then reattaches the
+		/// action sets and recreates the action spaces on the new session. Action sets, actions and suggested bindings are kept
+		/// @param[in]	eSessionEvent	If the session is about to be destroyed or has just been created
+		/// @param[in]	pUserContext	The input manager
+		static void Callback_XRSession( EXRSessionEvent eSessionEvent, void *pUserContext );
 
 		// ** MEMBER VARIABLES (PRIVATE) **/
 
@@ -214,20 +333,72 @@ namespace OpenXRProvider
 		/// Action space map
 		std::map< XrAction, XrSpace > m_mapActionSpace;
 
+		/// Slot of each action space in the core's space registry
+		std::map< XrAction, uint32_t > m_mapActionSpaceSlot;
+
+		/// Create info of each action space, to recreate them on a new session
+		std::map< XrAction, XrActionSpaceCreateInfo > m_mapActionSpaceCreateInfo;
+
+		/// If the action sets have been attached to the session
+		bool m_bActionSetsAttached = false;
+
+		/// Time of the last xrSyncActions call in the runtime's clock (0 if the clock isn't calibrated yet)
+		XrTime m_xrLastSyncTime = 0;
+
+		/// Prebuilt state get info of each action handle (action and subaction path)
+		std::vector< XrActionStateGetInfo > m_vActionHandleGetInfos;
+
+		/// Input type of each action handle
+		std::vector< XrActionType > m_vActionHandleTypes;
+
+		/// Action set of each action handle
+		std::vector< XrActionSet > m_vActionHandleSets;
+
+		/// If each action handle's action set is active (only active ones are retrieved on sync)
+		std::vector< uint8_t > m_vActionHandleActive;
+
+		/// States of all registered input actions from the last sync
+		XRActionStateSnapshot m_xrActionStateSnapshot;
+
+		/// If input events are generated on sync
+		bool m_bInputEventsEnabled = false;
+
+		/// How far a float or vector2f action must move from its last event to queue a new one
+		float m_fInputEventThreshold = 0.05f;
+
+		/// Value of each action handle at its last event (x is 1 for a pressed boolean action), so deactivated actions can be released
+		std::vector< XrVector2f > m_vActionHandleEventValues;
+
+		/// Input events waiting for the consumer (produced by the syncing thread)
+		XRRingBuffer< XRInputEvent, k_nInputEventRingSize > m_InputEvents;
+
+		/// Number of input events dropped because the queue was full
+		std::atomic< uint32_t > m_nDroppedInputEvents { 0 };
+
+		/// Intern table of path strings and XrPaths
+		XRPathTable *m_pXRPathTable = nullptr;
+
+		/// Descriptors of the supported interaction profiles, keyed by their path
+		std::unordered_map< XrPath, const XRInputProfileDesc * > m_mapInputProfileByPath;
+
+		/// Action sets created from action manifests, keyed by name
+		std::map< std::string, XrActionSet > m_mapManifestActionSets;
+
+		/// Actions created from action manifests, keyed by name
+		std::map< std::string, XrAction > m_mapManifestActions;
+
+		/// Input profile objects created so far, keyed by their descriptor
+		std::unordered_map< const XRInputProfileDesc *, XRInputProfile * > m_mapInputProfiles;
+
 		/// Pointer to the logger
 		std::shared_ptr< spdlog::logger > m_pXRLogger;
 
+		/// Pointer to the deferred log (per-frame messages)
+		XRDeferredLog *m_pXRDeferredLog = nullptr;
+
+		/// Function pointers of the active OpenXR instance
+		const XRDispatchTable *m_pXRDispatchTable = nullptr;
 
-		// ** INPUT PROFILES ** //
-		XRInputProfile_GoogleDaydream *m_pXRInputProfile_GoogleDaydream = nullptr;
-		XRInputProfile_HTCVive *m_pXRInputProfile_HTCVive = nullptr;
-		XRInputProfile_HTCVivePro *m_pXRInputProfile_HTCVivePro = nullptr;
-		XRInputProfile_KhronosSimple *m_pXRInputProfile_KhronosSimple = nullptr;
-		XRInputProfile_MicrosoftMR *m_pXRInputProfile_MicrosoftMR = nullptr;
-		XRInputProfile_MicrosoftXBox *m_pXRInputProfile_MicrosoftXBox = nullptr;
-		XRInputProfile_OculusGo *m_pXRInputProfile_OculusGo = nullptr;
-		XRInputProfile_OculusTouch *m_pXRInputProfile_OculusTouch = nullptr;
-		XRInputProfile_ValveIndex* m_pXRInputProfile_ValveIndex = nullptr;
 
 		/// Get the currently active interaction profile
 		/// @param[in]	sPath	The string path to get the OpenXR Path
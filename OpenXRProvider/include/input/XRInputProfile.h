@@ -21,20 +21,38 @@
  *
  */
 
+
 #pragma once
 
-#include <input/XRInputProfile_GoogleDaydream.h>
+#include <XRCommon.h>
+#include <XRBaseInput.h>
+#include <input/XRInputProfileTable.h>
 
 namespace OpenXRProvider
 {
-	XRInputProfile_GoogleDaydream::XRInputProfile_GoogleDaydream( std::shared_ptr< spdlog::logger > pLogger )
-		: XRBaseInput( pLogger )
+	/// An interaction profile the app suggests bindings for. All profiles share this class, they only differ in their descriptor
+	class XRInputProfile : public XRBaseInput
 	{
-	}
+	  public:
+		// ** FUNCTIONS (PUBLIC) **/
 
-	XRInputProfile_GoogleDaydream::~XRInputProfile_GoogleDaydream()
-	{
+		/// Class Constructor
+		/// @param[in] xrDescriptor		Descriptor of the interaction profile (static storage)
+		/// @param[in] pLogger			The logger object to use
+		XRInputProfile( const XRInputProfileDesc &xrDescriptor, std::shared_ptr< spdlog::logger > pLogger )
+			: XRBaseInput( pLogger )
+			, m_pDescriptor( &xrDescriptor )
+		{
+		}
+
+		/// Return the input profile path for this controller
+		const char *GetInputProfile() const override { return m_pDescriptor->Path; }
 
-	}
+		/// Getter for the descriptor of this profile
+		const XRInputProfileDesc &GetDescriptor() const { return *m_pDescriptor; }
 
+	  private:
+		/// Descriptor of the interaction profile
+		const XRInputProfileDesc *m_pDescriptor = nullptr;
+	};
 } // namespace OpenXRProvider
@@ -0,0 +1,295 @@
+/* Copyright 2021 Rune Berg (GitHub: https://github.com/1runeberg, Twitter: https://twitter.com/1runeberg)
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *  BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ *  GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+ *  DAMAGE.
+ *
+ */
+
+
+#pragma once
+
+#include <XRCommon.h>
+
+#include <stdexcept>
+
+namespace OpenXRProvider
+{
+	/// Native type of an interaction profile component
+	enum EXRInputComponentType : uint8_t
+	{
+		COMPONENT_BOOLEAN = 0,
+		COMPONENT_FLOAT = 1,
+		COMPONENT_VECTOR2F = 2,
+		COMPONENT_POSE = 3,
+		COMPONENT_HAPTIC = 4
+	};
+
+	/// Top level user paths, as flags of the user paths a component is valid for
+	enum EXRInputUserPath : uint8_t
+	{
+		USER_PATH_HAND_LEFT = 1 << 0,
+		USER_PATH_HAND_RIGHT = 1 << 1,
+		USER_PATH_HANDS = USER_PATH_HAND_LEFT | USER_PATH_HAND_RIGHT,
+		USER_PATH_HEAD = 1 << 2,
+		USER_PATH_GAMEPAD = 1 << 3
+	};
+
+	/// Hash a path string at compile time, matching XRPathTable::Hash (FNV-1a)
+	/// @param[in]	sPath		The path
+	/// @param[in]	nHash		(optional) Hash to continue from (e.g. the hash of a user path to append a component to)
+	/// @return		The hash
+	constexpr uint64_t XRPathHash( const char *sPath, uint64_t nHash = 14695981039346656037ULL )
+	{
+		for ( ; *sPath; sPath++ )
+		{
+			nHash ^= ( uint8_t )*sPath;
+			nHash *= 1099511628211ULL;
+		}
+
+		return nHash;
+	}
+
+	/// Compare two strings at compile time
+	constexpr bool XRPathEquals( const char *sA, const char *sB )
+	{
+		for ( ; *sA && *sA == *sB; sA++, sB++ ) {}
+
+		return *sA == *sB;
+	}
+
+	/// Check at compile time if a string ends with a suffix
+	constexpr bool XRPathEndsWith( const char *sPath, const char *sSuffix )
+	{
+		size_t nPath = 0, nSuffix = 0;
+		while ( sPath[ nPath ] ) nPath++;
+		while ( sSuffix[ nSuffix ] ) nSuffix++;
+
+		return nPath >= nSuffix && XRPathEquals( sPath + nPath - nSuffix, sSuffix );
+	}
+
+	/// Check at compile time if a string starts with a prefix
+	constexpr bool XRPathStartsWith( const char *sPath, const char *sPrefix )
+	{
+		for ( ; *sPrefix; sPath++, sPrefix++ )
+		{
+			if ( *sPath != *sPrefix )
+				return false;
+		}
+
+		return true;
+	}
+
+	/// Check at compile time if a string is a well formed OpenXR path (leading slash, lower case ascii letters, numbers, dash,
+	/// underscore and period, no empty or trailing path components)
+	constexpr bool XRPathIsWellFormed( const char *sPath )
+	{
+		if ( !sPath || sPath[ 0 ] != '/' )
+			return false;
+
+		for ( size_t i = 0; sPath[ i ]; i++ )
+		{
+			char c = sPath[ i ];
+			bool bIsValidChar = ( c >= 'a' && c <= 'z' ) || ( c >= '0' && c <= '9' ) || c == '-' || c == '_' || c == '.' || c == '/';
+
+			if ( !bIsValidChar || ( c == '/' && ( sPath[ i + 1 ] == '/' || sPath[ i + 1 ] == 0 ) ) )
+				return false;
+		}
+
+		return true;
+	}
+
+	/// Check at compile time if a string is a well formed OpenXR action or action set name (not empty, lower case ascii letters,
+	/// numbers, dash, underscore and period) that fits a name buffer of the given size including its null terminator
+	constexpr bool XRNameIsWellFormed( const char *sName, size_t nMaxSize )
+	{
+		if ( !sName || sName[ 0 ] == 0 )
+			return false;
+
+		for ( size_t i = 0; sName[ i ]; i++ )
+		{
+			char c = sName[ i ];
+			bool bIsValidChar = ( c >= 'a' && c <= 'z' ) || ( c >= '0' && c <= '9' ) || c == '-' || c == '_' || c == '.';
+
+			if ( !bIsValidChar || i + 1 >= nMaxSize )
+				return false;
+		}
+
+		return true;
+	}
+
+	/// Get the string of a single top level user path
+	constexpr const char *XRUserPathString( EXRInputUserPath eUserPath )
+	{
+		return eUserPath == USER_PATH_HAND_LEFT ? "/user/hand/left"
+			: eUserPath == USER_PATH_HAND_RIGHT ? "/user/hand/right"
+			: eUserPath == USER_PATH_HEAD ? "/user/head"
+			: eUserPath == USER_PATH_GAMEPAD ? "/user/gamepad"
+			: "";
+	}
+
+	/// A component (input or output) of an interaction profile, relative to a top level user path (e.g. /input/trigger/value)
+	struct XRInputComponent
+	{
+		/// Path of the component
+		const char *Path;
+
+		/// Native type of the component
+		EXRInputComponentType Type;
+
+		/// Flags of the user paths the component is valid for (EXRInputUserPath)
+		uint8_t UserPaths;
+
+		/// Hash of the path
+		uint64_t Hash;
+
+		constexpr XRInputComponent( const char *sPath, EXRInputComponentType eType, uint8_t nUserPaths )
+			: Path( sPath )
+			, Type( eType )
+			, UserPaths( nUserPaths )
+			, Hash( XRPathHash( sPath ) )
+		{
+		}
+
+		/// Check if the type matches the path's last component (e.g. /click is boolean, /x is float, a thumbstick parent is vector2f)
+		constexpr bool IsTypeValid() const
+		{
+			if ( XRPathStartsWith( Path, "/output/" ) )
+				return Type == COMPONENT_HAPTIC;
+
+			if ( XRPathEndsWith( Path, "/click" ) || XRPathEndsWith( Path, "/touch" ) )
+				return Type == COMPONENT_BOOLEAN;
+
+			if ( XRPathEndsWith( Path, "/value" ) || XRPathEndsWith( Path, "/force" ) || XRPathEndsWith( Path, "/x" ) || XRPathEndsWith( Path, "/y" ) )
+				return Type == COMPONENT_FLOAT;
+
+			if ( XRPathEndsWith( Path, "/pose" ) )
+				return Type == COMPONENT_POSE;
+
+			return Type == COMPONENT_VECTOR2F;
+		}
+	};
+
+	/// Descriptor of an interaction profile: its path, user paths and components. New profiles only need a new descriptor
+	struct XRInputProfileDesc
+	{
+		/// Path of the interaction profile
+		const char *Path;
+
+		/// Flags of the top level user paths the profile is for (EXRInputUserPath)
+		uint8_t UserPaths;
+
+		/// Components of the profile
+		const XRInputComponent *Components;
+
+		/// Number of components
+		uint32_t ComponentCount;
+
+		/// Hash of the path
+		uint64_t Hash;
+
+		template< uint32_t N >
+		constexpr XRInputProfileDesc( const char *sPath, uint8_t nUserPaths, const XRInputComponent ( &xrComponents )[ N ] )
+			: Path( sPath )
+			, UserPaths( nUserPaths )
+			, Components( xrComponents )
+			, ComponentCount( N )
+			, Hash( XRPathHash( sPath ) )
+		{
+		}
+
+		/// Find a component by path, a walk over the component hashes
+		/// @param[in]	sComponentPath	Path of the component relative to its user path (e.g. /input/trigger/value)
+		/// @return		The component or null if the profile doesn't have it
+		constexpr const XRInputComponent *FindComponent( const char *sComponentPath ) const
+		{
+			uint64_t nHash = XRPathHash( sComponentPath );
+			for ( uint32_t i = 0; i < ComponentCount; i++ )
+			{
+				if ( Components[ i ].Hash == nHash && XRPathEquals( Components[ i ].Path, sComponentPath ) )
+					return &Components[ i ];
+			}
+
+			return nullptr;
+		}
+
+		/// Check if a component can be bound on a user path of this profile
+		/// @param[in]	eUserPath		The (single) user path
+		/// @param[in]	sComponentPath	Path of the component relative to the user path
+		/// @return		If the binding is valid
+		constexpr bool IsBindingValid( EXRInputUserPath eUserPath, const char *sComponentPath ) const
+		{
+			const XRInputComponent *pComponent = FindComponent( sComponentPath );
+			return pComponent && ( pComponent->UserPaths & eUserPath ) == eUserPath && ( UserPaths & eUserPath ) == eUserPath;
+		}
+
+		/// Check that the profile and its components are well formed, have types matching their paths, are only valid for
+		/// the profile's user paths and aren't listed twice. Each descriptor is checked with a static_assert
+		constexpr bool IsValid() const
+		{
+			if ( !XRPathStartsWith( Path, "/interaction_profiles/" ) || !XRPathIsWellFormed( Path ) || UserPaths == 0 )
+				return false;
+
+			for ( uint32_t i = 0; i < ComponentCount; i++ )
+			{
+				const XRInputComponent &xrComponent = Components[ i ];
+
+				if ( !XRPathIsWellFormed( xrComponent.Path ) || !xrComponent.IsTypeValid() )
+					return false;
+
+				if ( xrComponent.UserPaths == 0 || ( xrComponent.UserPaths & ~UserPaths ) != 0 )
+					return false;
+
+				for ( uint32_t j = 0; j < i; j++ )
+				{
+					if ( Components[ j ].Hash == xrComponent.Hash )
+						return false;
+				}
+			}
+
+			return true;
+		}
+	};
+
+	/// A binding of a profile's component on a user path, validated at compile time when declared constexpr:
+	///		constexpr XRInputBinding k_xrBinding( XRInputProfile_ValveIndex::Descriptor, USER_PATH_HAND_LEFT, XRInputProfile_ValveIndex::Pose_Grip );
+	/// fails to compile if the profile has no such component for the user path
+	struct XRInputBinding
+	{
+		/// The interaction profile
+		const XRInputProfileDesc *Profile;
+
+		/// The component
+		const XRInputComponent *Component;
+
+		/// The top level user path
+		const char *UserPath;
+
+		/// Hash of the full binding path (user path followed by the component path)
+		uint64_t Hash;
+
+		constexpr XRInputBinding( const XRInputProfileDesc &xrProfile, EXRInputUserPath eUserPath, const char *sComponentPath )
+			: Profile( &xrProfile )
+			, Component( xrProfile.IsBindingValid( eUserPath, sComponentPath ) ? xrProfile.FindComponent( sComponentPath )
+																				 : throw std::invalid_argument( "Component not valid for this interaction profile and user path" ) )
+			, UserPath( XRUserPathString( eUserPath ) )
+			, Hash( XRPathHash( sComponentPath, XRPathHash( XRUserPathString( eUserPath ) ) ) )
+		{
+		}
+	};
+} // namespace OpenXRProvider
@@ -21,40 +21,48 @@
  *
  */
 
+
 #pragma once
 
-#include <XRCommon.h>
-#include <XRBaseInput.h>
+#include <input/XRInputProfileTable.h>
 
 namespace OpenXRProvider
 {
-	class XRInputProfile_GoogleDaydream : public XRBaseInput
+	/// Interaction profile: Google Daydream
+	class XRInputProfile_GoogleDaydream
 	{
 	  public:
 		// ** STATIC PROPERTIES **/
-		inline static const char *Hand_Left = "/user/hand/left";
-		inline static const char *Hand_Right = "/user/hand/right";
-
-		inline static const char *Button_Select_Click = "/input/select/click";
+		static constexpr const char *Hand_Left = "/user/hand/left";
+		static constexpr const char *Hand_Right = "/user/hand/right";
 
-		inline static const char *Trackpad_Touch = "/input/trackpad/touch";
-		inline static const char *Trackpad_Click = "/input/trackpad/click";
-		inline static const char *Trackpad_X = "/input/trackpad/x";
-		inline static const char *Trackpad_Y = "/input/trackpad/y";
+		static constexpr const char *Button_Select_Click = "/input/select/click";
 
-		inline static const char *Pose_Grip = "/input/grip/pose";
-		inline static const char *Pose_Aim = "/input/aim/pose";
+		static constexpr const char *Trackpad_Touch = "/input/trackpad/touch";
+		static constexpr const char *Trackpad_Click = "/input/trackpad/click";
+		static constexpr const char *Trackpad_X = "/input/trackpad/x";
+		static constexpr const char *Trackpad_Y = "/input/trackpad/y";
 
-		// ** FUNCTIONS (PUBLIC) **/
+		static constexpr const char *Pose_Grip = "/input/grip/pose";
+		static constexpr const char *Pose_Aim = "/input/aim/pose";
 
-		/// Class Constructor
-		XRInputProfile_GoogleDaydream( std::shared_ptr< spdlog::logger > pLogger );
+		// ** DESCRIPTOR **/
 
-		/// Class Destructor
-		~XRInputProfile_GoogleDaydream();
-
-		/// Return the input profile path for this controller
-		const char *GetInputProfile() const override { return "/interaction_profiles/google/daydream_controller"; }
+		/// Components of the profile with their types and the user paths they are valid for
+		static constexpr XRInputComponent Components[] =
+		{
+			{ Button_Select_Click, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Trackpad_Touch, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Trackpad_Click, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Trackpad_X, COMPONENT_FLOAT, USER_PATH_HANDS },
+			{ Trackpad_Y, COMPONENT_FLOAT, USER_PATH_HANDS },
+			{ Pose_Grip, COMPONENT_POSE, USER_PATH_HANDS },
+			{ Pose_Aim, COMPONENT_POSE, USER_PATH_HANDS },
+		};
 
+		/// Descriptor of the profile
+		static constexpr XRInputProfileDesc Descriptor { "/interaction_profiles/google/daydream_controller", USER_PATH_HANDS, Components };
 	};
+
+	static_assert( XRInputProfile_GoogleDaydream::Descriptor.IsValid(), "Invalid Google Daydream interaction profile descriptor" );
 } // namespace OpenXRProvider
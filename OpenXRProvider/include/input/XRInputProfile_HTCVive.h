@@ -21,46 +21,58 @@
  *
  */
 
+
 #pragma once
 
-#include <XRCommon.h>
-#include <XRBaseInput.h>
+#include <input/XRInputProfileTable.h>
 
 namespace OpenXRProvider
 {
-	class XRInputProfile_HTCVive : public XRBaseInput
+	/// Interaction profile: HTC Vive
+	class XRInputProfile_HTCVive
 	{
 	  public:
 		// ** STATIC PROPERTIES **/
-		inline static const char *Hand_Left = "/user/hand/left";
-		inline static const char *Hand_Right = "/user/hand/right";
-
-		inline static const char *Button_System_Click = "/input/system/click";
+		static constexpr const char *Hand_Left = "/user/hand/left";
+		static constexpr const char *Hand_Right = "/user/hand/right";
 
-		inline static const char *Button_Trigger_Click = "/input/trigger/click";
-		inline static const char *Button_Trigger_Value = "/input/trigger/value";
+		static constexpr const char *Button_System_Click = "/input/system/click";
 
-		inline static const char *Button_Squeeze_Click = "/input/squeeze/click";
+		static constexpr const char *Button_Trigger_Click = "/input/trigger/click";
+		static constexpr const char *Button_Trigger_Value = "/input/trigger/value";
 
-		inline static const char *Trackpad_Touch = "/input/trackpad/touch";
-		inline static const char *Trackpad_Click = "/input/trackpad/click";
-		inline static const char *Trackpad_X = "/input/trackpad/x";
-		inline static const char *Trackpad_Y = "/input/trackpad/y";
+		static constexpr const char *Button_Squeeze_Click = "/input/squeeze/click";
 
-		inline static const char *Pose_Grip = "/input/grip/pose";
-		inline static const char *Pose_Aim = "/input/aim/pose";
-		inline static const char *Output_Haptic = "/output/haptic";
+		static constexpr const char *Trackpad_Touch = "/input/trackpad/touch";
+		static constexpr const char *Trackpad_Click = "/input/trackpad/click";
+		static constexpr const char *Trackpad_X = "/input/trackpad/x";
+		static constexpr const char *Trackpad_Y = "/input/trackpad/y";
 
-		// ** FUNCTIONS (PUBLIC) **/
+		static constexpr const char *Pose_Grip = "/input/grip/pose";
+		static constexpr const char *Pose_Aim = "/input/aim/pose";
+		static constexpr const char *Output_Haptic = "/output/haptic";
 
-		/// Class Constructor
-		XRInputProfile_HTCVive( std::shared_ptr< spdlog::logger > pLogger );
+		// ** DESCRIPTOR **/
 
-		/// Class Destructor
-		~XRInputProfile_HTCVive();
-
-		/// Return the input profile path for this controller
-		const char *GetInputProfile() const override { return "/interaction_profiles/htc/vive_controller"; }
+		/// Components of the profile with their types and the user paths they are valid for
+		static constexpr XRInputComponent Components[] =
+		{
+			{ Button_System_Click, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Button_Trigger_Click, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Button_Trigger_Value, COMPONENT_FLOAT, USER_PATH_HANDS },
+			{ Button_Squeeze_Click, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Trackpad_Touch, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Trackpad_Click, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Trackpad_X, COMPONENT_FLOAT, USER_PATH_HANDS },
+			{ Trackpad_Y, COMPONENT_FLOAT, USER_PATH_HANDS },
+			{ Pose_Grip, COMPONENT_POSE, USER_PATH_HANDS },
+			{ Pose_Aim, COMPONENT_POSE, USER_PATH_HANDS },
+			{ Output_Haptic, COMPONENT_HAPTIC, USER_PATH_HANDS },
+		};
 
+		/// Descriptor of the profile
+		static constexpr XRInputProfileDesc Descriptor { "/interaction_profiles/htc/vive_controller", USER_PATH_HANDS, Components };
 	};
+
+	static_assert( XRInputProfile_HTCVive::Descriptor.IsValid(), "Invalid HTC Vive interaction profile descriptor" );
 } // namespace OpenXRProvider
@@ -21,34 +21,39 @@
  *
  */
 
+
 #pragma once
 
-#include <XRCommon.h>
-#include <XRBaseInput.h>
+#include <input/XRInputProfileTable.h>
 
 namespace OpenXRProvider
 {
-	class XRInputProfile_HTCVivePro : public XRBaseInput
+	/// Interaction profile: HTC Vive Pro
+	class XRInputProfile_HTCVivePro
 	{
 	  public:
 		// ** STATIC PROPERTIES **/
-		inline static const char *Head = "/user/head";
-
-		inline static const char *Button_System_Click = "/input/system/click";
-		inline static const char *Button_VolumeUp_Click = "/input/volume_up/click";
-		inline static const char *Button_VolumeDown_Click = "/input/volume_down/click";
-		inline static const char *Button_MuteMic_Click = "/input/mute_mic/click";
-
-		// ** FUNCTIONS (PUBLIC) **/
-
-		/// Class Constructor
-		XRInputProfile_HTCVivePro( std::shared_ptr< spdlog::logger > pLogger );
-
-		/// Class Destructor
-		~XRInputProfile_HTCVivePro();
-
-		/// Return the input profile path for this controller
-		const char *GetInputProfile() const override { return "/interaction_profiles/htc/vive_pro"; }
-
+		static constexpr const char *Head = "/user/head";
+
+		static constexpr const char *Button_System_Click = "/input/system/click";
+		static constexpr const char *Button_VolumeUp_Click = "/input/volume_up/click";
+		static constexpr const char *Button_VolumeDown_Click = "/input/volume_down/click";
+		static constexpr const char *Button_MuteMic_Click = "/input/mute_mic/click";
+
+		// ** DESCRIPTOR **/
+
+		/// Components of the profile with their types and the user paths they are valid for
+		static constexpr XRInputComponent Components[] =
+		{
+			{ Button_System_Click, COMPONENT_BOOLEAN, USER_PATH_HEAD },
+			{ Button_VolumeUp_Click, COMPONENT_BOOLEAN, USER_PATH_HEAD },
+			{ Button_VolumeDown_Click, COMPONENT_BOOLEAN, USER_PATH_HEAD },
+			{ Button_MuteMic_Click, COMPONENT_BOOLEAN, USER_PATH_HEAD },
+		};
+
+		/// Descriptor of the profile
+		static constexpr XRInputProfileDesc Descriptor { "/interaction_profiles/htc/vive_pro", USER_PATH_HEAD, Components };
 	};
+
+	static_assert( XRInputProfile_HTCVivePro::Descriptor.IsValid(), "Invalid HTC Vive Pro interaction profile descriptor" );
 } // namespace OpenXRProvider
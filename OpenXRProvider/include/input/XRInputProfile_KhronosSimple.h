@@ -21,37 +21,43 @@
  *
  */
 
+
 #pragma once
 
-#include <XRCommon.h>
-#include <XRBaseInput.h>
+#include <input/XRInputProfileTable.h>
 
 namespace OpenXRProvider
 {
-	class XRInputProfile_KhronosSimple : public XRBaseInput
+	/// Interaction profile: Khronos Simple
+	class XRInputProfile_KhronosSimple
 	{
 	  public:
-		// * STATIC PROPERTIES */
-		inline static const char *Hand_Left = "/user/hand/left";
-		inline static const char *Hand_Right = "/user/hand/right";
-
-		inline static const char *Button_Select_Click = "/input/select/click";
-		inline static const char *Button_Menu_Click = "/input/menu/click";
-
-		inline static const char *Pose_Grip = "/input/grip/pose";
-		inline static const char *Pose_Aim = "/input/aim/pose";
-		inline static const char *Output_Haptic = "/output/haptic";
-
-		// ** FUNCTIONS (PUBLIC) **/
-
-		/// Class Constructor
-		XRInputProfile_KhronosSimple( std::shared_ptr< spdlog::logger > pLogger );
-
-		/// Class Destructor
-		~XRInputProfile_KhronosSimple();
-
-		/// Return the input profile path for this controller
-		const char *GetInputProfile() const override { return "/interaction_profiles/khr/simple_controller"; }
-
+		// ** STATIC PROPERTIES **/
+		static constexpr const char *Hand_Left = "/user/hand/left";
+		static constexpr const char *Hand_Right = "/user/hand/right";
+
+		static constexpr const char *Button_Select_Click = "/input/select/click";
+		static constexpr const char *Button_Menu_Click = "/input/menu/click";
+
+		static constexpr const char *Pose_Grip = "/input/grip/pose";
+		static constexpr const char *Pose_Aim = "/input/aim/pose";
+		static constexpr const char *Output_Haptic = "/output/haptic";
+
+		// ** DESCRIPTOR **/
+
+		/// Components of the profile with their types and the user paths they are valid for
+		static constexpr XRInputComponent Components[] =
+		{
+			{ Button_Select_Click, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Button_Menu_Click, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Pose_Grip, COMPONENT_POSE, USER_PATH_HANDS },
+			{ Pose_Aim, COMPONENT_POSE, USER_PATH_HANDS },
+			{ Output_Haptic, COMPONENT_HAPTIC, USER_PATH_HANDS },
+		};
+
+		/// Descriptor of the profile
+		static constexpr XRInputProfileDesc Descriptor { "/interaction_profiles/khr/simple_controller", USER_PATH_HANDS, Components };
 	};
+
+	static_assert( XRInputProfile_KhronosSimple::Descriptor.IsValid(), "Invalid Khronos Simple interaction profile descriptor" );
 } // namespace OpenXRProvider
@@ -21,60 +21,83 @@
  *
  */
 
+
 #pragma once
 
-#include <XRCommon.h>
-#include <XRBaseInput.h>
+#include <input/XRInputProfileTable.h>
 
 namespace OpenXRProvider
 {
-	class XRInputProfile_MicrosoftXBox : public XRBaseInput
+	/// Interaction profile: Microsoft XBox
+	class XRInputProfile_MicrosoftXBox
 	{
 	  public:
 		// ** STATIC PROPERTIES **/
-		inline static const char *Gamepad = "/user/gamepad";
-
-		inline static const char *Button_A_Click = "/input/a/click";
-		inline static const char *Button_B_Click = "/input/b/click";
-		inline static const char *Button_X_Click = "/input/x/click";
-		inline static const char *Button_Y_Click = "/input/y/click";
-
-		inline static const char *Button_DPad_Up_Click = "/input/dpad_up/click";
-		inline static const char *Button_DPad_Down_Click = "/input/dpad_down/click";
-		inline static const char *Button_DPad_Left_Click = "/input/dpad_left/click";
-		inline static const char *Button_DPad_Right_Click = "/input/dpad_right/click";
-
-		inline static const char *Button_Shoulder_Left_Click = "/input/shoulder_left/click";
-		inline static const char *Button_Shoulder_Right_Click = "/input/shoulder_right/click";
-		
-		inline static const char *Button_Menu_Click = "/input/menu/click";
-		inline static const char *Button_View_Click = "/input/view/click";
-
-		inline static const char *Button_Trigger_Left_Value = "/input/trigger_left/value";
-		inline static const char *Button_Trigger_Right_Value = "/input/trigger_right/value";
-
-		inline static const char *Thumbstick_Left_X = "/input/thumbstick_Left/x";
-		inline static const char *Thumbstick_Left_Y = "/input/thumbstick_Left/y";
-
-		inline static const char *Thumbstick_Right_X = "/input/thumbstick_Right/x";
-		inline static const char *Thumbstick_Right_Y = "/input/thumbstick_Right/y";
-
-		inline static const char *Output_Haptic_Left = "/output/haptic_left";
-		inline static const char *Output_Haptic_Right = "/output/haptic_right";
-
-		inline static const char *Output_Haptic_Left_Trigger = "/output/haptic_left_trigger";
-		inline static const char *Output_Haptic_Right_Trigger = "/output/haptic_right_trigger";
-
-		// ** FUNCTIONS (PUBLIC) **/
-
-		/// Class Constructor
-		XRInputProfile_MicrosoftXBox( std::shared_ptr< spdlog::logger > pLogger );
-
-		/// Class Destructor
-		~XRInputProfile_MicrosoftXBox();
-
-		/// Return the input profile path for this controller
-		const char *GetInputProfile() const override { return "/interaction_profiles/microsoft/xbox_controller"; }
-
+		static constexpr const char *Gamepad = "/user/gamepad";
+
+		static constexpr const char *Button_A_Click = "/input/a/click";
+		static constexpr const char *Button_B_Click = "/input/b/click";
+		static constexpr const char *Button_X_Click = "/input/x/click";
+		static constexpr const char *Button_Y_Click = "/input/y/click";
+
+		static constexpr const char *Button_DPad_Up_Click = "/input/dpad_up/click";
+		static constexpr const char *Button_DPad_Down_Click = "/input/dpad_down/click";
+		static constexpr const char *Button_DPad_Left_Click = "/input/dpad_left/click";
+		static constexpr const char *Button_DPad_Right_Click = "/input/dpad_right/click";
+
+		static constexpr const char *Button_Shoulder_Left_Click = "/input/shoulder_left/click";
+		static constexpr const char *Button_Shoulder_Right_Click = "/input/shoulder_right/click";
+
+		static constexpr const char *Button_Menu_Click = "/input/menu/click";
+		static constexpr const char *Button_View_Click = "/input/view/click";
+
+		static constexpr const char *Button_Trigger_Left_Value = "/input/trigger_left/value";
+		static constexpr const char *Button_Trigger_Right_Value = "/input/trigger_right/value";
+
+		static constexpr const char *Thumbstick_Left_X = "/input/thumbstick_left/x";
+		static constexpr const char *Thumbstick_Left_Y = "/input/thumbstick_left/y";
+
+		static constexpr const char *Thumbstick_Right_X = "/input/thumbstick_right/x";
+		static constexpr const char *Thumbstick_Right_Y = "/input/thumbstick_right/y";
+
+		static constexpr const char *Output_Haptic_Left = "/output/haptic_left";
+		static constexpr const char *Output_Haptic_Right = "/output/haptic_right";
+
+		static constexpr const char *Output_Haptic_Left_Trigger = "/output/haptic_left_trigger";
+		static constexpr const char *Output_Haptic_Right_Trigger = "/output/haptic_right_trigger";
+
+		// ** DESCRIPTOR **/
+
+		/// Components of the profile with their types and the user paths they are valid for
+		static constexpr XRInputComponent Components[] =
+		{
+			{ Button_A_Click, COMPONENT_BOOLEAN, USER_PATH_GAMEPAD },
+			{ Button_B_Click, COMPONENT_BOOLEAN, USER_PATH_GAMEPAD },
+			{ Button_X_Click, COMPONENT_BOOLEAN, USER_PATH_GAMEPAD },
+			{ Button_Y_Click, COMPONENT_BOOLEAN, USER_PATH_GAMEPAD },
+			{ Button_DPad_Up_Click, COMPONENT_BOOLEAN, USER_PATH_GAMEPAD },
+			{ Button_DPad_Down_Click, COMPONENT_BOOLEAN, USER_PATH_GAMEPAD },
+			{ Button_DPad_Left_Click, COMPONENT_BOOLEAN, USER_PATH_GAMEPAD },
+			{ Button_DPad_Right_Click, COMPONENT_BOOLEAN, USER_PATH_GAMEPAD },
+			{ Button_Shoulder_Left_Click, COMPONENT_BOOLEAN, USER_PATH_GAMEPAD },
+			{ Button_Shoulder_Right_Click, COMPONENT_BOOLEAN, USER_PATH_GAMEPAD },
+			{ Button_Menu_Click, COMPONENT_BOOLEAN, USER_PATH_GAMEPAD },
+			{ Button_View_Click, COMPONENT_BOOLEAN, USER_PATH_GAMEPAD },
+			{ Button_Trigger_Left_Value, COMPONENT_FLOAT, USER_PATH_GAMEPAD },
+			{ Button_Trigger_Right_Value, COMPONENT_FLOAT, USER_PATH_GAMEPAD },
+			{ Thumbstick_Left_X, COMPONENT_FLOAT, USER_PATH_GAMEPAD },
+			{ Thumbstick_Left_Y, COMPONENT_FLOAT, USER_PATH_GAMEPAD },
+			{ Thumbstick_Right_X, COMPONENT_FLOAT, USER_PATH_GAMEPAD },
+			{ Thumbstick_Right_Y, COMPONENT_FLOAT, USER_PATH_GAMEPAD },
+			{ Output_Haptic_Left, COMPONENT_HAPTIC, USER_PATH_GAMEPAD },
+			{ Output_Haptic_Right, COMPONENT_HAPTIC, USER_PATH_GAMEPAD },
+			{ Output_Haptic_Left_Trigger, COMPONENT_HAPTIC, USER_PATH_GAMEPAD },
+			{ Output_Haptic_Right_Trigger, COMPONENT_HAPTIC, USER_PATH_GAMEPAD },
+		};
+
+		/// Descriptor of the profile
+		static constexpr XRInputProfileDesc Descriptor { "/interaction_profiles/microsoft/xbox_controller", USER_PATH_GAMEPAD, Components };
 	};
+
+	static_assert( XRInputProfile_MicrosoftXBox::Descriptor.IsValid(), "Invalid Microsoft XBox interaction profile descriptor" );
 } // namespace OpenXRProvider
@@ -21,42 +21,52 @@
  *
  */
 
+
 #pragma once
 
-#include <XRCommon.h>
-#include <XRBaseInput.h>
+#include <input/XRInputProfileTable.h>
 
 namespace OpenXRProvider
 {
-	class XRInputProfile_OculusGo : public XRBaseInput
+	/// Interaction profile: Oculus Go
+	class XRInputProfile_OculusGo
 	{
 	  public:
 		// ** STATIC PROPERTIES **/
-		inline static const char *Hand_Left = "/user/hand/left";
-		inline static const char *Hand_Right = "/user/hand/right";
-
-		inline static const char *Button_System_Click = "/input/system/click";
-		inline static const char *Button_Trigger_Click = "/input/trigger/click";
-		inline static const char *Button_Back_Click = "/input/back/click";
+		static constexpr const char *Hand_Left = "/user/hand/left";
+		static constexpr const char *Hand_Right = "/user/hand/right";
 
-		inline static const char *Trackpad_Touch = "/input/trackpad/touch";
-		inline static const char *Trackpad_Click = "/input/trackpad/click";
-		inline static const char *Trackpad_X = "/input/trackpad/x";
-		inline static const char *Trackpad_Y = "/input/trackpad/y";
+		static constexpr const char *Button_System_Click = "/input/system/click";
+		static constexpr const char *Button_Trigger_Click = "/input/trigger/click";
+		static constexpr const char *Button_Back_Click = "/input/back/click";
 
-		inline static const char *Pose_Grip = "/input/grip/pose";
-		inline static const char *Pose_Aim = "/input/aim/pose";
+		static constexpr const char *Trackpad_Touch = "/input/trackpad/touch";
+		static constexpr const char *Trackpad_Click = "/input/trackpad/click";
+		static constexpr const char *Trackpad_X = "/input/trackpad/x";
+		static constexpr const char *Trackpad_Y = "/input/trackpad/y";
 
-		// ** FUNCTIONS (PUBLIC) **/
+		static constexpr const char *Pose_Grip = "/input/grip/pose";
+		static constexpr const char *Pose_Aim = "/input/aim/pose";
 
-		/// Class Constructor
-		XRInputProfile_OculusGo( std::shared_ptr< spdlog::logger > pLogger );
+		// ** DESCRIPTOR **/
 
-		/// Class Destructor
-		~XRInputProfile_OculusGo();
-
-		/// Return the input profile path for this controller
-		const char *GetInputProfile() const override { return "/interaction_profiles/oculus/go_controller"; }
+		/// Components of the profile with their types and the user paths they are valid for
+		static constexpr XRInputComponent Components[] =
+		{
+			{ Button_System_Click, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Button_Trigger_Click, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Button_Back_Click, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Trackpad_Touch, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Trackpad_Click, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Trackpad_X, COMPONENT_FLOAT, USER_PATH_HANDS },
+			{ Trackpad_Y, COMPONENT_FLOAT, USER_PATH_HANDS },
+			{ Pose_Grip, COMPONENT_POSE, USER_PATH_HANDS },
+			{ Pose_Aim, COMPONENT_POSE, USER_PATH_HANDS },
+		};
 
+		/// Descriptor of the profile
+		static constexpr XRInputProfileDesc Descriptor { "/interaction_profiles/oculus/go_controller", USER_PATH_HANDS, Components };
 	};
+
+	static_assert( XRInputProfile_OculusGo::Descriptor.IsValid(), "Invalid Oculus Go interaction profile descriptor" );
 } // namespace OpenXRProvider
@@ -21,61 +21,83 @@
  *
  */
 
+
 #pragma once
 
-#include <XRCommon.h>
-#include <XRBaseInput.h>
+#include <input/XRInputProfileTable.h>
 
 namespace OpenXRProvider
 {
-	class XRInputProfile_OculusTouch : public XRBaseInput
+	/// Interaction profile: Oculus Touch
+	class XRInputProfile_OculusTouch
 	{
 	  public:
 		// ** STATIC PROPERTIES **/
-		inline static const char *Hand_Left = "/user/hand/left";
-		inline static const char *Hand_Right = "/user/hand/right";
-
-		inline static const char *Left_Button_X_Touch = "/user/hand/left/input/x/touch";
-		inline static const char *Left_Button_X_Click = "/user/hand/left/input/x/click";
-
-		inline static const char *Left_Button_Y_Touch = "/user/hand/left/input/y/touch";
-		inline static const char *Left_Button_Y_Click = "/user/hand/left/input/y/click";
-
-		inline static const char *Right_Button_A_Touch = "/user/hand/right/input/a/touch";
-		inline static const char *Right_Button_A_Click = "/user/hand/right/input/a/click";
-
-		inline static const char *Right_Button_B_Touch = "/user/hand/right/input/b/touch";
-		inline static const char *Right_Button_B_Click = "/user/hand/right/input/b/click";
-
-		inline static const char *Left_Button_Menu_Click = "/user/hand/left/input/menu/click";
-		inline static const char *Right_Button_System_Click = "/user/hand/right/input/system/click";
-
-		inline static const char *Button_Trigger_Touch = "/input/trigger/touch";
-		inline static const char *Button_Trigger_Value = "/input/trigger/value";
-
-		inline static const char *Button_Squeeze_Value = "/input/squeeze/value";
-
-		inline static const char *Thumbstick_Touch = "/input/thumbstick/touch";
-		inline static const char *Thumbstick_Click = "/input/thumbstick/click";
-		inline static const char *Thumbstick_X = "/input/thumbstick/x";
-		inline static const char *Thumbstick_Y = "/input/thumbstick/y";
-
-		inline static const char *Thumbrest_Touch = "/input/thumbrest/touch";
-
-		inline static const char *Pose_Grip = "/input/grip/pose";
-		inline static const char *Pose_Aim = "/input/aim/pose";
-		inline static const char *Output_Haptic = "/output/haptic";
-
-		// ** FUNCTIONS (PUBLIC) **/
-
-		/// Class Constructor
-		XRInputProfile_OculusTouch( std::shared_ptr< spdlog::logger > pLogger );
-
-		/// Class Destructor
-		~XRInputProfile_OculusTouch();
-
-		/// Return the input profile path for this controller
-		const char *GetInputProfile() const override { return "/interaction_profiles/oculus/touch_controller"; }
-
+		static constexpr const char *Hand_Left = "/user/hand/left";
+		static constexpr const char *Hand_Right = "/user/hand/right";
+
+		static constexpr const char *Left_Button_X_Touch = "/user/hand/left/input/x/touch";
+		static constexpr const char *Left_Button_X_Click = "/user/hand/left/input/x/click";
+
+		static constexpr const char *Left_Button_Y_Touch = "/user/hand/left/input/y/touch";
+		static constexpr const char *Left_Button_Y_Click = "/user/hand/left/input/y/click";
+
+		static constexpr const char *Right_Button_A_Touch = "/user/hand/right/input/a/touch";
+		static constexpr const char *Right_Button_A_Click = "/user/hand/right/input/a/click";
+
+		static constexpr const char *Right_Button_B_Touch = "/user/hand/right/input/b/touch";
+		static constexpr const char *Right_Button_B_Click = "/user/hand/right/input/b/click";
+
+		static constexpr const char *Left_Button_Menu_Click = "/user/hand/left/input/menu/click";
+		static constexpr const char *Right_Button_System_Click = "/user/hand/right/input/system/click";
+
+		static constexpr const char *Button_Trigger_Touch = "/input/trigger/touch";
+		static constexpr const char *Button_Trigger_Value = "/input/trigger/value";
+
+		static constexpr const char *Button_Squeeze_Value = "/input/squeeze/value";
+
+		static constexpr const char *Thumbstick_Touch = "/input/thumbstick/touch";
+		static constexpr const char *Thumbstick_Click = "/input/thumbstick/click";
+		static constexpr const char *Thumbstick_X = "/input/thumbstick/x";
+		static constexpr const char *Thumbstick_Y = "/input/thumbstick/y";
+
+		static constexpr const char *Thumbrest_Touch = "/input/thumbrest/touch";
+
+		static constexpr const char *Pose_Grip = "/input/grip/pose";
+		static constexpr const char *Pose_Aim = "/input/aim/pose";
+		static constexpr const char *Output_Haptic = "/output/haptic";
+
+		// ** DESCRIPTOR **/
+
+		/// Components of the profile with their types and the user paths they are valid for
+		static constexpr XRInputComponent Components[] =
+		{
+			{ "/input/x/touch", COMPONENT_BOOLEAN, USER_PATH_HAND_LEFT },
+			{ "/input/x/click", COMPONENT_BOOLEAN, USER_PATH_HAND_LEFT },
+			{ "/input/y/touch", COMPONENT_BOOLEAN, USER_PATH_HAND_LEFT },
+			{ "/input/y/click", COMPONENT_BOOLEAN, USER_PATH_HAND_LEFT },
+			{ "/input/a/touch", COMPONENT_BOOLEAN, USER_PATH_HAND_RIGHT },
+			{ "/input/a/click", COMPONENT_BOOLEAN, USER_PATH_HAND_RIGHT },
+			{ "/input/b/touch", COMPONENT_BOOLEAN, USER_PATH_HAND_RIGHT },
+			{ "/input/b/click", COMPONENT_BOOLEAN, USER_PATH_HAND_RIGHT },
+			{ "/input/menu/click", COMPONENT_BOOLEAN, USER_PATH_HAND_LEFT },
+			{ "/input/system/click", COMPONENT_BOOLEAN, USER_PATH_HAND_RIGHT },
+			{ Button_Trigger_Touch, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Button_Trigger_Value, COMPONENT_FLOAT, USER_PATH_HANDS },
+			{ Button_Squeeze_Value, COMPONENT_FLOAT, USER_PATH_HANDS },
+			{ Thumbstick_Touch, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Thumbstick_Click, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Thumbstick_X, COMPONENT_FLOAT, USER_PATH_HANDS },
+			{ Thumbstick_Y, COMPONENT_FLOAT, USER_PATH_HANDS },
+			{ Thumbrest_Touch, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Pose_Grip, COMPONENT_POSE, USER_PATH_HANDS },
+			{ Pose_Aim, COMPONENT_POSE, USER_PATH_HANDS },
+			{ Output_Haptic, COMPONENT_HAPTIC, USER_PATH_HANDS },
+		};
+
+		/// Descriptor of the profile
+		static constexpr XRInputProfileDesc Descriptor { "/interaction_profiles/oculus/touch_controller", USER_PATH_HANDS, Components };
 	};
+
+	static_assert( XRInputProfile_OculusTouch::Descriptor.IsValid(), "Invalid Oculus Touch interaction profile descriptor" );
 } // namespace OpenXRProvider
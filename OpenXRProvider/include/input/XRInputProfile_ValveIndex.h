@@ -21,60 +21,83 @@
  *
  */
 
+
 #pragma once
 
-#include <XRCommon.h>
-#include <XRBaseInput.h>
+#include <input/XRInputProfileTable.h>
 
 namespace OpenXRProvider
 {
-	class XRInputProfile_ValveIndex : public XRBaseInput
+	/// Interaction profile: Valve Index
+	class XRInputProfile_ValveIndex
 	{
 	  public:
 		// ** STATIC PROPERTIES **/
-		inline static const char *Hand_Left = "/user/hand/left";
-		inline static const char *Hand_Right = "/user/hand/right";
-
-		inline static const char *Button_A_Touch = "/input/a/touch";
-		inline static const char *Button_A_Click = "/input/a/click";
-
-		inline static const char *Button_B_Touch = "/input/b/touch";
-		inline static const char *Button_B_Click = "/input/b/click";
-
-		inline static const char *Button_System_Touch = "/input/system/touch";
-		inline static const char *Button_System_Click = "/input/system/click";
-
-		inline static const char *Button_Trigger_Touch = "/input/trigger/touch";
-		inline static const char *Button_Trigger_Click = "/input/trigger/click";
-		inline static const char *Button_Trigger_Value = "/input/trigger/value";
-
-		inline static const char *Button_Squeeze_Force = "/input/squeeze/force";
-		inline static const char *Button_Squeeze_Value = "/input/squeeze/value";
-
-		inline static const char *Thumbstick_Touch = "/input/thumbstick/touch";
-		inline static const char *Thumbstick_Click = "/input/thumbstick/click";
-		inline static const char *Thumbstick_X = "/input/thumbstick/x";
-		inline static const char *Thumbstick_Y = "/input/thumbstick/y";
-
-		inline static const char *Trackpad_Touch = "/input/trackpad/touch";
-		inline static const char *Trackpad_Force = "/input/trackpad/force";
-		inline static const char *Trackpad_X = "/input/trackpad/x";
-		inline static const char *Trackpad_Y = "/input/trackpad/y";
-
-		inline static const char *Pose_Grip = "/input/grip/pose";
-		inline static const char *Pose_Aim = "/input/aim/pose";
-		inline static const char *Output_Haptic = "/output/haptic";
-
-		// ** FUNCTIONS (PUBLIC) **/
-
-		/// Class Constructor
-		XRInputProfile_ValveIndex( std::shared_ptr< spdlog::logger > pLogger );
-
-		/// Class Destructor
-		~XRInputProfile_ValveIndex();
-
-		/// Return the input profile path for this controller
-		const char *GetInputProfile() const override { return "/interaction_profiles/valve/index_controller"; }
-
+		static constexpr const char *Hand_Left = "/user/hand/left";
+		static constexpr const char *Hand_Right = "/user/hand/right";
+
+		static constexpr const char *Button_A_Touch = "/input/a/touch";
+		static constexpr const char *Button_A_Click = "/input/a/click";
+
+		static constexpr const char *Button_B_Touch = "/input/b/touch";
+		static constexpr const char *Button_B_Click = "/input/b/click";
+
+		static constexpr const char *Button_System_Touch = "/input/system/touch";
+		static constexpr const char *Button_System_Click = "/input/system/click";
+
+		static constexpr const char *Button_Trigger_Touch = "/input/trigger/touch";
+		static constexpr const char *Button_Trigger_Click = "/input/trigger/click";
+		static constexpr const char *Button_Trigger_Value = "/input/trigger/value";
+
+		static constexpr const char *Button_Squeeze_Force = "/input/squeeze/force";
+		static constexpr const char *Button_Squeeze_Value = "/input/squeeze/value";
+
+		static constexpr const char *Thumbstick_Touch = "/input/thumbstick/touch";
+		static constexpr const char *Thumbstick_Click = "/input/thumbstick/click";
+		static constexpr const char *Thumbstick_X = "/input/thumbstick/x";
+		static constexpr const char *Thumbstick_Y = "/input/thumbstick/y";
+
+		static constexpr const char *Trackpad_Touch = "/input/trackpad/touch";
+		static constexpr const char *Trackpad_Force = "/input/trackpad/force";
+		static constexpr const char *Trackpad_X = "/input/trackpad/x";
+		static constexpr const char *Trackpad_Y = "/input/trackpad/y";
+
+		static constexpr const char *Pose_Grip = "/input/grip/pose";
+		static constexpr const char *Pose_Aim = "/input/aim/pose";
+		static constexpr const char *Output_Haptic = "/output/haptic";
+
+		// ** DESCRIPTOR **/
+
+		/// Components of the profile with their types and the user paths they are valid for
+		static constexpr XRInputComponent Components[] =
+		{
+			{ Button_A_Touch, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Button_A_Click, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Button_B_Touch, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Button_B_Click, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Button_System_Touch, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Button_System_Click, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Button_Trigger_Touch, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Button_Trigger_Click, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Button_Trigger_Value, COMPONENT_FLOAT, USER_PATH_HANDS },
+			{ Button_Squeeze_Force, COMPONENT_FLOAT, USER_PATH_HANDS },
+			{ Button_Squeeze_Value, COMPONENT_FLOAT, USER_PATH_HANDS },
+			{ Thumbstick_Touch, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Thumbstick_Click, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Thumbstick_X, COMPONENT_FLOAT, USER_PATH_HANDS },
+			{ Thumbstick_Y, COMPONENT_FLOAT, USER_PATH_HANDS },
+			{ Trackpad_Touch, COMPONENT_BOOLEAN, USER_PATH_HANDS },
+			{ Trackpad_Force, COMPONENT_FLOAT, USER_PATH_HANDS },
+			{ Trackpad_X, COMPONENT_FLOAT, USER_PATH_HANDS },
+			{ Trackpad_Y, COMPONENT_FLOAT, USER_PATH_HANDS },
+			{ Pose_Grip, COMPONENT_POSE, USER_PATH_HANDS },
+			{ Pose_Aim, COMPONENT_POSE, USER_PATH_HANDS },
+			{ Output_Haptic, COMPONENT_HAPTIC, USER_PATH_HANDS },
+		};
+
+		/// Descriptor of the profile
+		static constexpr XRInputProfileDesc Descriptor { "/interaction_profiles/valve/index_controller", USER_PATH_HANDS, Components };
 	};
+
+	static_assert( XRInputProfile_ValveIndex::Descriptor.IsValid(), "Invalid Valve Index interaction profile descriptor" );
 } // namespace OpenXRProvider
@@ -0,0 +1,112 @@
+/* Copyright 2021 Rune Berg (GitHub: https://github.com/1runeberg, Twitter: https://twitter.com/1runeberg)
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *  BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ *  GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+ *  DAMAGE.
+ *
+ */
+
+
+#pragma once
+
+#include <XRCommon.h>
+#include <input/XRInputProfileTable.h>
+
+#include <unordered_map>
+
+namespace OpenXRProvider
+{
+	/// Bidirectional intern table of path strings and their XrPaths. Each string is converted by the runtime only once,
+	/// lookups after that are a hash of the string and a single table probe. XrPaths are valid for the life of the instance
+	class XRPathTable
+	{
+	  public:
+		// ** FUNCTIONS (PUBLIC) **/
+
+		/// Class Constructor
+		/// @param[in]	xrInstance			The active OpenXR instance
+		/// @param[in]	pXRDispatchTable	Function pointers of the active OpenXR instance
+		/// @param[in]	pLogger				Pointer to the logger
+		XRPathTable( XrInstance xrInstance, const XRDispatchTable *pXRDispatchTable, std::shared_ptr< spdlog::logger > pLogger );
+
+		/// Class Destructor
+		~XRPathTable();
+
+		/// Hash a path string, or the concatenation of two path strings. Matches XRPathHash so hashes can be computed at compile time
+		/// @param[in]	sPath		The path (e.g. /user/hand/left)
+		/// @param[in]	sSuffix		(optional) Appended to the path (e.g. /input/trigger/value)
+		/// @return		The hash
+		static uint64_t Hash( const char *sPath, const char *sSuffix = nullptr );
+
+		/// Get the XrPath of a string, converting and interning it on first use
+		/// @param[in]	sPath		The path (e.g. /user/hand/left)
+		/// @param[out]	xrPath		The XrPath (XR_NULL_PATH on failure)
+		/// @param[in]	sSuffix		(optional) Appended to the path (e.g. /input/trigger/value)
+		/// @return		Result of xrStringToPath or XR_SUCCESS if the path was already interned
+		XrResult Intern( const char *sPath, XrPath *xrPath, const char *sSuffix = nullptr );
+
+		/// Get the XrPath of a string with a precomputed hash (e.g. from a descriptor table), converting and interning it on first use
+		/// @param[in]	nHash		Hash of the path and suffix (XRPathHash)
+		/// @param[in]	sPath		The path (e.g. /user/hand/left)
+		/// @param[out]	xrPath		The XrPath (XR_NULL_PATH on failure)
+		/// @param[in]	sSuffix		(optional) Appended to the path (e.g. /input/trigger/value)
+		/// @return		Result of xrStringToPath or XR_SUCCESS if the path was already interned
+		XrResult Intern( uint64_t nHash, const char *sPath, XrPath *xrPath, const char *sSuffix = nullptr );
+
+		/// Get the XrPath of a string, converting and interning it on first use
+		/// @param[in]	sPath		The path (e.g. /user/hand/left)
+		/// @return		The XrPath or XR_NULL_PATH if the runtime couldn't convert the string
+		XrPath GetPath( const char *sPath );
+
+		/// Get the string of an XrPath. Paths that weren't interned are converted by the runtime once and cached
+		/// @param[in]	xrPath		The XrPath
+		/// @return		The path string or an empty string if the path is invalid. Valid until the table is destroyed
+		const char *GetString( XrPath xrPath );
+
+		/// Getter for the number of interned paths
+		/// @return		Number of interned paths
+		size_t GetCount() const { return m_mapStringByPath.size(); }
+
+	  private:
+		// ** FUNCTIONS (PRIVATE) **/
+
+		/// Check if an interned string is the same as the (optionally suffixed) path looked up
+		/// @param[in]	sInterned	The interned string
+		/// @param[in]	sPath		The path
+		/// @param[in]	sSuffix		Appended to the path (can be null)
+		/// @return		If the strings match
+		static bool IsMatch( const std::string &sInterned, const char *sPath, const char *sSuffix );
+
+		// ** MEMBER VARIABLES (PRIVATE) **/
+
+		/// The active OpenXR instance
+		XrInstance m_xrInstance = XR_NULL_HANDLE;
+
+		/// Function pointers of the active OpenXR instance
+		const XRDispatchTable *m_pXRDispatchTable = nullptr;
+
+		/// Pointer to the logger
+		std::shared_ptr< spdlog::logger > m_pXRLogger;
+
+		/// Interned paths, keyed by the hash of their string
+		std::unordered_map< uint64_t, XrPath > m_mapPathByHash;
+
+		/// Interned strings, keyed by their path
+		std::unordered_map< XrPath, std::string > m_mapStringByPath;
+	};
+} // namespace OpenXRProvider
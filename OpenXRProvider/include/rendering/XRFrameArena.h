@@ -0,0 +1,111 @@
+/* Copyright 2021 Rune Berg (GitHub: https://github.com/1runeberg, Twitter: https://twitter.com/1runeberg)
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *  BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ *  GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+ *  DAMAGE.
+ *
+ */
+
+
+#pragma once
+
+#include <XRCommon.h>
+
+namespace OpenXRProvider
+{
+	/// Fixed capacity storage for everything submitted to xrEndFrame (projection views, depth info, layers and layer header pointers).
+	/// It is created once per session and reset at the start of every frame, so frame submission never touches the heap and every
+	/// structure chained through a next pointer stays alive until the frame is submitted
+	class XRFrameArena
+	{
+	  public:
+		/// Maximum number of composition layers per frame (minimum maxLayerCount guaranteed by the OpenXR spec)
+		static const uint32_t k_nMaxLayers = 16;
+
+		/// Maximum number of projection layers per frame
+		static const uint32_t k_nMaxProjectionLayers = 2;
+
+		/// Maximum number of projection views per frame (all projection layers combined)
+		static const uint32_t k_nMaxProjectionViews = 4;
+
+		// ** FUNCTIONS (PUBLIC) **/
+
+		/// Class Constructor
+		XRFrameArena();
+
+		/// Class Destructor
+		~XRFrameArena();
+
+		/// Release everything allocated in the previous frame. Must be called before building a new frame
+		void Reset();
+
+		/// Allocate a contiguous array of projection views, initialized to XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW
+		/// @param[in]	nCount	Number of views to allocate
+		/// @return		Pointer to the first view or nullptr if the arena is out of views for this frame
+		XrCompositionLayerProjectionView *AllocateProjectionViews( uint32_t nCount );
+
+		/// Allocate a contiguous array of depth info structs, initialized to XR_TYPE_COMPOSITION_LAYER_DEPTH_INFO_KHR
+		/// @param[in]	nCount	Number of depth infos to allocate (one for each projection view)
+		/// @return		Pointer to the first depth info or nullptr if the arena is out of depth infos for this frame
+		XrCompositionLayerDepthInfoKHR *AllocateDepthInfos( uint32_t nCount );
+
+		/// Allocate a projection layer, initialized to XR_TYPE_COMPOSITION_LAYER_PROJECTION
+		/// @return		Pointer to the projection layer or nullptr if the arena is out of projection layers for this frame
+		XrCompositionLayerProjection *AllocateProjectionLayer();
+
+		/// Add a layer to the list of layers to submit this frame. Layers are submitted in the order they were added
+		/// @param[in]	pLayer	The layer to add, it must stay valid until the frame is submitted
+		/// @return		If the layer was added. False if the frame is already at k_nMaxLayers
+		bool AddLayer( const XrCompositionLayerBaseHeader *pLayer );
+
+		/// Getter for the layers to submit this frame
+		/// @return		Array of layer header pointers in submission order
+		const XrCompositionLayerBaseHeader *const *GetLayers() const { return m_pLayers; }
+
+		/// Getter for the number of layers to submit this frame
+		/// @return		Number of layers added since the last Reset
+		uint32_t GetLayerCount() const { return m_nLayerCount; }
+
+	  private:
+		// ** MEMBER VARIABLES (PRIVATE) **/
+
+		/// Layer header pointers in submission order
+		const XrCompositionLayerBaseHeader *m_pLayers[ k_nMaxLayers ];
+
+		/// Projection view storage
+		XrCompositionLayerProjectionView m_xrProjectionViews[ k_nMaxProjectionViews ];
+
+		/// Depth info storage (chained to projection views)
+		XrCompositionLayerDepthInfoKHR m_xrDepthInfos[ k_nMaxProjectionViews ];
+
+		/// Projection layer storage
+		XrCompositionLayerProjection m_xrProjectionLayers[ k_nMaxProjectionLayers ];
+
+		/// Number of layers added this frame
+		uint32_t m_nLayerCount = 0;
+
+		/// Number of projection views allocated this frame
+		uint32_t m_nProjectionViewCount = 0;
+
+		/// Number of depth infos allocated this frame
+		uint32_t m_nDepthInfoCount = 0;
+
+		/// Number of projection layers allocated this frame
+		uint32_t m_nProjectionLayerCount = 0;
+	};
+} // namespace OpenXRProvider
@@ -0,0 +1,109 @@
+/* Copyright 2021 Rune Berg (GitHub: https://github.com/1runeberg, Twitter: https://twitter.com/1runeberg)
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *  BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ *  GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+ *  DAMAGE.
+ *
+ */
+
+
+#pragma once
+
+#include <chrono>
+
+#include <XRCommon.h>
+
+namespace OpenXRProvider
+{
+	/// Fixed size ring of per-frame stats (phase durations, display time deltas, missed frames) recorded by the render manager.
+	/// Nothing is allocated after construction. Query from the same thread that runs the frame loop
+	class XRFrameTelemetry
+	{
+	  public:
+		/// Number of frames kept for queries and percentiles
+		static const uint32_t k_nMaxFrames = 512;
+
+		// ** FUNCTIONS (PUBLIC) **/
+
+		/// Class Constructor
+		XRFrameTelemetry();
+
+		/// Class Destructor
+		~XRFrameTelemetry();
+
+		/// Current time of a monotonic clock, for measuring frame phase durations
+		/// @return		Monotonic time in nanoseconds
+		static XrDuration GetTimeNs()
+		{
+			return std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now().time_since_epoch() ).count();
+		}
+
+		/// Add a frame to the ring, overwriting the oldest one if full. Fills in the display time delta and missed frame info
+		/// @param[in]	xrFrameStats	Stats of the frame that was just submitted
+		void Record( const XRFrameStats &xrFrameStats );
+
+		/// Drop all recorded frames and totals
+		void Reset();
+
+		/// Getter for the number of frames currently held in the ring
+		/// @return		Number of frames available to query (up to k_nMaxFrames)
+		uint32_t GetFrameCount() const { return m_nFrameCount; }
+
+		/// Getter for the total number of frames recorded since the last reset
+		/// @return		Total recorded frames
+		uint64_t GetTotalFrames() const { return m_nTotalFrames; }
+
+		/// Getter for the total number of display periods missed since the last reset
+		/// @return		Total missed frames
+		uint64_t GetTotalMissedFrames() const { return m_nTotalMissedFrames; }
+
+		/// Retrieve the stats of a recorded frame
+		/// @param[in]	nFramesAgo	0 for the most recent frame, 1 for the one before, etc
+		/// @return		Pointer to the frame stats or nullptr if the frame is no longer (or not yet) in the ring
+		const XRFrameStats *GetFrameStats( uint32_t nFramesAgo = 0 ) const;
+
+		/// Compute the p50/p95/p99 of a frame timing over the frames in the ring
+		/// @param[in]	eTiming		Which timing to compute the percentiles for
+		/// @return		The percentiles in nanoseconds (all 0 if no frames were recorded)
+		XRFrameTimingPercentiles GetPercentiles( EXRFrameTiming eTiming );
+
+	  private:
+		// ** MEMBER VARIABLES (PRIVATE) **/
+
+		/// Ring of frame stats
+		XRFrameStats m_xrFrames[ k_nMaxFrames ];
+
+		/// Scratch space for sorting timings when computing percentiles
+		XrDuration m_nSortScratch[ k_nMaxFrames ];
+
+		/// Index the next frame will be written to
+		uint32_t m_nNextFrame = 0;
+
+		/// Number of frames held in the ring
+		uint32_t m_nFrameCount = 0;
+
+		/// Total number of frames recorded
+		uint64_t m_nTotalFrames = 0;
+
+		/// Total number of display periods missed
+		uint64_t m_nTotalMissedFrames = 0;
+
+		/// Predicted display time of the last recorded frame
+		XrTime m_xrLastDisplayTime = 0;
+	};
+} // namespace OpenXRProvider
@@ -60,7 +60,14 @@ namespace OpenXRProvider
 		/// @param[in]	xrAppGraphicsInfo	Information payload to create graphics api dependent variables and transactions
 		/// @param[out]	xrSession			The created OpenXR session
 		/// @param[out]	xrResult			Result of negotiation of the graphics api with the current OpenXR runtime
-		XRGraphicsAPI( XrInstance *xrInstance, XrSystemId *xrSystemId, XRAppGraphicsInfo *xrAppGraphicsInfo, XrSession *xrSession, XrResult *xrResult );
+		/// @param[in]	pXRDispatchTable	Function pointers of the active OpenXR instance
+		XRGraphicsAPI(
+			XrInstance *xrInstance,
+			XrSystemId *xrSystemId,
+			XRAppGraphicsInfo *xrAppGraphicsInfo,
+			XrSession *xrSession,
+			XrResult *xrResult,
+			const XRDispatchTable *pXRDispatchTable );
 
 		/// Class Destructor
 		~XRGraphicsAPI();
@@ -71,10 +78,32 @@ namespace OpenXRProvider
 		/// @param[in]	bIsDepth		(optional: false) If a depth texture should be generated as well
 		XrResult GenerateSwapchainImages( const XrSwapchain &xrSwapChain, const uint32_t nEye, const bool bIsDepth = false );
 
+		/// Retrieve the graphics api dependent images of a composition layer's swapchain (quad, cylinder, equirect)
+		/// @param[in]	xrSwapChain		The OpenXR swapchain generated by the XR Render Manager for the layer
+		/// @param[in]	nLayerId		Id of the layer that owns the swapchain
+		XrResult GenerateLayerSwapchainImages( const XrSwapchain &xrSwapChain, const uint32_t nLayerId );
+
+		/// Forget the images of a composition layer's swapchain (call when the layer's swapchain is destroyed)
+		/// @param[in]	nLayerId		Id of the layer that owned the swapchain
+		void ClearLayerSwapchainImages( const uint32_t nLayerId );
+
+		/// Retrieve the number of swapchain images of a composition layer
+		/// @param[in]	nLayerId	Id of the layer
+		/// @return					Number of images in the layer's swapchain
+		uint32_t GetLayerSwapchainImageCount( const uint32_t nLayerId );
+
 		/// Getter for the OpenXR Graphics Binding (graphics api dependent)
 		/// @return OpenXR Graphics Binding
 		void *GetGraphicsBinding() { return m_xrGraphicsBinding; }
 
+		/// Set whether both eyes share a single texture array swapchain (one array slice per eye). Must be set before swapchain images are generated
+		/// @param[in]	bIsStereoTextureArray	If stereo texture array mode is active
+		void SetStereoTextureArray( const bool bIsStereoTextureArray ) { m_bIsStereoTextureArray = bIsStereoTextureArray; }
+
+		/// Getter for whether both eyes share a single texture array swapchain
+		/// @return		If stereo texture array mode is active
+		bool GetIsStereoTextureArray() const { return m_bIsStereoTextureArray; }
+
 		/// Retrieve the number of swapchain images
 		/// @param[in]	eEye		Which eye texture
 		/// @param[in]	bIsDepth	(optional: false) Get the depth texture
@@ -94,11 +123,44 @@ namespace OpenXRProvider
 		/// @return							The graphics api dependent texture (a uint32_t id in OpenGL)
 		uint32_t GetTexture2D( const EXREye eEye, uint32_t nSwapchainIndex, const bool bGetDepth = false );
 
+		/// OPENGL: Retrieve the texture target the eye textures must be bound to
+		/// @return							GL_TEXTURE_2D_ARRAY in stereo texture array mode (bind each eye's slice with glFramebufferTextureLayer), GL_TEXTURE_2D otherwise
+		uint32_t GetTextureTarget() const;
+
 		/// OPENGL: Retrieve all the graphics api dependent texture2d that the app should render to
 		/// @param[in]	eEye				Which eye texture
 		/// @param[in]	bGetDepth			(optional: false) Whether the textures to retrieve are depth textures
 		/// @return							Array of graphics api dependent textures that the app should render to
-		std::vector< XrSwapchainImageOpenGLKHR > GetTextures2D( const EXREye eEye, const bool bGetDepth = false );
+		const std::vector< XrSwapchainImageOpenGLKHR > &GetTextures2D( const EXREye eEye, const bool bGetDepth = false ) const;
+
+		/// OPENGL: Build one complete framebuffer (color + depth) per swapchain image so no attachments need to change while rendering.
+		/// Call after the swapchain images have been generated, with the app's GL context current. If there are no depth swapchain images,
+		/// transient depth renderbuffers are created instead
+		/// @param[in]	nWidth					Width of the swapchain images in pixels
+		/// @param[in]	nHeight					Height of the swapchain images in pixels
+		/// @param[in]	bShareTransientDepth	(optional: true) Create a single transient depth renderbuffer per eye instead of one per swapchain image
+		/// @return								If all the framebuffers were created and are complete
+		bool BuildRenderTargets( const uint32_t nWidth, const uint32_t nHeight, const bool bShareTransientDepth = true );
+
+		/// OPENGL: Destroy the cached framebuffers and transient depth renderbuffers (the app's GL context must be current)
+		void DestroyRenderTargets();
+
+		/// OPENGL: Retrieve the cached framebuffer for a pair of acquired swapchain images
+		/// @param[in]	eEye				Which eye
+		/// @param[in]	nColorIndex			The index of the acquired image in the eye's color swapchain
+		/// @param[in]	nDepthIndex			(optional: 0) The index of the acquired image in the eye's depth swapchain (ignored if there is no depth swapchain)
+		/// @return							The framebuffer object id to render to (0 if render targets haven't been built)
+		uint32_t GetRenderTarget( const EXREye eEye, const uint32_t nColorIndex, const uint32_t nDepthIndex = 0 ) const;
+
+		/// OPENGL: Getter for whether the render target cache has been built
+		/// @return							If cached framebuffers are available
+		bool GetHasRenderTargets() const { return !m_vRenderTargets_L.empty(); }
+
+		/// OPENGL: Retrieve the graphics api dependent texture2d of a composition layer that the app should render to
+		/// @param[in]	nLayerId			Id of the layer
+		/// @param[in]  nSwapchainIndex		The index of the image in the layer's swapchain to retrieve
+		/// @return							The graphics api dependent texture (a uint32_t id in OpenGL), 0 if the layer or index is invalid
+		uint32_t GetLayerTexture2D( const uint32_t nLayerId, uint32_t nSwapchainIndex );
 #endif
 
 		/// Check whether the texture format supports depth
@@ -111,14 +173,38 @@ namespace OpenXRProvider
 		int64_t GetDefaultDepthFormat();
 	
 	  private:
+		// ** FUNCTIONS (PRIVATE) **/
+
+#if XR_USE_GRAPHICS_API_OPENGL
+		/// OPENGL: Retrieve all the images of a swapchain from the runtime
+		/// @param[in]	xrSwapChain			The OpenXR swapchain to enumerate
+		/// @param[out]	xrSwapchainImages	Array that will hold the swapchain's images
+		/// @return							Result of the enumeration call to the runtime
+		XrResult EnumerateSwapchainImages( const XrSwapchain &xrSwapChain, std::vector< XrSwapchainImageOpenGLKHR > &xrSwapchainImages );
+
+		/// OPENGL: Retrieve the swapchain images of a composition layer
+		/// @param[in]	nLayerId	Id of the layer
+		/// @return					The layer's images, nullptr if the layer has none
+		std::vector< XrSwapchainImageOpenGLKHR > *GetLayerSwapchainImages( const uint32_t nLayerId );
+#endif
+
 		// ** MEMBER VARIABLES (PRIVATE) **/
 
 		/// The active OpenXR Graphics binding
 		void *m_xrGraphicsBinding = nullptr;
 
+		/// If both eyes share a single texture array swapchain (images are only held in the left eye arrays)
+		bool m_bIsStereoTextureArray = false;
+
 		/// The OpenXR Session that was created by this class
 		XrSession *m_xrSession = XR_NULL_HANDLE;
 
+		/// Function pointers of the active OpenXR instance
+		const XRDispatchTable *m_pXRDispatchTable = nullptr;
+
+		/// Number of framebuffers cached per color swapchain image (one for each depth swapchain image, or 1 if there is no depth swapchain)
+		uint32_t m_nRenderTargetDepthStride = 1;
+
 #if XR_USE_GRAPHICS_API_OPENGL
 		/// OPENGL: Swapchain color images for the left eye that the app should render to
 		std::vector< XrSwapchainImageOpenGLKHR > m_xrSwapchainImages_Color_L;
@@ -131,6 +217,24 @@ namespace OpenXRProvider
 
 		/// OPENGL: Swapchain depth images for the right eye that the app should render to
 		std::vector< XrSwapchainImageOpenGLKHR > m_xrSwapchainImages_Depth_R;
+
+		/// OPENGL: Swapchain images for each composition layer (indexed by the layer's slot)
+		std::vector< std::vector< XrSwapchainImageOpenGLKHR > > m_xrLayerSwapchainImages;
+
+		/// OPENGL: Slot in m_xrLayerSwapchainImages of each layer id
+		std::map< uint32_t, uint32_t > m_mapLayerSlot;
+
+		/// OPENGL: Slots in m_xrLayerSwapchainImages freed by destroyed layers
+		std::vector< uint32_t > m_vFreeLayerSlots;
+
+		/// OPENGL: Cached framebuffers for the left eye (indexed by color image index * depth stride + depth image index)
+		std::vector< uint32_t > m_vRenderTargets_L;
+
+		/// OPENGL: Cached framebuffers for the right eye (indexed by color image index * depth stride + depth image index)
+		std::vector< uint32_t > m_vRenderTargets_R;
+
+		/// OPENGL: Transient depth renderbuffers used when there is no depth swapchain (one per eye if shared, otherwise one per color image)
+		std::vector< uint32_t > m_vTransientDepth;
 #endif
 	};
 }
@@ -23,18 +23,74 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include <XRCore.h>
+#include <XRRingBuffer.h>
+#include <rendering/XRFrameArena.h>
+#include <rendering/XRFrameTelemetry.h>
 
 // Supported Extensions
 #include <extensions/XRExtVisibilityMask.h>
 
 namespace OpenXRProvider
 {
+	/// State of a composition layer (quad, cylinder, equirect) created by the render manager
+	struct XRLayer
+	{
+		/// Id the app uses to reference this layer
+		uint32_t Id;
+
+		/// The app provided layer info
+		XRLayerInfo Info;
+
+		/// The layer's own swapchain
+		XrSwapchain Swapchain = XR_NULL_HANDLE;
+
+		/// The OpenXR layer struct submitted every frame. It lives as long as the layer does, so it's only rebuilt when the layer changes
+		union
+		{
+			XrCompositionLayerBaseHeader Header;
+			XrCompositionLayerQuad Quad;
+			XrCompositionLayerCylinderKHR Cylinder;
+			XrCompositionLayerEquirectKHR Equirect;
+		};
+
+		/// Number of frames submitted since the layer's content was last updated
+		uint32_t FramesSinceUpdate = 0;
+
+		/// The swapchain image index acquired for the current frame
+		uint32_t AcquiredImageIndex = 0;
+
+		/// If an image was ever released to the swapchain (layers without content are not submitted)
+		bool HasContent = false;
+
+		/// If a swapchain image is currently held (acquired but not yet released)
+		bool IsImageAcquired = false;
+
+		/// If the layer should be submitted
+		bool IsVisible = true;
+
+		/// Struct Constructor
+		/// @param[in]	nId				Id of the layer
+		/// @param[in]	xrLayerInfo		The app provided layer info
+		XRLayer( uint32_t nId, const XRLayerInfo &xrLayerInfo )
+			: Id( nId )
+			, Info( xrLayerInfo )
+		{
+		}
+	};
+
 	class XRRender
 	{
 		// OpenXR view, in VR we have one for each eye
 		static const uint32_t k_nVRViewCount = 2;
 
+		// Maximum number of frames the frame pacing thread can run ahead of the render thread
+		static const uint32_t k_nMaxFramesInFlight = 2;
+
 		static const float k_fMedianIPD;
 		static const float k_fMinIPD;
 		static const float k_fTau;
@@ -58,6 +114,18 @@ namespace OpenXRProvider
 		/// @return		If depth textures are also generated/handled
 		bool GetDepthHandling() { return m_bDepthHandling; }
 
+		/// Set the depth range that is submitted with the depth swapchain images from the next EndFrame onwards. Call whenever the app's projection changes
+		/// @param[in]	fNearZ			Distance in meters to the near plane of the app's projection
+		/// @param[in]	fFarZ			Distance in meters to the far plane of the app's projection (FLT_MAX for an infinite far plane)
+		/// @param[in]	bReversedZ		(optional: false) If the app renders with reversed-Z (depth of 1 at the near plane)
+		/// @param[in]	bSubmit			(optional: true) If depth should be submitted at all (e.g. the app skipped its depth pass)
+		/// @return		If depth will be submitted (false if depth handling isn't active or the depth range is invalid)
+		bool SetDepthSubmitInfo( float fNearZ, float fFarZ, bool bReversedZ = false, bool bSubmit = true );
+
+		/// Getter for the depth range that is submitted with the depth swapchain images
+		/// @return		The current depth submission info
+		const XRDepthSubmitInfo &GetDepthSubmitInfo() const { return m_xrDepthSubmitInfo; }
+
 		/// Retrieve the graphics api dependent class that's maintained by the XR Provider and created during OpenXR initialization
 		/// @return		The GraphicsAPI object that can deal with graphics api dependent transactions (e.g OpenGL, DirectX, Vulkan)
 		XRGraphicsAPI *GetGraphicsAPI();
@@ -120,16 +188,279 @@ namespace OpenXRProvider
 		/// @return		The visibility mask extension object generated during OpenXR initialization if the currently active runtime supports it
 		XRExtVisibilityMask *GetXRVisibilityMask() { return m_pXRVisibilityMask; }
 
-		/// Process frame, call after app has rendered to the appropriate swapchain image(s)
+		/// Getter for whether the runtime wants the app to render the current frame (from the last WaitFrame call)
+		/// @return		If the app should render to the swapchain images this frame
+		bool GetShouldRender() const { return m_xrFrameState.shouldRender == XR_TRUE; }
+
+		/// Getter for the swapchain image index acquired for an eye in the current frame (valid between AcquireViewImages and EndFrame)
+		/// @param[in]	eEye		Which eye
+		/// @param[in]	bIsDepth	(optional: false) Get the acquired depth swapchain image index instead of color
+		/// @return		The index of the acquired image in the eye's swapchain
+		uint32_t GetAcquiredImageIndex( EXREye eEye, bool bIsDepth = false ) const
+		{
+			return bIsDepth ? m_nAcquiredDepthImageIndex[ GetSwapchainIndex( eEye ) ] : m_nAcquiredColorImageIndex[ GetSwapchainIndex( eEye ) ];
+		}
+
+#ifdef XR_USE_GRAPHICS_API_OPENGL
+		/// OPENGL: Getter for the cached framebuffer that matches the images acquired for an eye in the current frame (valid between AcquireViewImages
+		/// and EndFrame). Requires XRRenderInfo.CacheRenderTargets
+		/// @param[in]	eEye		Which eye
+		/// @return		The framebuffer object id to render to (0 if the render target cache isn't active)
+		uint32_t GetRenderTarget( EXREye eEye );
+#endif
+
+		/// Getter for whether both eyes render to a single texture array swapchain (one array slice per eye)
+		/// @return		If stereo texture array mode is active
+		bool GetIsStereoTextureArray() const { return m_bStereoTextureArray; }
+
+		/// Getter for the texture array slice an eye should render to (always 0 unless stereo texture array mode is active)
+		/// @param[in]	eEye	Which eye
+		/// @return		The array slice of the eye's swapchain image to render to
+		uint32_t GetTextureArrayIndex( EXREye eEye ) const { return m_bStereoTextureArray ? ( uint32_t )eEye : 0; }
+
+		/// Opt-in to late latching. Views (and any late latch spaces) are re-located on LateLatch calls at the frame's predicted display time,
+		/// the fresh poses are written to the app's GPU pose buffer and the projection layer is submitted with the exact poses that were written
+		/// @param[in]	pGpuPoseBuffer		Memory the GPU reads the poses from (e.g. a persistently mapped, coherent uniform buffer) or
+		///									any memory the app uploads from. Can be nullptr if the app only reads poses via GetHMDState
+		/// @param[in]	bLatchAtEndFrame	(optional: false) Also latch right before xrEndFrame. Only set this if the GPU reads pGpuPoseBuffer at
+		///									execution time (persistent coherent mapping), otherwise submitted poses won't match what was rendered
+		void EnableLateLatching( XRLateLatchData *pGpuPoseBuffer, bool bLatchAtEndFrame = false );
+
+		/// Turn late latching off. Views are only located once in BeginFrame
+		void DisableLateLatching();
+
+		/// Getter for whether late latching is active
+		/// @return		If late latching is enabled
+		bool GetIsLateLatching() const { return m_bLateLatching; }
+
+		/// Add a space (e.g. a controller's pose action space) to be re-located with the views on every late latch
+		/// @param[in]	xrSpace		The space to late latch
+		/// @param[out]	pSlot		Index of the space's matrix in XRLateLatchData::SpaceMatrix
+		/// @return		If the space was added. False if all XRLateLatchData::k_nMaxSpaces slots are taken
+		bool AddLateLatchSpace( XrSpace xrSpace, uint32_t *pSlot );
+
+		/// Remove all late latch spaces
+		void ClearLateLatchSpaces() { m_nLateLatchSpaceCount = 0; }
+
+		/// Re-locate the views and late latch spaces for the current frame and publish them. Call as late as possible before the GPU
+		/// reads the poses, i.e. right before issuing the eye draw calls. Only valid between BeginFrame and EndFrame with late latching enabled
+		/// @return		If fresh, valid view poses were latched. On failure the previously located poses are kept
+		bool LateLatch();
+
+		/// Getter for the frame timing telemetry (per-frame phase durations, missed frames and percentiles of the last frames submitted)
+		/// @return		The frame telemetry, query it from the thread running the frame loop
+		XRFrameTelemetry *GetFrameTelemetry() { return &m_xrFrameTelemetry; }
+
+		/// Getter for the current dynamic resolution settings
+		/// @return		Dynamic resolution bounds and tuning
+		XRDynamicResolutionInfo GetDynamicResolution() const { return m_xrDynamicResolution; }
+
+		/// Change the dynamic resolution settings. MaxScale can't go above what the swapchains were allocated for at creation
+		/// @param[in]	xrDynamicResolution		Dynamic resolution bounds and tuning
+		void SetDynamicResolution( const XRDynamicResolutionInfo &xrDynamicResolution );
+
+		/// Report how long the last frame took on the cpu and gpu. Drives dynamic resolution scaling, call once per frame
+		/// @param[in]	nCpuFrameTime	Cpu time spent on the last frame in nanoseconds
+		/// @param[in]	nGpuFrameTime	Gpu time spent on the last frame in nanoseconds (e.g. from a GL_TIME_ELAPSED query)
+		void ReportFrameTimes( XrDuration nCpuFrameTime, XrDuration nGpuFrameTime );
+
+		/// Getter for the current render scale relative to the runtime's recommended image rect size
+		/// @return		The render scale used for the current frame
+		float GetRenderScale() const { return m_fRenderScale; }
+
+		/// Getter for the rect of the swapchain image the app should render to this frame. Use this to set the viewport
+		/// @param[in]	eEye	Which eye
+		/// @return		The render rect, fixed between BeginFrame and EndFrame
+		XrRect2Di GetRenderRect( EXREye eEye ) const { return m_xrRenderRects[ eEye == EYE_LEFT ? 0 : 1 ]; }
+
+		/// Getter for the number of frames the frame pacing thread may run ahead of the render thread. This is what the app requested,
+		/// the thread itself is stopped while the session isn't running and restarted once it is
+		/// @return		0 if frames are paced synchronously on the calling thread, otherwise 1 or 2
+		uint32_t GetFramesInFlight() const { return m_nFramesInFlight; }
+
+		/// Start pipelined frame pacing. A dedicated thread will call xrWaitFrame and xrBeginFrame so the render thread
+		/// never blocks on the runtime's frame throttling. Must be called from the render thread outside of a frame (i.e. before WaitFrame
+		/// or after EndFrame). The thread only runs while the session is running, it's stopped before the session ends and restarted when
+		/// it's ready again or after a failed wait. The frame phase functions work the same way once started
+		/// @param[in]	nFramesInFlight		0 - no pacing thread, WaitFrame and BeginFrame call the runtime directly (default behavior)
+		///									1 - the pacing thread waits for the next frame only after the current one has ended
+		///									2 - the pacing thread waits for the next frame while the current one is still being rendered
+		/// @return		If the requested pacing mode is now active
+		bool StartFramePacing( uint32_t nFramesInFlight );
+
+		/// Stop pipelined frame pacing and go back to synchronous frame calls. Any frame the pacing thread waited on that the
+		/// render thread never picked up is submitted empty. Must be called from the render thread outside of a frame
+		void StopFramePacing();
+
+		/// Frame phase (1): Wait for the runtime to signal the app to start a new frame. Updates the predicted display time and period.
+		/// When frame pacing is active, this picks up the next frame token from the pacing thread instead of calling the runtime
+		/// @param[out]	pFrameToken		(optional: nullptr) Timing info for the new frame
+		/// @return		If the wait succeeded. A false here means the frame should be skipped entirely (do not call BeginFrame)
+		bool WaitFrame( XRFrameToken *pFrameToken = nullptr );
+
+		/// Frame phase (2): Begin the frame before doing any GPU work and locate the eye views for the predicted display time
+		/// When frame pacing is active, this waits until the pacing thread has begun the frame
+		/// @return		If the frame was begun. EndFrame must be called for every frame that was successfully begun
+		bool BeginFrame();
+
+		/// Frame phase (3): Acquire and wait for a swapchain image for each eye. The app should only render if this returns true
+		/// @param[out]	pImageIndices	(optional: nullptr) Array of k_nVRViewCount that will hold the acquired color image index for each eye
+		/// @return		If images were acquired and the app should render to them. False if the runtime does not want the app to render this frame
+		bool AcquireViewImages( uint32_t *pImageIndices = nullptr );
+
+		/// Frame phase (4): Release any acquired swapchain images and submit the frame's composition layers to the runtime
+		/// @param[in]	pAppLayers		(optional: nullptr) Additional app composition layers to submit on top of the projection layer, in order
+		/// @return		If the frame was successfully submitted
+		bool EndFrame( std::vector< XrCompositionLayerBaseHeader * > *pAppLayers = nullptr );
+
+		/// Create a composition layer (quad, cylinder or equirect) with its own swapchain. Layers are submitted with every frame
+		/// in order of XRLayerInfo::Order once the app has rendered to them at least once
+		/// @param[in]	xrLayerInfo		Layer type, swapchain size, update interval, placement, etc
+		/// @param[out]	pLayerId		Id of the created layer
+		/// @return		If the layer was created. False if the layer type isn't supported by the runtime or the swapchain couldn't be created
+		bool CreateLayer( const XRLayerInfo &xrLayerInfo, uint32_t *pLayerId );
+
+		/// Destroy a composition layer and its swapchain. Must be called outside of a frame
+		/// @param[in]	nLayerId	Id of the layer to destroy
+		void DestroyLayer( uint32_t nLayerId );
+
+		/// Check if the app should render new content to a layer this frame based on its update interval
+		/// @param[in]	nLayerId	Id of the layer
+		/// @return		If the layer's update interval has elapsed (or it has no content yet). Static layers only need one update
+		bool GetLayerNeedsUpdate( uint32_t nLayerId );
+
+		/// Acquire and wait for a layer's swapchain image so the app can render to it. The image is released in EndFrame.
+		/// Use GetGraphicsAPI()->GetLayerTexture2D to get the texture to render to
+		/// @param[in]	nLayerId		Id of the layer
+		/// @param[out]	pImageIndex		Index of the acquired image in the layer's swapchain
+		/// @return		If an image was acquired. Only valid between BeginFrame and EndFrame while the runtime wants the app to render
+		bool AcquireLayerImage( uint32_t nLayerId, uint32_t *pImageIndex );
+
+		/// Move a layer
+		/// @param[in]	nLayerId	Id of the layer
+		/// @param[in]	xrPose		The new pose of the layer in its space
+		void SetLayerPose( uint32_t nLayerId, const XrPosef &xrPose );
+
+		/// Show or hide a layer without destroying it
+		/// @param[in]	nLayerId	Id of the layer
+		/// @param[in]	bIsVisible	If the layer should be submitted
+		void SetLayerVisible( uint32_t nLayerId, bool bIsVisible );
+
+		/// Process a full frame (wait, begin, acquire, end) without any app rendering in between. Useful for
+		/// submitting frames while the app isn't rendering (e.g. right after a session begins). Apps that render
+		/// should call the individual frame phases instead so drawing happens between AcquireViewImages and EndFrame
+		/// @return		If the frame was successfully processed
 		bool ProcessXRFrame();
 
 	  private:
 		// ** FUNCTIONS (PRIVATE) **/
 
+		/// Get the index of the swapchain that holds a view's images
+		/// @param[in]	nView	The view (eye) index
+		/// @return		The view's swapchain index in m_vXRSwapChainsColor and m_vXRSwapChainsDepth
+		uint32_t GetSwapchainIndex( uint32_t nView ) const { return m_bStereoTextureArray ? 0 : nView; }
+
+		/// Frame pacing thread entry point. Waits on and begins frames, handing a frame token to the render thread for each one
+		void FramePacingLoop();
+
+		/// Start the frame pacing thread for the requested frames in flight. The thread must not be running
+		void StartFramePacingThread();
+
+		/// Stop the frame pacing thread, keeping the requested frames in flight
+		/// @param[in]	bCloseOutFrames		If frames the render thread never picked up should be begun and ended (false if the session is ending anyway)
+		void StopFramePacingThread( bool bCloseOutFrames );
+
+		/// Mark the render thread's current frame as ended and wake the frame pacing thread so it can begin the next one
+		void SetPacedFrameEnded();
+
+		/// Release all swapchain images that were acquired this frame
+		/// @return		If all acquired images were released successfully
+		bool ReleaseViewImages();
+
+		/// Create a single swapchain
+		/// @param[in]	nWidth			Texture width in pixels
+		/// @param[in]	nHeight			Texture height in pixels
+		/// @param[in]	nFormat			Graphics api dependent texture format
+		/// @param[in]	nArraySize		Texture array size
+		/// @param[in]	nMipCount		Texture Mip count
+		/// @param[in]	nSampleCount	Texture sample count
+		/// @param[in]	bIsDepth		If this is a depth swapchain
+		/// @param[in]	xrCreateFlags	Swapchain create flags (e.g. XR_SWAPCHAIN_CREATE_STATIC_IMAGE_BIT)
+		/// @param[out]	pSwapchain		The created swapchain
+		/// @param[out]	pCreateInfo		(optional: nullptr) The create info the swapchain was created with
+		/// @return		Result of the swapchain creation call to the runtime
+		XrResult CreateSwapchain(
+			uint32_t nWidth,
+			uint32_t nHeight,
+			int64_t nFormat,
+			uint32_t nArraySize,
+			uint32_t nMipCount,
+			uint32_t nSampleCount,
+			bool bIsDepth,
+			XrSwapchainCreateFlags xrCreateFlags,
+			XrSwapchain *pSwapchain,
+			XrSwapchainCreateInfo *pCreateInfo = nullptr );
+
+		/// Get the size a view's swapchain images are allocated at (the max render rect if dynamic resolution is enabled)
+		/// @param[in]	nView	The view (eye) index
+		/// @return		Swapchain texture size in pixels
+		XrExtent2Di GetSwapchainExtent( uint32_t nView ) const;
+
+		/// Locate the eye views at the current frame's predicted display time and update the hmd state
+		/// @return		If views were located with valid poses
+		bool LocateViews();
+
+		/// Adjust the render scale based on the last reported frame times. Called once a frame has begun
+		void UpdateRenderScale();
+
+		/// Recompute the render rect of each eye from the current render scale
+		void UpdateRenderRects();
+
 		/// Create the swapchain(s) that will hold OpenXR runtime created images (texture2d)
 		/// @param[in] bIsDepth		If depth textures need to be created along with the color textures
 		void GenerateSwapchains( bool bIsDepth = false );
 
+		/// Create the view swapchains, their images and the render target cache from the negotiated formats and view configurations
+		void GenerateViewSwapchains();
+
+		/// Session callback registered with XRCore. Releases or rebuilds everything created from the session when it's recreated,
+		/// and stops or resumes frame submission when the session is ended or begun
+		/// @param[in]	eSessionEvent	The session lifecycle event
+		/// @param[in]	pUserContext	The render manager
+		static void Callback_XRSession( EXRSessionEvent eSessionEvent, void *pUserContext );
+
+		/// Stop frame pacing and release any images held for the current frame before the session is ended
+		void SuspendSessionFrames();
+
+		/// Restart frame pacing with the frames in flight it had when the session was ended or destroyed
+		void ResumeSessionFrames();
+
+		/// Destroy all swapchains and stop frame pacing before the session is destroyed. Layers, formats and view configurations are kept
+		void ReleaseSessionResources();
+
+		/// Recreate the view and layer swapchains on the new session
+		void RestoreSessionResources();
+
+		/// Check that every depth swapchain was created with the same size, sample count and array size as its color swapchain (required for depth submission)
+		/// @return		If the depth swapchains can be submitted along with the color swapchains
+		bool ValidateDepthSwapchains();
+
+		/// Find a composition layer
+		/// @param[in]	nLayerId	Id of the layer
+		/// @return		The layer or nullptr if there's no layer with this id
+		XRLayer *GetLayer( uint32_t nLayerId );
+
+		/// Fill in a layer's OpenXR composition layer struct from its layer info
+		/// @param[in]	xrLayer		The layer to update
+		void UpdateLayerStruct( XRLayer &xrLayer );
+
+		/// Release any acquired layer images and update the layers' content tracking
+		void ReleaseLayerImages();
+
+		/// Add composition layers to this frame's submission
+		/// @param[in]	bUnderlay	Add layers submitted before the projection layer (negative order) instead of the ones after it
+		void AddLayersToFrame( bool bUnderlay );
+
 		/// Destroy swapchain(s) that holds OpenXR runtime created images (texture2d)
 		/// @param[in] vXRSwapchains	Array that holds the active swapchains
 		void DestroySwapchains( std::vector< XrSwapchain > &vXRSwapchains );
@@ -153,6 +484,12 @@ namespace OpenXRProvider
 		/// If depth textures are active/being handled
 		bool m_bDepthHandling = false;
 
+		/// Depth range submitted with the depth swapchain images
+		XRDepthSubmitInfo m_xrDepthSubmitInfo;
+
+		/// If both eyes share a single texture array swapchain (one array slice per eye)
+		bool m_bStereoTextureArray = false;
+
 		/// The size of the the texture array for each image in the swapchain
 		uint32_t m_nTextureArraySize = 1;
 
@@ -170,16 +507,34 @@ namespace OpenXRProvider
 
 		/// The graphics api dependent depth format in int64_t (e.g. GL_RGBA16, DXGI_FORMAT_R8G8B8A8_UNORM_SRGB, etc)
 		int64_t m_nDepthFormat = 0;
-		
+
+		/// If a framebuffer is cached for each swapchain image (from XRRenderInfo)
+		bool m_bCacheRenderTargets = false;
+
+		/// If cached render targets share a single transient depth buffer (from XRRenderInfo)
+		bool m_bShareTransientDepth = true;
+
 		/// The logger object
 		std::shared_ptr< spdlog::logger > m_pXRLogger;
 
+		/// The deferred log (per-frame messages)
+		XRDeferredLog *m_pXRDeferredLog = nullptr;
+
+		/// Function pointers of the active OpenXR instance
+		const XRDispatchTable *m_pXRDispatchTable = nullptr;
+
 		/// Array of image textures (color texture2d) that is used by the OpenXR runtime to render images to the user's hmd
 		std::vector< XrSwapchain > m_vXRSwapChainsColor;
 
 		/// Array of image textures (depth texture2d) that is used by the OpenXR runtime to render images to the user's hmd 
 		std::vector< XrSwapchain > m_vXRSwapChainsDepth;
 
+		/// How each color swapchain was created (same order as m_vXRSwapChainsColor)
+		std::vector< XrSwapchainCreateInfo > m_vXRSwapChainInfosColor;
+
+		/// How each depth swapchain was created (same order as m_vXRSwapChainsDepth)
+		std::vector< XrSwapchainCreateInfo > m_vXRSwapChainInfosDepth;
+
 		/// Array of OpenXR views (for VR, there is one for each eye)
 		std::vector< XrView > m_vXRViews;
 
@@ -203,5 +558,123 @@ namespace OpenXRProvider
 
 		/// The current predicted display period for predicting display times beyond the next m_xrPredictedDisplayTime
 		XrDuration m_xrPredictedDisplayPeriod;
+
+		/// The frame state returned by the runtime on the last WaitFrame call
+		XrFrameState m_xrFrameState { XR_TYPE_FRAME_STATE };
+
+		/// If the current frame has been begun and is waiting for an EndFrame call
+		bool m_bFrameBegun = false;
+
+		/// If the eye views located for the current frame have valid poses
+		bool m_bViewsValid = false;
+
+		/// Steady clock time the current frame's eye views were located at (nanoseconds)
+		XrDuration m_nViewsLocatedTime = 0;
+
+		/// If swapchain images have been acquired for all eyes in the current frame and the app may render to them
+		bool m_bImagesAcquired = false;
+
+		/// If a color swapchain image is currently held (acquired but not yet released) for each eye
+		bool m_bColorImageAcquired[ k_nVRViewCount ] = { false, false };
+
+		/// If a depth swapchain image is currently held (acquired but not yet released) for each eye
+		bool m_bDepthImageAcquired[ k_nVRViewCount ] = { false, false };
+
+		/// The color swapchain image index acquired for each eye in the current frame
+		uint32_t m_nAcquiredColorImageIndex[ k_nVRViewCount ] = { 0, 0 };
+
+		/// The depth swapchain image index acquired for each eye in the current frame
+		uint32_t m_nAcquiredDepthImageIndex[ k_nVRViewCount ] = { 0, 0 };
+
+		/// Dynamic resolution bounds and tuning
+		XRDynamicResolutionInfo m_xrDynamicResolution;
+
+		/// Current render scale relative to the runtime's recommended image rect size
+		float m_fRenderScale = 1.0f;
+
+		/// Largest render scale the allocated swapchains can hold
+		float m_fMaxAllocatedScale = 1.0f;
+
+		/// Last reported cpu frame time in nanoseconds
+		XrDuration m_nCpuFrameTime = 0;
+
+		/// Last reported gpu frame time in nanoseconds
+		XrDuration m_nGpuFrameTime = 0;
+
+		/// Consecutive frames that went over the frame time budget
+		uint32_t m_nFramesOverBudget = 0;
+
+		/// Consecutive frames that had enough headroom to scale up
+		uint32_t m_nFramesUnderBudget = 0;
+
+		/// The rect of the swapchain image each eye renders to this frame
+		XrRect2Di m_xrRenderRects[ k_nVRViewCount ];
+
+		/// If late latching is enabled
+		bool m_bLateLatching = false;
+
+		/// If views should also be latched right before xrEndFrame
+		bool m_bLatchAtEndFrame = false;
+
+		/// App provided memory the late latched poses are written to
+		XRLateLatchData *m_pLateLatchBuffer = nullptr;
+
+		/// Spaces re-located on every late latch
+		XrSpace m_xrLateLatchSpaces[ XRLateLatchData::k_nMaxSpaces ];
+
+		/// Number of spaces re-located on every late latch
+		uint32_t m_nLateLatchSpaceCount = 0;
+
+		/// Ring of per-frame stats
+		XRFrameTelemetry m_xrFrameTelemetry;
+
+		/// Stats of the frame currently being processed by the render thread
+		XRFrameStats m_xrCurrentFrameStats;
+
+		/// Preallocated storage for the composition layers submitted each frame
+		XRFrameArena m_xrFrameArena;
+
+		/// Composition layers created by the app, sorted by submission order
+		std::vector< XRLayer > m_vXRLayers;
+
+		/// Id for the next composition layer created
+		uint32_t m_nNextLayerId = 0;
+
+		/// Timing info of the frame currently being processed by the render thread
+		XRFrameToken m_xrCurrentFrameToken;
+
+		/// Number of frames the app asked the frame pacing thread to run ahead of the render thread (0 if frames are paced synchronously).
+		/// Kept while the thread is stopped so it can be restarted
+		uint32_t m_nFramesInFlight = 0;
+
+		/// Thread that calls xrWaitFrame and xrBeginFrame when frame pacing is active
+		std::thread m_FramePacingThread;
+
+		/// Lock-free (single producer, single consumer) handoff of waited frames from the frame pacing thread to the render thread
+		XRRingBuffer< XRFrameToken, k_nMaxFramesInFlight > m_FrameTokens;
+
+		/// Only used to sleep and wake on m_FramePacingSignal without missing a wakeup, the token ring itself is never locked
+		std::mutex m_FramePacingMutex;
+
+		/// Wakes whichever thread waits on the other to push or pop a token, begin a frame or end one (instead of spinning for a display period)
+		std::condition_variable m_FramePacingSignal;
+
+		/// If the frame pacing thread should keep running
+		std::atomic< bool > m_bFramePacingActive { false };
+
+		/// If the frame pacing thread stopped on its own due to a runtime error
+		std::atomic< bool > m_bFramePacingFailed { false };
+
+		/// If xrBeginFrame succeeded for the last frame begun by the pacing thread. Written before m_nFramesBegun
+		std::atomic< bool > m_bPacedFrameBegun { false };
+
+		/// How long xrBeginFrame took on the pacing thread for the last frame it began (nanoseconds). Written before m_nFramesBegun
+		std::atomic< XrDuration > m_nPacedBeginDuration { 0 };
+
+		/// Index of the last frame the pacing thread called xrBeginFrame for
+		std::atomic< uint64_t > m_nFramesBegun { 0 };
+
+		/// Index of the last frame the render thread ended (or gave up on)
+		std::atomic< uint64_t > m_nFramesEnded { 0 };
 	};
 } // namespace OpenXRProvider
@@ -27,6 +27,12 @@
 
 namespace OpenXRProvider
 {
+	 /// Core created by CreateAsync's worker thread, shared with the deferred provider creation. The core is deleted along with
+	 /// the handoff unless the provider took ownership of it (e.g. the app dropped the future without calling get())
+	 struct XRCoreHandoff
+	 {
+		 std::unique_ptr< XRCore > Core;
+	 };
 
 	 XRProvider::XRProvider( XRAppInfo xrAppInfo, XRAppGraphicsInfo xrAppGraphicsInfo, XRRenderInfo xrRenderInfo ) 
 	 {
@@ -40,6 +46,84 @@ namespace OpenXRProvider
 		 m_pXRInputManager = new XRInput( m_pXRCoreSystem, m_pXRRenderManager );
 	 }
 
+	 XRProvider::XRProvider(
+		 XRCore *pXRCore,
+		 XRAppGraphicsInfo xrAppGraphicsInfo,
+		 XRRenderInfo xrRenderInfo,
+		 Callback_XRInitProgress pProgressCallback,
+		 void *pUserContext )
+		 : m_pXRCoreSystem( pXRCore )
+	 {
+		 try
+		 {
+			 // Create session and reference space
+			 if ( pProgressCallback )
+				 pProgressCallback( INIT_PHASE_SESSION, pUserContext );
+
+			 m_pXRCoreSystem->CreateSession( xrAppGraphicsInfo );
+
+			 // Create OpenXR render manager
+			 if ( pProgressCallback )
+				 pProgressCallback( INIT_PHASE_RENDER, pUserContext );
+
+			 m_pXRRenderManager = new XRRender( m_pXRCoreSystem, xrRenderInfo );
+
+			 // Create OpenXR input manager
+			 if ( pProgressCallback )
+				 pProgressCallback( INIT_PHASE_INPUT, pUserContext );
+
+			 m_pXRInputManager = new XRInput( m_pXRCoreSystem, m_pXRRenderManager );
+		 }
+		 catch ( ... )
+		 {
+			 // The destructor won't run for a partially constructed provider
+			 delete m_pXRRenderManager;
+			 delete m_pXRCoreSystem;
+			 throw;
+		 }
+	 }
+
+	 std::future< XRProvider * > XRProvider::CreateAsync(
+		 XRAppInfo xrAppInfo,
+		 XRAppGraphicsInfo xrAppGraphicsInfo,
+		 XRRenderInfo xrRenderInfo,
+		 Callback_XRInitProgress pProgressCallback,
+		 void *pUserContext )
+	 {
+		 // Instance, extensions and xr system don't need the graphics context - start them now on a worker thread
+		 std::shared_ptr< XRCoreHandoff > pXRCoreHandoff = std::make_shared< XRCoreHandoff >();
+		 std::future< void > xrCoreFuture = std::async( std::launch::async, [ = ]() {
+			 if ( pProgressCallback )
+				 pProgressCallback( INIT_PHASE_INSTANCE, pUserContext );
+
+			 pXRCoreHandoff->Core.reset( new XRCore( xrAppInfo, xrRenderInfo.EnableDepthTextureSupport ) );
+		 } );
+
+		 // Everything else runs on the thread that collects the provider (deferred), which has the graphics context
+		 return std::async(
+			 std::launch::deferred,
+			 [ xrCoreFuture = std::move( xrCoreFuture ), pXRCoreHandoff, xrAppGraphicsInfo, xrRenderInfo, pProgressCallback, pUserContext ]() mutable {
+				 try
+				 {
+					 // Rethrows if the core couldn't be created
+					 xrCoreFuture.get();
+
+					 XRProvider *pXRProvider = new XRProvider( pXRCoreHandoff->Core.release(), xrAppGraphicsInfo, xrRenderInfo, pProgressCallback, pUserContext );
+
+					 if ( pProgressCallback )
+						 pProgressCallback( INIT_PHASE_READY, pUserContext );
+
+					 return pXRProvider;
+				 }
+				 catch ( ... )
+				 {
+					 if ( pProgressCallback )
+						 pProgressCallback( INIT_PHASE_FAILED, pUserContext );
+					 throw;
+				 }
+			 } );
+	 }
+
 	 XRProvider::~XRProvider() 
 	 { 
 		 delete m_pXRRenderManager;
@@ -0,0 +1,179 @@
+/* Copyright 2021 Rune Berg (GitHub: https://github.com/1runeberg, Twitter: https://twitter.com/1runeberg)
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *  BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ *  GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+ *  DAMAGE.
+ *
+ */
+
+
+#pragma once
+
+#include <fstream>
+
+#include <XRCapabilityCache.h>
+
+namespace OpenXRProvider
+{
+	XRCapabilityCache::XRCapabilityCache( const char *sCacheFile )
+		: m_sCacheFile( sCacheFile ? sCacheFile : "" )
+	{
+		m_bIsLoaded = Load();
+	}
+
+	XRCapabilityCache::~XRCapabilityCache() {}
+
+	bool XRCapabilityCache::ValidateExtensions( const std::vector< XrExtensionProperties > &vExtensions )
+	{
+		uint64_t nHash = k_nHashSeed;
+		for ( const XrExtensionProperties &xrExtension : vExtensions )
+		{
+			nHash = Hash( xrExtension.extensionName, strnlen( xrExtension.extensionName, XR_MAX_EXTENSION_NAME_SIZE ), nHash );
+			nHash = Hash( &xrExtension.extensionVersion, sizeof( xrExtension.extensionVersion ), nHash );
+		}
+
+		m_bExtensionsMatch = m_bIsLoaded && m_xrCapabilities.ExtensionsHash == nHash;
+		m_xrCapabilities.ExtensionsHash = nHash;
+
+		return m_bExtensionsMatch;
+	}
+
+	bool XRCapabilityCache::ValidateRuntime( const char *sRuntimeName, uint64_t nRuntimeVersion, uint32_t nVendorId )
+	{
+		m_bIsValid = m_bExtensionsMatch && m_xrCapabilities.RuntimeName == sRuntimeName && m_xrCapabilities.RuntimeVersion == nRuntimeVersion &&
+					 m_xrCapabilities.VendorId == nVendorId;
+
+		if ( !m_bIsValid )
+		{
+			// Start over, keeping only what has been negotiated so far
+			uint64_t nExtensionsHash = m_xrCapabilities.ExtensionsHash;
+			m_xrCapabilities = XRRuntimeCapabilities();
+			m_xrCapabilities.ExtensionsHash = nExtensionsHash;
+			m_xrCapabilities.RuntimeName = sRuntimeName;
+			m_xrCapabilities.RuntimeVersion = nRuntimeVersion;
+			m_xrCapabilities.VendorId = nVendorId;
+		}
+
+		return m_bIsValid;
+	}
+
+	bool XRCapabilityCache::Save()
+	{
+		std::ofstream cacheFile( m_sCacheFile, std::ios::trunc );
+		if ( !cacheFile )
+			return false;
+
+		cacheFile << "XRCapabilityCache " << k_nFileVersion << "\n";
+		cacheFile << "RuntimeName " << m_xrCapabilities.RuntimeName << "\n";
+		cacheFile << "RuntimeVersion " << m_xrCapabilities.RuntimeVersion << "\n";
+		cacheFile << "VendorId " << m_xrCapabilities.VendorId << "\n";
+		cacheFile << "ExtensionsHash " << m_xrCapabilities.ExtensionsHash << "\n";
+
+		cacheFile << "ViewConfigViews " << m_xrCapabilities.ViewConfigViews.size() << "\n";
+		for ( const XrViewConfigurationView &xrView : m_xrCapabilities.ViewConfigViews )
+		{
+			cacheFile << xrView.recommendedImageRectWidth << " " << xrView.maxImageRectWidth << " " << xrView.recommendedImageRectHeight << " "
+					  << xrView.maxImageRectHeight << " " << xrView.recommendedSwapchainSampleCount << " " << xrView.maxSwapchainSampleCount << "\n";
+		}
+
+		cacheFile << "SwapchainFormats " << m_xrCapabilities.SwapchainFormats.size();
+		for ( int64_t nFormat : m_xrCapabilities.SwapchainFormats )
+			cacheFile << " " << nFormat;
+		cacheFile << "\n";
+
+		cacheFile << "RequestedFormatsHash " << m_xrCapabilities.RequestedFormatsHash << "\n";
+		cacheFile << "ColorFormat " << m_xrCapabilities.ColorFormat << "\n";
+		cacheFile << "DepthFormat " << m_xrCapabilities.DepthFormat << "\n";
+
+		return ( bool )cacheFile;
+	}
+
+	bool XRCapabilityCache::Load()
+	{
+		std::ifstream cacheFile( m_sCacheFile );
+		if ( !cacheFile )
+			return false;
+
+		std::string sKey;
+		uint32_t nFileVersion = 0;
+		if ( !( cacheFile >> sKey >> nFileVersion ) || sKey != "XRCapabilityCache" || nFileVersion != k_nFileVersion )
+			return false;
+
+		// Runtime names can have spaces, so they take the rest of the line
+		if ( !( cacheFile >> sKey ) || sKey != "RuntimeName" )
+			return false;
+		cacheFile.get();
+		std::getline( cacheFile, m_xrCapabilities.RuntimeName );
+
+		size_t nCount = 0;
+		cacheFile >> sKey >> m_xrCapabilities.RuntimeVersion;
+		cacheFile >> sKey >> m_xrCapabilities.VendorId;
+		cacheFile >> sKey >> m_xrCapabilities.ExtensionsHash;
+
+		// Counts are checked before anything is allocated for them, a larger one can only come from a corrupt file
+		cacheFile >> sKey >> nCount;
+		if ( !cacheFile || nCount > k_nMaxViewConfigViews )
+		{
+			m_xrCapabilities = XRRuntimeCapabilities();
+			return false;
+		}
+
+		m_xrCapabilities.ViewConfigViews.resize( nCount, { XR_TYPE_VIEW_CONFIGURATION_VIEW } );
+		for ( XrViewConfigurationView &xrView : m_xrCapabilities.ViewConfigViews )
+		{
+			cacheFile >> xrView.recommendedImageRectWidth >> xrView.maxImageRectWidth >> xrView.recommendedImageRectHeight >> xrView.maxImageRectHeight >>
+				xrView.recommendedSwapchainSampleCount >> xrView.maxSwapchainSampleCount;
+		}
+
+		cacheFile >> sKey >> nCount;
+		if ( !cacheFile || nCount > k_nMaxSwapchainFormats )
+		{
+			m_xrCapabilities = XRRuntimeCapabilities();
+			return false;
+		}
+
+		m_xrCapabilities.SwapchainFormats.resize( nCount );
+		for ( int64_t &nFormat : m_xrCapabilities.SwapchainFormats )
+			cacheFile >> nFormat;
+
+		cacheFile >> sKey >> m_xrCapabilities.RequestedFormatsHash;
+		cacheFile >> sKey >> m_xrCapabilities.ColorFormat;
+		cacheFile >> sKey >> m_xrCapabilities.DepthFormat;
+
+		// Anything missing or malformed invalidates the whole cache
+		if ( !cacheFile || sKey != "DepthFormat" )
+		{
+			m_xrCapabilities = XRRuntimeCapabilities();
+			return false;
+		}
+
+		return true;
+	}
+
+	uint64_t XRCapabilityCache::Hash( const void *pData, size_t nSize, uint64_t nHash )
+	{
+		const uint8_t *pBytes = static_cast< const uint8_t * >( pData );
+		for ( size_t i = 0; i < nSize; i++ )
+		{
+			nHash ^= pBytes[ i ];
+			nHash *= 1099511628211ULL;
+		}
+
+		return nHash;
+	}
+} // namespace OpenXRProvider
@@ -0,0 +1,202 @@
+/* Copyright 2021 Rune Berg (GitHub: https://github.com/1runeberg, Twitter: https://twitter.com/1runeberg)
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *  BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ *  GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+ *  DAMAGE.
+ *
+ */
+
+
+#pragma once
+
+#include <XRClock.h>
+
+namespace OpenXRProvider
+{
+	void XRLatencyHistogram::Record( XrDuration nLatency )
+	{
+		if ( nLatency < 0 )
+			nLatency = 0;
+
+		uint32_t nBucket = ( uint32_t )std::min< XrDuration >( nLatency / k_nBucketWidth, k_nBucketCount - 1 );
+		m_nBuckets[ nBucket ]++;
+
+		m_nMin = m_nCount == 0 ? nLatency : std::min( m_nMin, nLatency );
+		m_nMax = std::max( m_nMax, nLatency );
+		m_nSum += ( uint64_t )nLatency;
+		m_nCount++;
+	}
+
+	void XRLatencyHistogram::Reset()
+	{
+		memset( m_nBuckets, 0, sizeof( m_nBuckets ) );
+		m_nCount = 0;
+		m_nSum = 0;
+		m_nMin = 0;
+		m_nMax = 0;
+	}
+
+	XRFrameTimingPercentiles XRLatencyHistogram::GetPercentiles() const
+	{
+		XRFrameTimingPercentiles xrPercentiles;
+		if ( m_nCount == 0 )
+			return xrPercentiles;
+
+		xrPercentiles.P50 = GetPercentile( 500 );
+		xrPercentiles.P95 = GetPercentile( 950 );
+		xrPercentiles.P99 = GetPercentile( 990 );
+		return xrPercentiles;
+	}
+
+	XrDuration XRLatencyHistogram::GetPercentile( uint32_t nPerMille ) const
+	{
+		// Smallest number of samples at or below the percentile (rounded up so p99 of a few samples is the largest one)
+		uint64_t nTarget = std::max< uint64_t >( ( m_nCount * nPerMille + 999 ) / 1000, 1 );
+		uint64_t nSeen = 0;
+
+		for ( uint32_t i = 0; i < k_nBucketCount; i++ )
+		{
+			nSeen += m_nBuckets[ i ];
+			if ( nSeen >= nTarget )
+				return std::min( ( XrDuration )( i + 1 ) * k_nBucketWidth, m_nMax );
+		}
+
+		return m_nMax;
+	}
+
+	XRClock::XRClock( XrInstance xrInstance, const XRDispatchTable *pXRDispatchTable, std::shared_ptr< spdlog::logger > pLogger )
+		: m_xrInstance( xrInstance )
+		, m_pXRDispatchTable( pXRDispatchTable )
+		, m_pXRLogger( pLogger )
+	{
+		assert( m_xrInstance != XR_NULL_HANDLE && m_pXRDispatchTable );
+
+		// The conversion function is only in the table if XRCore enabled the extension on the instance
+		m_bIsExact = QueryOffset( m_nOffset );
+		m_bIsCalibrated = m_bIsExact;
+		m_nLastQueryTime = GetSteadyTimeNs();
+
+		if ( m_bIsExact )
+			m_pXRLogger->info( "XR Clock uses {} (XrTime is {} ns ahead of the steady clock)", s_TimeConversionExtensionName, m_nOffset );
+		else
+			m_pXRLogger->info( "XR Clock will be estimated from frame timing. Time conversion extension is not available" );
+	}
+
+	XRClock::~XRClock() {}
+
+	void XRClock::Calibrate( XrTime xrPredictedDisplayTime, XrDuration nPredictedDisplayPeriod, XrDuration nWaitEndTimeNs )
+	{
+		if ( m_bIsExact )
+		{
+			// Calibrate runs every frame, but a runtime call per frame isn't needed to follow a slow drift
+			XrDuration nNow = GetSteadyTimeNs();
+			if ( nNow - m_nLastQueryTime >= k_nExactQueryInterval )
+			{
+				QueryOffset( m_nOffset );
+				m_nLastQueryTime = nNow;
+			}
+
+			return;
+		}
+
+		if ( xrPredictedDisplayTime == 0 || nWaitEndTimeNs == 0 )
+			return;
+
+		// ========================================================================
+		// (1) A frame is never displayed sooner than one display period after xrWaitFrame returns,
+		//     so the smallest lead seen over a window (less a period) approximates the offset between the clocks
+		// ========================================================================
+		XrDuration nOffset = xrPredictedDisplayTime - nWaitEndTimeNs - nPredictedDisplayPeriod;
+
+		m_nEstimateMinOffset = m_nEstimateFrameCount == 0 ? nOffset : std::min( m_nEstimateMinOffset, nOffset );
+		m_nEstimateFrameCount++;
+
+		// ========================================================================
+		// (2) Use the first frame right away, then refresh once per window so a slow drift is followed
+		// ========================================================================
+		if ( !m_bIsCalibrated || m_nEstimateFrameCount == k_nEstimateFrames )
+		{
+			m_nOffset = m_nEstimateMinOffset;
+			m_bIsCalibrated = true;
+		}
+
+		if ( m_nEstimateFrameCount == k_nEstimateFrames )
+			m_nEstimateFrameCount = 0;
+	}
+
+	void XRClock::LogLatencies()
+	{
+		const char *sProbeNames[ LATENCY_PROBE_COUNT ] = { "Input age", "Pose to submit", "Display lead" };
+
+		for ( uint32_t i = 0; i < LATENCY_PROBE_COUNT; i++ )
+		{
+			const XRLatencyHistogram &xrHistogram = m_xrLatencyHistograms[ i ];
+			if ( xrHistogram.GetCount() == 0 )
+				continue;
+
+			XRFrameTimingPercentiles xrPercentiles = xrHistogram.GetPercentiles();
+			m_pXRLogger->info(
+				"{} latency ({} samples{}): mean {:.2f} ms, p50 {:.2f} ms, p95 {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms",
+				sProbeNames[ i ],
+				xrHistogram.GetCount(),
+				m_bIsExact ? "" : ", estimated clock",
+				xrHistogram.GetMean() / 1e6,
+				xrPercentiles.P50 / 1e6,
+				xrPercentiles.P95 / 1e6,
+				xrPercentiles.P99 / 1e6,
+				xrHistogram.GetMax() / 1e6 );
+		}
+	}
+
+	bool XRClock::QueryOffset( XrDuration &nOffset )
+	{
+		[[maybe_unused]] XrTime xrTime = 0;
+
+#if defined( XR_USE_PLATFORM_WIN32 )
+		if ( !m_pXRDispatchTable->xrConvertWin32PerformanceCounterToTimeKHR )
+			return false;
+
+		// Sample the steady clock on both sides of the performance counter and use the midpoint
+		LARGE_INTEGER nPerformanceCounter;
+		XrDuration nSteadyBefore = GetSteadyTimeNs();
+		QueryPerformanceCounter( &nPerformanceCounter );
+		XrDuration nSteadyAfter = GetSteadyTimeNs();
+
+		if ( m_pXRDispatchTable->xrConvertWin32PerformanceCounterToTimeKHR( m_xrInstance, &nPerformanceCounter, &xrTime ) != XR_SUCCESS )
+			return false;
+#elif defined( XR_USE_TIMESPEC )
+		if ( !m_pXRDispatchTable->xrConvertTimespecTimeToTimeKHR )
+			return false;
+
+		timespec xrTimespec;
+		XrDuration nSteadyBefore = GetSteadyTimeNs();
+		clock_gettime( CLOCK_MONOTONIC, &xrTimespec );
+		XrDuration nSteadyAfter = GetSteadyTimeNs();
+
+		if ( m_pXRDispatchTable->xrConvertTimespecTimeToTimeKHR( m_xrInstance, &xrTimespec, &xrTime ) != XR_SUCCESS )
+			return false;
+#else
+		return false;
+#endif
+
+#if defined( XR_USE_PLATFORM_WIN32 ) || defined( XR_USE_TIMESPEC )
+		nOffset = xrTime - ( nSteadyBefore + ( nSteadyAfter - nSteadyBefore ) / 2 );
+		return true;
+#endif
+	}
+} // namespace OpenXRProvider
@@ -28,6 +28,13 @@
 namespace OpenXRProvider
 {
 	XRCore::XRCore( XRAppInfo xrAppInfo, XRAppGraphicsInfo xrAppGraphicsInfo, bool bEnableDepth )
+		: XRCore( xrAppInfo, bEnableDepth )
+	{
+		// Setup world
+		WorldInit( &xrAppGraphicsInfo );
+	}
+
+	XRCore::XRCore( XRAppInfo xrAppInfo, bool bEnableDepth )
 		: m_sAppName( xrAppInfo.AppName )
 		, m_nAppVersion( xrAppInfo.AppVersion )
 		, m_sEngineName( xrAppInfo.EngineName )
@@ -38,25 +45,40 @@ namespace OpenXRProvider
 		// Set Loggers
 		std::vector< spdlog::sink_ptr > vLogSinks;
 
-		// Add file logging if requested
+		// Add file logging if requested (sinks are shared with the deferred log thread)
 		if (xrAppInfo.LogFile)
-			vLogSinks.push_back( std::make_shared< spdlog::sinks::basic_file_sink_st >( xrAppInfo.LogFile ) );
+			vLogSinks.push_back( std::make_shared< spdlog::sinks::basic_file_sink_mt >( xrAppInfo.LogFile ) );
 
-		vLogSinks.push_back( std::make_shared< spdlog::sinks::stdout_color_sink_st >() );	
+		vLogSinks.push_back( std::make_shared< spdlog::sinks::stdout_color_sink_mt >() );	
 		m_pLogger = std::make_shared< spdlog::logger >( LOG_TITLE, begin( vLogSinks ), end( vLogSinks ) );
 
-		m_pLogger->set_level( spdlog::level::trace );
+		m_pLogger->set_level( XR_CALL_LOG_SUCCESS ? spdlog::level::trace : spdlog::level::info );
 		m_pLogger->set_pattern( "[%Y-%b-%d %a] [%T %z] [%^%L%$] [%n] %v" );
 		m_pLogger->info( "G'day from {}! Logging to: {}", LOG_TITLE, xrAppInfo.LogFile );
 		m_pLogger->info( "Logs powered by spdlog version {}.{}.{}", SPDLOG_VER_MAJOR, SPDLOG_VER_MINOR, SPDLOG_VER_PATCH );
+
+		// Create deferred log for per-frame messages
+		m_pXRDeferredLog = new XRDeferredLog( m_pLogger );
+
+		// Load the capabilities negotiated with the runtime on the last launch
+		if ( xrAppInfo.CapabilityCacheFile )
+			m_pXRCapabilityCache = new XRCapabilityCache( xrAppInfo.CapabilityCacheFile );
 	
 		// Create event handler
 		m_pXREventHandler = new XREventHandler( m_pLogger );
 
 		// Initialize OpenXR
 		OpenXRInit( bEnableDepth );
+	}
+
+	void XRCore::CreateSession( XRAppGraphicsInfo xrAppGraphicsInfo )
+	{
+		if ( m_xrSession != XR_NULL_HANDLE )
+		{
+			m_pLogger->warn( "XR Session already created (Handle {})", ( uint64_t )m_xrSession );
+			return;
+		}
 
-		// Setup world
 		WorldInit( &xrAppGraphicsInfo );
 	}
 
@@ -73,18 +95,42 @@ namespace OpenXRProvider
 		// Destroy event handler
 		if ( m_pXREventHandler )
 			delete m_pXREventHandler;
+
+		// Destroy capability cache
+		if ( m_pXRCapabilityCache )
+			delete m_pXRCapabilityCache;
+
+		// Destroy the graphics info kept for recreating the session
+		if ( m_pXRAppGraphicsInfo )
+			delete m_pXRAppGraphicsInfo;
+
+		// Destroy space registry
+		if ( m_pXRSpaceRegistry )
+			delete m_pXRSpaceRegistry;
+
+		// Destroy clock
+		if ( m_pXRClock )
+			delete m_pXRClock;
+
+		// Destroy OpenXR View Space
+		if ( m_xrViewSpace != XR_NULL_HANDLE )
+			m_xrLastCallResult = XR_CALL( m_xrDispatchTable.xrDestroySpace( m_xrViewSpace ), m_pLogger, false );
 			
 		// Destroy OpenXR Reference Space
 		if ( m_xrSpace != XR_NULL_HANDLE )
-			m_xrLastCallResult = XR_CALL( xrDestroySpace( m_xrSpace ), m_pLogger, false );
+			m_xrLastCallResult = XR_CALL( m_xrDispatchTable.xrDestroySpace( m_xrSpace ), m_pLogger, false );
 
 		// Destroy OpenXR Session
 		if ( m_xrSession != XR_NULL_HANDLE )
-			m_xrLastCallResult = XR_CALL( xrDestroySession( m_xrSession ), m_pLogger, false );
+			m_xrLastCallResult = XR_CALL( m_xrDispatchTable.xrDestroySession( m_xrSession ), m_pLogger, false );
 
 		// Destroy OpenXR Instance
 		if ( m_xrInstance != XR_NULL_HANDLE )
-			m_xrLastCallResult = XR_CALL( xrDestroyInstance( m_xrInstance ), m_pLogger, false );
+			m_xrLastCallResult = XR_CALL( m_xrDispatchTable.xrDestroyInstance( m_xrInstance ), m_pLogger, false );
+
+		// Write out any remaining per-frame messages
+		if ( m_pXRDeferredLog )
+			delete m_pXRDeferredLog;
 
 		spdlog::shutdown();
 	}
@@ -133,6 +179,12 @@ namespace OpenXRProvider
 
 		m_xrLastCallResult = XR_CALL( xrCreateInstance( &xrInstanceCreateInfo, &m_xrInstance ), m_pLogger, true );
 
+		// Retrieve the instance's functions once, everything after this calls through the dispatch table
+		m_xrLastCallResult = XR_CALL( m_xrDispatchTable.Load( m_xrInstance ), m_pLogger, true );
+
+		// Bridge between the runtime's clock and the host's steady clock
+		m_pXRClock = new XRClock( m_xrInstance, &m_xrDispatchTable, m_pLogger );
+
 		m_pLogger->info( "..." );
 		m_pLogger->info( "XR Instance created: Handle {} with {} extension(s) enabled", ( uint64_t )m_xrInstance, nNumEnxtesions );
 		m_pLogger->info(
@@ -170,7 +222,11 @@ namespace OpenXRProvider
 		// (1) Create a session (app communication instance to render frames or send/receive input to/from the runtime)
 		// ========================================================================
 
-		m_pXRGraphicsAPI = new XRGraphicsAPI( &m_xrInstance, &m_xrSystemId, pXRAppGraphicsInfo, &m_xrSession, &m_xrLastCallResult );
+		// Keep the graphics info in case the session has to be recreated
+		if ( !m_pXRAppGraphicsInfo )
+			m_pXRAppGraphicsInfo = new XRAppGraphicsInfo( *pXRAppGraphicsInfo );
+
+		m_pXRGraphicsAPI = new XRGraphicsAPI( &m_xrInstance, &m_xrSystemId, pXRAppGraphicsInfo, &m_xrSession, &m_xrLastCallResult, &m_xrDispatchTable );
 
 		if ( m_xrLastCallResult != XR_SUCCESS )
 		{
@@ -195,9 +251,27 @@ namespace OpenXRProvider
 		xrReferenceSpaceCreateInfo.poseInReferenceSpace = xrPose;
 		xrReferenceSpaceCreateInfo.referenceSpaceType = m_xrReferenceSpaceType;
 
-		m_xrLastCallResult = XR_CALL( xrCreateReferenceSpace( m_xrSession, &xrReferenceSpaceCreateInfo, &m_xrSpace ), m_pLogger, true );
+		m_xrLastCallResult = XR_CALL( m_xrDispatchTable.xrCreateReferenceSpace( m_xrSession, &xrReferenceSpaceCreateInfo, &m_xrSpace ), m_pLogger, true );
 		m_pLogger->info( "XR Reference Space for this app successfully created (Handle {})", ( uint64_t )m_xrSpace );
 
+		// Headset pose, located along with all other registered spaces
+		xrReferenceSpaceCreateInfo.referenceSpaceType = XR_REFERENCE_SPACE_TYPE_VIEW;
+		m_xrLastCallResult = XR_CALL( m_xrDispatchTable.xrCreateReferenceSpace( m_xrSession, &xrReferenceSpaceCreateInfo, &m_xrViewSpace ), m_pLogger, true );
+
+		// Register the spaces (keeping their slots if the session is being recreated)
+		if ( !m_pXRSpaceRegistry )
+		{
+			m_pXRSpaceRegistry = new XRSpaceRegistry( &m_xrDispatchTable, m_pLogger );
+			m_nViewSpaceSlot = m_pXRSpaceRegistry->AddSpace( m_xrViewSpace );
+		}
+		else
+		{
+			m_pXRSpaceRegistry->SetSpace( m_nViewSpaceSlot, m_xrViewSpace );
+		}
+
+		m_pXRSpaceRegistry->SetSession( m_xrSession );
+		m_pXRSpaceRegistry->SetBaseSpace( m_xrSpace );
+
 		// ========================================================================
 		// (3) Keep track of instance extensions that's not render or input based
 		// ========================================================================
@@ -232,14 +306,27 @@ namespace OpenXRProvider
 		xrSystemGetInfo.type = XR_TYPE_SYSTEM_GET_INFO;
 		xrSystemGetInfo.formFactor = XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY;
 
-		m_xrLastCallResult = XR_CALL( xrGetSystem( m_xrInstance, &xrSystemGetInfo, &m_xrSystemId ), m_pLogger, true );
+		m_xrLastCallResult = XR_CALL( m_xrDispatchTable.xrGetSystem( m_xrInstance, &xrSystemGetInfo, &m_xrSystemId ), m_pLogger, true );
 
 		// Log user's system info
-		m_xrLastCallResult = XR_CALL( xrGetSystemProperties( m_xrInstance, m_xrSystemId, &m_xrSystemProperties ), m_pLogger, true );
+		m_xrLastCallResult = XR_CALL( m_xrDispatchTable.xrGetSystemProperties( m_xrInstance, m_xrSystemId, &m_xrSystemProperties ), m_pLogger, true );
 
 		std::string systemName = m_xrSystemProperties.systemName;
 		m_pLogger->info( "Active runtime: {} (Vendor Id {}) ", m_xrSystemProperties.systemName, m_xrSystemProperties.vendorId );
 
+		// Check if what was negotiated with this runtime on the last launch can be reused
+		if ( m_pXRCapabilityCache )
+		{
+			XrInstanceProperties xrInstanceProperties { XR_TYPE_INSTANCE_PROPERTIES };
+			m_xrLastCallResult = XR_CALL( m_xrDispatchTable.xrGetInstanceProperties( m_xrInstance, &xrInstanceProperties ), m_pLogger, false );
+
+			if ( m_xrLastCallResult == XR_SUCCESS &&
+				 m_pXRCapabilityCache->ValidateRuntime( xrInstanceProperties.runtimeName, xrInstanceProperties.runtimeVersion, m_xrSystemProperties.vendorId ) )
+				m_pLogger->info( "Runtime capabilities unchanged since the last launch. Using capability cache" );
+			else
+				m_pLogger->info( "Runtime capabilities changed since the last launch. Capability cache will be rebuilt" );
+		}
+
 		return m_xrLastCallResult;
 	}
 
@@ -260,7 +347,13 @@ namespace OpenXRProvider
 		m_xrLastCallResult =
 			XR_CALL( xrEnumerateInstanceExtensionProperties( nullptr, nExtensionCount, &nExtensionCount, vExtensions.data() ), m_pLogger, false );
 
-		m_pLogger->info( "Runtime supports the following extensions (* = will be enabled):" );
+		// Only log the full list if it changed since the last launch
+		bool bLogExtensions = !m_pXRCapabilityCache || !m_pXRCapabilityCache->ValidateExtensions( vExtensions );
+
+		if ( bLogExtensions )
+			m_pLogger->info( "Runtime supports the following extensions (* = will be enabled):" );
+		else
+			m_pLogger->info( "Runtime supports {} extensions, unchanged since the last launch. Enabled extensions:", nExtensionCount );
 		bool bEnable = false;
 		for ( uint32_t i = 0; i < nExtensionCount; ++i )
 		{
@@ -285,6 +378,46 @@ namespace OpenXRProvider
 
 				bEnable = true;
 			}
+
+			// Check for cylinder layer extension
+			else if ( strcmp( XR_KHR_COMPOSITION_LAYER_CYLINDER_EXTENSION_NAME, &vExtensions[ i ].extensionName[ 0 ] ) == 0 )
+			{
+				vXRExtensions.push_back( XR_KHR_COMPOSITION_LAYER_CYLINDER_EXTENSION_NAME );
+				m_pLogger->info( "*{}. {} version {}", i + 1, vExtensions[ i ].extensionName, vExtensions[ i ].extensionVersion );
+				m_bIsCylinderLayerSupported = true;
+
+				bEnable = true;
+			}
+
+			// Check for equirect layer extension
+			else if ( strcmp( XR_KHR_COMPOSITION_LAYER_EQUIRECT_EXTENSION_NAME, &vExtensions[ i ].extensionName[ 0 ] ) == 0 )
+			{
+				vXRExtensions.push_back( XR_KHR_COMPOSITION_LAYER_EQUIRECT_EXTENSION_NAME );
+				m_pLogger->info( "*{}. {} version {}", i + 1, vExtensions[ i ].extensionName, vExtensions[ i ].extensionVersion );
+				m_bIsEquirectLayerSupported = true;
+
+				bEnable = true;
+			}
+#ifdef XR_KHR_locate_spaces
+			// Check for batched space location (all registered spaces located in one call per frame)
+			else if ( strcmp( XR_KHR_LOCATE_SPACES_EXTENSION_NAME, &vExtensions[ i ].extensionName[ 0 ] ) == 0 )
+			{
+				vXRExtensions.push_back( XR_KHR_LOCATE_SPACES_EXTENSION_NAME );
+				m_pLogger->info( "*{}. {} version {}", i + 1, vExtensions[ i ].extensionName, vExtensions[ i ].extensionVersion );
+				m_bIsLocateSpacesSupported = true;
+
+				bEnable = true;
+			}
+#endif
+			// Check for the platform's time conversion extension (XrTime to and from the host clock)
+			else if ( s_TimeConversionExtensionName[ 0 ] != '\0' && strcmp( s_TimeConversionExtensionName, &vExtensions[ i ].extensionName[ 0 ] ) == 0 )
+			{
+				vXRExtensions.push_back( s_TimeConversionExtensionName );
+				m_pLogger->info( "*{}. {} version {}", i + 1, vExtensions[ i ].extensionName, vExtensions[ i ].extensionVersion );
+				m_bIsTimeConversionSupported = true;
+
+				bEnable = true;
+			}
 			else
 			{
 				// Otherwise, check if this extension was requested by the app
@@ -300,6 +433,7 @@ namespace OpenXRProvider
 						vXRExtensions.push_back( xrRequestedExtension->GetExtensionName() );
 
 						xrRequestedExtension->IsActive( true );
+						xrRequestedExtension->m_pXRDispatchTable = &m_xrDispatchTable;
 						m_vXRAppEnabledExtensions.push_back( m_vAppRequestedExtensions[ j ] );
 
 						m_pLogger->info( "*{}. {} version {}", i + 1, vExtensions[ i ].extensionName, vExtensions[ i ].extensionVersion );
@@ -310,28 +444,175 @@ namespace OpenXRProvider
 				}
 			}
 			
-			if ( !bEnable )
+			if ( !bEnable && bLogExtensions )
 				m_pLogger->info( "{}. {} version {}", i + 1, vExtensions[ i ].extensionName, vExtensions[ i ].extensionVersion );
 			bEnable = false;
 		}
 	}
 
-	void XRCore::PollXREvents()
+	uint32_t XRCore::PollXREvents( uint32_t nMaxEvents )
 	{
 		assert( m_xrInstance );
-		assert( m_xrSession );
 
-		XrEventDataBuffer xrEvent { XR_TYPE_EVENT_DATA_BUFFER };
-		xrEvent.next = nullptr;
+		XrEventDataBuffer xrEvent;
+		uint32_t nEvents = 0;
+
+		// Drain the queue so a burst of events (e.g. a state change with a profile change) is handled in a single frame
+		while ( nMaxEvents == 0 || nEvents < nMaxEvents )
+		{
+			xrEvent.type = XR_TYPE_EVENT_DATA_BUFFER;
+			xrEvent.next = nullptr;
 
-		m_xrLastCallResult = XR_CALL_SILENT( xrPollEvent( m_xrInstance, &xrEvent ), m_pLogger );
+			m_xrLastCallResult = XR_CALL_DEFERRED( m_xrDispatchTable.xrPollEvent( m_xrInstance, &xrEvent ), m_pXRDeferredLog );
 
-		// Stop evaluating if there's no event returned or the call fails
-		if ( xrEvent.type == XR_TYPE_EVENT_DATA_BUFFER )
+			// Stop evaluating if there's no event returned or the call fails
+			if ( m_xrLastCallResult != XR_SUCCESS )
+				break;
+
+			// Track the session lifecycle before the app sees the event
+			if ( xrEvent.type == XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED )
+				UpdateSessionState( *reinterpret_cast< const XrEventDataSessionStateChanged * >( &xrEvent ) );
+
+			// Execute any callbacks registered for this event
+			ExecuteCallbacks( xrEvent );
+			++nEvents;
+		}
+
+		// Try to recreate a lost session (retried on every poll until the xr system is available again)
+		if ( m_bSessionLost.load( std::memory_order_relaxed ) )
+			RecreateSession();
+
+		return nEvents;
+	}
+
+	void XRCore::UpdateSessionState( const XrEventDataSessionStateChanged &xrEventDataSessionStateChanged )
+	{
+		// Ignore state changes still queued for a session that has already been replaced
+		if ( xrEventDataSessionStateChanged.session != m_xrSession )
 			return;
 
-		// Execute any callbacks registered for this event
-		ExecuteCallbacks( xrEvent );
+		m_xrSessionState = xrEventDataSessionStateChanged.state;
+
+		switch ( m_xrSessionState )
+		{
+			case XR_SESSION_STATE_READY:
+				XRBeginSession();
+				break;
+
+			case XR_SESSION_STATE_STOPPING:
+				XREndSession();
+				break;
+
+			case XR_SESSION_STATE_LOSS_PENDING:
+				m_pLogger->warn( "XR Session (Handle {}) will be lost. It will be recreated once the xr system is available", ( uint64_t )m_xrSession );
+				m_bSessionLost.store( true, std::memory_order_relaxed );
+				break;
+
+			default:
+				break;
+		}
+	}
+
+	bool XRCore::RecreateSession()
+	{
+		assert( m_pXRAppGraphicsInfo );
+
+		// ========================================================================
+		// (1) Check if the xr system is available again (e.g. headset woke up) without blocking the app
+		// ========================================================================
+		XrSystemGetInfo xrSystemGetInfo { XR_TYPE_SYSTEM_GET_INFO };
+		xrSystemGetInfo.formFactor = XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY;
+
+		XrSystemId xrSystemId = XR_NULL_SYSTEM_ID;
+		m_xrLastCallResult = m_xrDispatchTable.xrGetSystem( m_xrInstance, &xrSystemGetInfo, &xrSystemId );
+
+		if ( m_xrLastCallResult != XR_SUCCESS )
+		{
+			XR_LOG_DEFERRED( m_pXRDeferredLog, spdlog::level::info, 1, "Waiting for the xr system to recreate the session ({})", XrEnumToString( m_xrLastCallResult ) );
+			return false;
+		}
+
+		// A different system id means a different device, everything negotiated for the old one (formats, view configs) would be stale
+		if ( xrSystemId != m_xrSystemId )
+		{
+			m_pLogger->error( "XR System changed (Id {} to {}). The OpenXR Provider must be recreated", ( uint64_t )m_xrSystemId, ( uint64_t )xrSystemId );
+			return false;
+		}
+
+		m_pLogger->info( "Recreating XR Session (Handle {})", ( uint64_t )m_xrSession );
+
+		// ========================================================================
+		// (2) Release everything created from the old session, then the session itself
+		// ========================================================================
+		for ( const XRSessionCallback &xrSessionCallback : m_vXRSessionCallbacks )
+			xrSessionCallback.callback( SESSION_EVENT_DESTROYING, xrSessionCallback.userContext );
+
+		if ( m_pXRHandTracking )
+			m_pXRHandTracking->DestroyHandTrackers();
+
+		if ( m_xrViewSpace != XR_NULL_HANDLE )
+			XR_CALL_SILENT( m_xrDispatchTable.xrDestroySpace( m_xrViewSpace ), m_pLogger );
+
+		if ( m_xrSpace != XR_NULL_HANDLE )
+			XR_CALL_SILENT( m_xrDispatchTable.xrDestroySpace( m_xrSpace ), m_pLogger );
+
+		if ( m_xrSession != XR_NULL_HANDLE )
+			XR_CALL_SILENT( m_xrDispatchTable.xrDestroySession( m_xrSession ), m_pLogger );
+
+		delete m_pXRGraphicsAPI;
+		m_pXRGraphicsAPI = nullptr;
+		m_xrSpace = XR_NULL_HANDLE;
+		m_xrViewSpace = XR_NULL_HANDLE;
+		m_xrSession = XR_NULL_HANDLE;
+
+		if ( m_pXRSpaceRegistry )
+		{
+			m_pXRSpaceRegistry->SetSpace( m_nViewSpaceSlot, XR_NULL_HANDLE );
+			m_pXRSpaceRegistry->SetSession( XR_NULL_HANDLE );
+			m_pXRSpaceRegistry->SetBaseSpace( XR_NULL_HANDLE );
+		}
+		m_xrSessionState = XR_SESSION_STATE_UNKNOWN;
+		m_bSessionRunning = false;
+
+		// ========================================================================
+		// (3) Create a new session and reference space on the same instance and system
+		// ========================================================================
+		try
+		{
+			WorldInit( m_pXRAppGraphicsInfo );
+		}
+		catch ( const std::exception & )
+		{
+			// Logged by WorldInit, try again on the next poll
+			return false;
+		}
+
+		m_bSessionLost.store( false, std::memory_order_relaxed );
+
+		// ========================================================================
+		// (4) Rebuild what depends on the session. It begins once the runtime reports it ready
+		// ========================================================================
+		for ( const XRSessionCallback &xrSessionCallback : m_vXRSessionCallbacks )
+			xrSessionCallback.callback( SESSION_EVENT_CREATED, xrSessionCallback.userContext );
+
+		m_pLogger->info( "XR Session recreated (Handle {})", ( uint64_t )m_xrSession );
+		return true;
+	}
+
+	void XRCore::RegisterSessionCallback( XRSessionCallback xrSessionCallback )
+	{
+		assert( xrSessionCallback.callback );
+		m_vXRSessionCallbacks.push_back( xrSessionCallback );
+	}
+
+	void XRCore::DeregisterSessionCallback( void *pUserContext )
+	{
+		m_vXRSessionCallbacks.erase(
+			std::remove_if(
+				m_vXRSessionCallbacks.begin(),
+				m_vXRSessionCallbacks.end(),
+				[ pUserContext ]( const XRSessionCallback &xrSessionCallback ) { return xrSessionCallback.userContext == pUserContext; } ),
+			m_vXRSessionCallbacks.end() );
 	}
 
 	XrResult XRCore::XRBeginSession()
@@ -342,14 +623,28 @@ namespace OpenXRProvider
 			return m_xrLastCallResult;
 		}
 
+		if ( m_bSessionRunning )
+			return XR_SUCCESS;
+
 		XrSessionBeginInfo xrSessionBeginInfo { XR_TYPE_SESSION_BEGIN_INFO };
 		xrSessionBeginInfo.primaryViewConfigurationType = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
 
-		m_xrLastCallResult = XR_CALL_SILENT( xrBeginSession( m_xrSession, &xrSessionBeginInfo ), m_pLogger );
+		m_xrLastCallResult = XR_CALL_SILENT( m_xrDispatchTable.xrBeginSession( m_xrSession, &xrSessionBeginInfo ), m_pLogger );
+		CheckSessionLost( m_xrLastCallResult );
+
+		if ( m_xrLastCallResult == XR_SUCCESS )
+		{
+			m_bSessionRunning = true;
+			m_pLogger->info( "XR Session started (Handle {})", ( uint64_t )m_xrSession );
+
+			for ( const XRSessionCallback &xrSessionCallback : m_vXRSessionCallbacks )
+				xrSessionCallback.callback( SESSION_EVENT_READY, xrSessionCallback.userContext );
+		}
+
 		return m_xrLastCallResult;
 	}
 
-	XrResult XRCore::XREndSession() 
+	XrResult XRCore::XREndSession()
 	{
 		if ( m_xrSession == XR_NULL_HANDLE )
 		{
@@ -357,17 +652,23 @@ namespace OpenXRProvider
 			return m_xrLastCallResult;
 		}
 
-		m_xrLastCallResult = XR_CALL_SILENT( xrEndSession( m_xrSession ), m_pLogger );
+		if ( !m_bSessionRunning )
+			return XR_SUCCESS;
+
+		// Nothing may be inside a frame function while the session ends
+		for ( const XRSessionCallback &xrSessionCallback : m_vXRSessionCallbacks )
+			xrSessionCallback.callback( SESSION_EVENT_STOPPING, xrSessionCallback.userContext );
+
+		m_xrLastCallResult = XR_CALL_SILENT( m_xrDispatchTable.xrEndSession( m_xrSession ), m_pLogger );
+		CheckSessionLost( m_xrLastCallResult );
+
+		// The session is no longer running either way (a lost session can't be ended)
+		m_bSessionRunning = false;
+		m_pLogger->info( "XR Session ended (Handle {}) with result {}", ( uint64_t )m_xrSession, XrEnumToString( m_xrLastCallResult ) );
+
 		return m_xrLastCallResult;
 	}
 
-	void XRCore::ExecuteCallbacks( XrEventDataBuffer xrEvent )
-	{
-		for each( XRCallback * xrCallback in m_pXREventHandler->GetXRCallbacks() )
-			{
-				if ( xrCallback->type == xrEvent.type || xrCallback->type == XR_TYPE_EVENT_DATA_BUFFER )
-					xrCallback->callback( xrEvent );
-			}
-	}
+	void XRCore::ExecuteCallbacks( const XrEventDataBuffer &xrEvent ) { m_pXREventHandler->Dispatch( xrEvent ); }
 
 } // namespace OpenXRProvider
@@ -0,0 +1,259 @@
+/* Copyright 2021 Rune Berg (GitHub: https://github.com/1runeberg, Twitter: https://twitter.com/1runeberg)
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *  BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ *  GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+ *  DAMAGE.
+ *
+ */
+
+#include <XRDeferredLog.h>
+
+namespace OpenXRProvider
+{
+	/// Source of unique deferred log ids
+	static std::atomic< uint64_t > s_nNextDeferredLogId { 1 };
+
+	/// Number of deferred logs whose ring each thread keeps at hand
+	static const uint32_t k_nThreadRingCacheSize = 4;
+
+	/// The calling thread's most recently used rings, keyed by the id of the deferred log that owns them
+	thread_local struct
+	{
+		uint64_t OwnerId[ k_nThreadRingCacheSize ] = {};
+		void *Ring[ k_nThreadRingCacheSize ] = {};
+		uint32_t NextSlot = 0;
+	} t_xrThreadRings;
+
+	XRDeferredLog::XRDeferredLog( std::shared_ptr< spdlog::logger > pLogger )
+		: m_nId( s_nNextDeferredLogId.fetch_add( 1 ) )
+		, m_pXRLogger( pLogger )
+	{
+		if ( !m_pXRLogger )
+			throw std::runtime_error( "A logger is required to create a deferred log" );
+
+		m_bIsRunning = true;
+		m_LogThread = std::thread( &XRDeferredLog::LogLoop, this );
+	}
+
+	XRDeferredLog::~XRDeferredLog()
+	{
+		{
+			std::lock_guard< std::mutex > lock( m_LogSignalMutex );
+			m_bIsRunning = false;
+		}
+
+		m_LogSignal.notify_one();
+
+		if ( m_LogThread.joinable() )
+			m_LogThread.join();
+
+		// Write out anything queued after the log thread's last pass
+		Drain();
+	}
+
+	bool XRDeferredLog::IsRateLimited( XRLogSite &xrLogSite )
+	{
+		if ( xrLogSite.MaxPerSecond == 0 )
+			return false;
+
+		// Start a new window every second. Losing the race to another thread just means that thread started it
+		int64_t nNow = std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now().time_since_epoch() ).count();
+		int64_t nWindowStart = xrLogSite.WindowStart.load( std::memory_order_relaxed );
+
+		if ( nNow - nWindowStart >= 1000000000 && xrLogSite.WindowStart.compare_exchange_strong( nWindowStart, nNow, std::memory_order_relaxed ) )
+			xrLogSite.WindowCount.store( 0, std::memory_order_relaxed );
+
+		if ( xrLogSite.WindowCount.fetch_add( 1, std::memory_order_relaxed ) < xrLogSite.MaxPerSecond )
+			return false;
+
+		xrLogSite.SuppressedCount.fetch_add( 1, std::memory_order_relaxed );
+		return true;
+	}
+
+	void XRDeferredLog::Enqueue( const XRLogEntry &xrLogEntry )
+	{
+		XRLogRing *pRing = GetThreadRing();
+
+		if ( !pRing->Push( xrLogEntry ) )
+			m_nDroppedCount.fetch_add( 1, std::memory_order_relaxed );
+
+		// Only wake the log thread if it's asleep, the fence pairs with the one in HasWaitingMessages so either this thread sees it waiting
+		// or the log thread sees the message
+		std::atomic_thread_fence( std::memory_order_seq_cst );
+		if ( m_bIsLogThreadWaiting.load( std::memory_order_relaxed ) )
+		{
+			{
+				std::lock_guard< std::mutex > lock( m_LogSignalMutex );
+			}
+
+			m_LogSignal.notify_one();
+		}
+	}
+
+	XRDeferredLog::XRLogRing *XRDeferredLog::GetThreadRing()
+	{
+		for ( uint32_t i = 0; i < k_nThreadRingCacheSize; i++ )
+		{
+			if ( t_xrThreadRings.OwnerId[ i ] == m_nId )
+				return static_cast< XRLogRing * >( t_xrThreadRings.Ring[ i ] );
+		}
+
+		// First message from this thread, or its ring was pushed out of the cache by other deferred logs
+		XRLogRing *pRing = nullptr;
+		{
+			std::lock_guard< std::mutex > lock( m_RingsMutex );
+
+			std::thread::id threadId = std::this_thread::get_id();
+			for ( size_t i = 0; i < m_vRingOwners.size(); i++ )
+			{
+				if ( m_vRingOwners[ i ] == threadId )
+				{
+					pRing = m_vRings[ i ].get();
+					break;
+				}
+			}
+
+			if ( !pRing )
+			{
+				m_vRings.push_back( std::make_unique< XRLogRing >() );
+				m_vRingOwners.push_back( threadId );
+				pRing = m_vRings.back().get();
+			}
+		}
+
+		uint32_t nSlot = t_xrThreadRings.NextSlot;
+		t_xrThreadRings.NextSlot = ( nSlot + 1 ) % k_nThreadRingCacheSize;
+		t_xrThreadRings.OwnerId[ nSlot ] = m_nId;
+		t_xrThreadRings.Ring[ nSlot ] = pRing;
+
+		return pRing;
+	}
+
+	void XRDeferredLog::Write( const XRLogEntry &xrLogEntry )
+	{
+		fmt::dynamic_format_arg_store< fmt::format_context > fmtArgs;
+
+		for ( uint32_t i = 0; i < xrLogEntry.ArgCount; i++ )
+		{
+			const XRLogArg &xrLogArg = xrLogEntry.Args[ i ];
+
+			switch ( xrLogArg.Type )
+			{
+				case LOG_ARG_INT:
+					fmtArgs.push_back( xrLogArg.Int );
+					break;
+
+				case LOG_ARG_UINT:
+					fmtArgs.push_back( xrLogArg.UInt );
+					break;
+
+				case LOG_ARG_DOUBLE:
+					fmtArgs.push_back( xrLogArg.Double );
+					break;
+
+				case LOG_ARG_STRING:
+					fmtArgs.push_back( xrLogArg.String ? xrLogArg.String : "(null)" );
+					break;
+			}
+		}
+
+		std::string sMessage;
+		try
+		{
+			sMessage = fmt::vformat( xrLogEntry.Site->Format, fmtArgs );
+		}
+		catch ( const std::exception & )
+		{
+			sMessage = xrLogEntry.Site->Format;
+		}
+
+		if ( xrLogEntry.SuppressedCount > 0 )
+			sMessage.append( fmt::format( " ({} similar messages suppressed)", xrLogEntry.SuppressedCount ) );
+
+		m_pXRLogger->log( xrLogEntry.Time, spdlog::source_loc {}, xrLogEntry.Site->Level, sMessage );
+	}
+
+	bool XRDeferredLog::Drain()
+	{
+		bool bHasWritten = false;
+		XRLogEntry xrLogEntry;
+
+		// Only copy the ring pointers under the lock, so a thread logging its first message never waits on formatting or the sinks.
+		// Rings are never removed before the deferred log is destroyed, so the pointers stay valid
+		{
+			std::lock_guard< std::mutex > lock( m_RingsMutex );
+			if ( m_vDrainRings.size() != m_vRings.size() )
+			{
+				m_vDrainRings.clear();
+				for ( std::unique_ptr< XRLogRing > &pRing : m_vRings )
+					m_vDrainRings.push_back( pRing.get() );
+			}
+		}
+
+		for ( XRLogRing *pRing : m_vDrainRings )
+		{
+			while ( pRing->Pop( xrLogEntry ) )
+			{
+				Write( xrLogEntry );
+				bHasWritten = true;
+			}
+		}
+
+		uint32_t nDroppedCount = m_nDroppedCount.load( std::memory_order_relaxed );
+		if ( nDroppedCount != m_nReportedDroppedCount )
+		{
+			m_pXRLogger->warn( "{} log messages were dropped (log ring full)", nDroppedCount - m_nReportedDroppedCount );
+			m_nReportedDroppedCount = nDroppedCount;
+		}
+
+		if ( bHasWritten )
+			m_pXRLogger->flush();
+
+		return bHasWritten;
+	}
+
+	bool XRDeferredLog::HasWaitingMessages()
+	{
+		std::atomic_thread_fence( std::memory_order_seq_cst );
+
+		std::lock_guard< std::mutex > lock( m_RingsMutex );
+		for ( std::unique_ptr< XRLogRing > &pRing : m_vRings )
+		{
+			if ( pRing->GetSize() > 0 )
+				return true;
+		}
+
+		return false;
+	}
+
+	void XRDeferredLog::LogLoop()
+	{
+		while ( m_bIsRunning )
+		{
+			// Keep going while there is something to write so bursts are drained quickly
+			if ( Drain() )
+				continue;
+
+			// Sleep until a message is queued, waking up now and then as a fallback for the dropped message report
+			std::unique_lock< std::mutex > lock( m_LogSignalMutex );
+			m_bIsLogThreadWaiting.store( true, std::memory_order_relaxed );
+			m_LogSignal.wait_for( lock, std::chrono::milliseconds( k_nDeferredLogIdleWaitMs ), [ & ] { return !m_bIsRunning || HasWaitingMessages(); } );
+			m_bIsLogThreadWaiting.store( false, std::memory_order_relaxed );
+		}
+	}
+} // namespace OpenXRProvider
@@ -21,20 +21,34 @@
  *
  */
 
+
 #pragma once
 
-#include <input/XRInputProfile_HTCVive.h>
+#include <XRDispatchTable.h>
 
 namespace OpenXRProvider
 {
-	XRInputProfile_HTCVive::XRInputProfile_HTCVive( std::shared_ptr< spdlog::logger > pLogger )
-		: XRBaseInput( pLogger )
+	XrResult XRDispatchTable::Load( XrInstance xrInstance )
 	{
-	}
+		XrResult xrResult = XR_SUCCESS;
 
-	XRInputProfile_HTCVive::~XRInputProfile_HTCVive()
-	{
+		// The table's own xrGetInstanceProcAddr member is being filled in, so retrieve through the loader's
+#define XR_PROVIDER_DISPATCH_LOAD_CORE( name, version )                                                                                                       \
+		{                                                                                                                                                       \
+			XrResult xrLoadResult = ::xrGetInstanceProcAddr( xrInstance, "xr" #name, ( PFN_xrVoidFunction * )&xr##name );                                         \
+			if ( xrResult == XR_SUCCESS && xrLoadResult != XR_SUCCESS )                                                                                         \
+				xrResult = xrLoadResult;                                                                                                                        \
+		}
+#define XR_PROVIDER_DISPATCH_LOAD_EXTENSION( name, extension )                                                                                                \
+		if ( ::xrGetInstanceProcAddr( xrInstance, "xr" #name, ( PFN_xrVoidFunction * )&xr##name ) != XR_SUCCESS )                                             \
+			xr##name = nullptr;
 
-	}
+		XR_PROVIDER_LIST_FUNCTIONS_CORE( XR_PROVIDER_DISPATCH_LOAD_CORE )
+		XR_PROVIDER_LIST_FUNCTIONS_EXTENSIONS( XR_PROVIDER_DISPATCH_LOAD_EXTENSION )
+
+#undef XR_PROVIDER_DISPATCH_LOAD_CORE
+#undef XR_PROVIDER_DISPATCH_LOAD_EXTENSION
 
+		return xrResult;
+	}
 } // namespace OpenXRProvider
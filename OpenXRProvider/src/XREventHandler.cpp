@@ -29,5 +29,72 @@ namespace OpenXRProvider
 {
 	XREventHandler::XREventHandler( std::shared_ptr< spdlog::logger > pLogger ) : XRBase( pLogger )	{}
 
-	XREventHandler::~XREventHandler() { m_pXRCallbacks.clear(); }
+	XREventHandler::~XREventHandler()
+	{
+		for ( std::vector< XRCallback * > &vXRCallbacks : m_vXRCallbacks )
+			vXRCallbacks.clear();
+
+		for ( std::vector< XREventRingSubscription > &vXREventRings : m_vXREventRings )
+			vXREventRings.clear();
+	}
+
+	void XREventHandler::RegisterCallback( XRCallback *pXRCallback )
+	{
+		assert( pXRCallback );
+		m_vXRCallbacks[ GetEventSlot( pXRCallback->type ) ].push_back( pXRCallback );
+	}
+
+	void XREventHandler::DeregisterCallback( XRCallback *pXRCallback )
+	{
+		assert( pXRCallback );
+		std::vector< XRCallback * > &vXRCallbacks = m_vXRCallbacks[ GetEventSlot( pXRCallback->type ) ];
+		vXRCallbacks.erase( std::remove( vXRCallbacks.begin(), vXRCallbacks.end(), pXRCallback ), vXRCallbacks.end() );
+	}
+
+	void XREventHandler::RegisterEventRing( XREventRing *pXREventRing, const std::vector< XrStructureType > &vEventTypes )
+	{
+		assert( pXREventRing );
+
+		for ( XrStructureType xrEventType : vEventTypes )
+			m_vXREventRings[ GetEventSlot( xrEventType ) ].push_back( { xrEventType, pXREventRing } );
+	}
+
+	void XREventHandler::DeregisterEventRing( XREventRing *pXREventRing )
+	{
+		for ( std::vector< XREventRingSubscription > &vXREventRings : m_vXREventRings )
+		{
+			vXREventRings.erase(
+				std::remove_if(
+					vXREventRings.begin(),
+					vXREventRings.end(),
+					[ pXREventRing ]( const XREventRingSubscription &xrSubscription ) { return xrSubscription.Ring == pXREventRing; } ),
+				vXREventRings.end() );
+		}
+	}
+
+	void XREventHandler::Dispatch( const XrEventDataBuffer &xrEvent )
+	{
+		DispatchSlot( GetEventSlot( xrEvent.type ), xrEvent );
+		DispatchSlot( GetEventSlot( XR_TYPE_EVENT_DATA_BUFFER ), xrEvent );
+	}
+
+	void XREventHandler::DispatchSlot( uint32_t nSlot, const XrEventDataBuffer &xrEvent )
+	{
+		for ( XRCallback *pXRCallback : m_vXRCallbacks[ nSlot ] )
+		{
+			// Unlisted extension events share a slot, so their type still needs checking
+			if ( nSlot != EVENT_SLOT_OTHER || pXRCallback->type == xrEvent.type )
+				pXRCallback->callback( xrEvent, pXRCallback->userContext );
+		}
+
+		// Copy the event to the other threads' rings, their consumers pop on their own schedule
+		for ( const XREventRingSubscription &xrSubscription : m_vXREventRings[ nSlot ] )
+		{
+			if ( nSlot == EVENT_SLOT_OTHER && xrSubscription.Type != xrEvent.type )
+				continue;
+
+			if ( !xrSubscription.Ring->Push( xrEvent ) )
+				m_nDroppedEventCount.fetch_add( 1, std::memory_order_relaxed );
+		}
+	}
 }
@@ -0,0 +1,235 @@
+/* Copyright 2021 Rune Berg (GitHub: https://github.com/1runeberg, Twitter: https://twitter.com/1runeberg)
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *  BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ *  GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+ *  DAMAGE.
+ *
+ */
+
+
+#pragma once
+
+#include <XRSpaceRegistry.h>
+
+namespace OpenXRProvider
+{
+	XRSpaceRegistry::XRSpaceRegistry( const XRDispatchTable *pXRDispatchTable, std::shared_ptr< spdlog::logger > pLogger )
+		: m_pXRDispatchTable( pXRDispatchTable )
+		, m_pXRLogger( pLogger )
+	{
+		assert( m_pXRDispatchTable );
+
+#ifdef XR_KHR_locate_spaces
+		// Only in the table if the runtime has the extension (enabled by XRCore), otherwise spaces are located one at a time
+		m_pXRLogger->info( "Space registry created ({} space location)", m_pXRDispatchTable->xrLocateSpacesKHR ? "batched" : "per space" );
+#else
+		m_pXRLogger->info( "Space registry created (per space location)" );
+#endif
+	}
+
+	XRSpaceRegistry::~XRSpaceRegistry() {}
+
+	uint32_t XRSpaceRegistry::AddSpace( XrSpace xrSpace )
+	{
+		uint32_t nSlot;
+
+		// Reuse a removed slot if there's one so the location arrays don't grow
+		if ( !m_vFreeSlots.empty() )
+		{
+			nSlot = m_vFreeSlots.back();
+			m_vFreeSlots.pop_back();
+			m_vSpaces[ nSlot ] = xrSpace;
+		}
+		else
+		{
+			nSlot = ( uint32_t )m_vSpaces.size();
+			m_vSpaces.push_back( xrSpace );
+
+			m_xrLocations.Positions.push_back( { 0.f, 0.f, 0.f } );
+			m_xrLocations.Orientations.push_back( { 0.f, 0.f, 0.f, 1.f } );
+			m_xrLocations.LinearVelocities.push_back( { 0.f, 0.f, 0.f } );
+			m_xrLocations.AngularVelocities.push_back( { 0.f, 0.f, 0.f } );
+			m_xrLocations.LocationFlags.push_back( 0 );
+			m_xrLocations.VelocityFlags.push_back( 0 );
+		}
+
+#ifdef XR_KHR_locate_spaces
+		m_bBatchDirty = true;
+#endif
+		return nSlot;
+	}
+
+	void XRSpaceRegistry::SetSpace( uint32_t nSlot, XrSpace xrSpace )
+	{
+		assert( nSlot < m_vSpaces.size() );
+
+		m_vSpaces[ nSlot ] = xrSpace;
+		m_xrLocations.LocationFlags[ nSlot ] = 0;
+		m_xrLocations.VelocityFlags[ nSlot ] = 0;
+
+#ifdef XR_KHR_locate_spaces
+		m_bBatchDirty = true;
+#endif
+	}
+
+	void XRSpaceRegistry::RemoveSpace( uint32_t nSlot )
+	{
+		if ( nSlot >= m_vSpaces.size() )
+			return;
+
+		SetSpace( nSlot, XR_NULL_HANDLE );
+		m_vFreeSlots.push_back( nSlot );
+	}
+
+	uint32_t XRSpaceRegistry::LocateSpaces( XrTime xrTime )
+	{
+		m_xrLocations.Time = xrTime;
+
+		if ( m_xrBaseSpace == XR_NULL_HANDLE )
+			return 0;
+
+#ifdef XR_KHR_locate_spaces
+		if ( m_pXRDispatchTable->xrLocateSpacesKHR && m_xrSession != XR_NULL_HANDLE && LocateSpacesBatched() == XR_SUCCESS )
+		{
+			uint32_t nLocated = 0;
+			for ( XrSpaceLocationFlags nFlags : m_xrLocations.LocationFlags )
+				nLocated += ( nFlags & ( XR_SPACE_LOCATION_POSITION_VALID_BIT | XR_SPACE_LOCATION_ORIENTATION_VALID_BIT ) ) ? 1 : 0;
+
+			return nLocated;
+		}
+#endif
+
+		// No batched location, so locate each space in a single tight loop straight into the result arrays
+		XrSpaceVelocity xrSpaceVelocity { XR_TYPE_SPACE_VELOCITY };
+		XrSpaceLocation xrSpaceLocation { XR_TYPE_SPACE_LOCATION };
+		xrSpaceLocation.next = m_bIncludeVelocities ? &xrSpaceVelocity : nullptr;
+
+		uint32_t nLocated = 0;
+		uint32_t nSlots = ( uint32_t )m_vSpaces.size();
+		for ( uint32_t i = 0; i < nSlots; i++ )
+		{
+			if ( m_vSpaces[ i ] == XR_NULL_HANDLE || m_pXRDispatchTable->xrLocateSpace( m_vSpaces[ i ], m_xrBaseSpace, xrTime, &xrSpaceLocation ) != XR_SUCCESS )
+			{
+				m_xrLocations.LocationFlags[ i ] = 0;
+				m_xrLocations.VelocityFlags[ i ] = 0;
+				continue;
+			}
+
+			m_xrLocations.Positions[ i ] = xrSpaceLocation.pose.position;
+			m_xrLocations.Orientations[ i ] = xrSpaceLocation.pose.orientation;
+			m_xrLocations.LocationFlags[ i ] = xrSpaceLocation.locationFlags;
+
+			if ( m_bIncludeVelocities )
+			{
+				m_xrLocations.LinearVelocities[ i ] = xrSpaceVelocity.linearVelocity;
+				m_xrLocations.AngularVelocities[ i ] = xrSpaceVelocity.angularVelocity;
+				m_xrLocations.VelocityFlags[ i ] = xrSpaceVelocity.velocityFlags;
+			}
+
+			if ( xrSpaceLocation.locationFlags & ( XR_SPACE_LOCATION_POSITION_VALID_BIT | XR_SPACE_LOCATION_ORIENTATION_VALID_BIT ) )
+				nLocated++;
+		}
+
+		return nLocated;
+	}
+
+	bool XRSpaceRegistry::GetPose( uint32_t nSlot, XrPosef &xrPose ) const
+	{
+		if ( nSlot >= m_vSpaces.size() )
+			return false;
+
+		xrPose.position = m_xrLocations.Positions[ nSlot ];
+		xrPose.orientation = m_xrLocations.Orientations[ nSlot ];
+
+		const XrSpaceLocationFlags nValid = XR_SPACE_LOCATION_POSITION_VALID_BIT | XR_SPACE_LOCATION_ORIENTATION_VALID_BIT;
+		return ( m_xrLocations.LocationFlags[ nSlot ] & nValid ) == nValid;
+	}
+
+#ifdef XR_KHR_locate_spaces
+	XrResult XRSpaceRegistry::LocateSpacesBatched()
+	{
+		// ========================================================================
+		// (1) Rebuild the compact list of spaces only when slots changed
+		// ========================================================================
+		if ( m_bBatchDirty )
+		{
+			m_vBatchSpaces.clear();
+			m_vBatchSlots.clear();
+
+			for ( uint32_t i = 0; i < ( uint32_t )m_vSpaces.size(); i++ )
+			{
+				if ( m_vSpaces[ i ] == XR_NULL_HANDLE )
+					continue;
+
+				m_vBatchSpaces.push_back( m_vSpaces[ i ] );
+				m_vBatchSlots.push_back( i );
+			}
+
+			// The per space data structs have no structure type, only the arrays' wrappers do
+			m_vBatchLocations.resize( m_vBatchSpaces.size() );
+			m_vBatchVelocities.resize( m_vBatchSpaces.size() );
+			m_bBatchDirty = false;
+		}
+
+		if ( m_vBatchSpaces.empty() )
+			return XR_SUCCESS;
+
+		// ========================================================================
+		// (2) Locate every space in one call
+		// ========================================================================
+		XrSpaceVelocitiesKHR xrSpaceVelocities { XR_TYPE_SPACE_VELOCITIES_KHR };
+		xrSpaceVelocities.velocityCount = ( uint32_t )m_vBatchVelocities.size();
+		xrSpaceVelocities.velocities = m_vBatchVelocities.data();
+
+		XrSpaceLocationsKHR xrSpaceLocations { XR_TYPE_SPACE_LOCATIONS_KHR };
+		xrSpaceLocations.next = m_bIncludeVelocities ? &xrSpaceVelocities : nullptr;
+		xrSpaceLocations.locationCount = ( uint32_t )m_vBatchLocations.size();
+		xrSpaceLocations.locations = m_vBatchLocations.data();
+
+		XrSpacesLocateInfoKHR xrSpacesLocateInfo { XR_TYPE_SPACES_LOCATE_INFO_KHR };
+		xrSpacesLocateInfo.baseSpace = m_xrBaseSpace;
+		xrSpacesLocateInfo.time = m_xrLocations.Time;
+		xrSpacesLocateInfo.spaceCount = ( uint32_t )m_vBatchSpaces.size();
+		xrSpacesLocateInfo.spaces = m_vBatchSpaces.data();
+
+		XrResult xrResult = m_pXRDispatchTable->xrLocateSpacesKHR( m_xrSession, &xrSpacesLocateInfo, &xrSpaceLocations );
+		if ( xrResult != XR_SUCCESS )
+			return xrResult;
+
+		// ========================================================================
+		// (3) Scatter the results into the slot indexed arrays
+		// ========================================================================
+		for ( size_t i = 0; i < m_vBatchSlots.size(); i++ )
+		{
+			uint32_t nSlot = m_vBatchSlots[ i ];
+			m_xrLocations.Positions[ nSlot ] = m_vBatchLocations[ i ].pose.position;
+			m_xrLocations.Orientations[ nSlot ] = m_vBatchLocations[ i ].pose.orientation;
+			m_xrLocations.LocationFlags[ nSlot ] = m_vBatchLocations[ i ].locationFlags;
+
+			if ( m_bIncludeVelocities )
+			{
+				m_xrLocations.LinearVelocities[ nSlot ] = m_vBatchVelocities[ i ].linearVelocity;
+				m_xrLocations.AngularVelocities[ nSlot ] = m_vBatchVelocities[ i ].angularVelocity;
+				m_xrLocations.VelocityFlags[ nSlot ] = m_vBatchVelocities[ i ].velocityFlags;
+			}
+		}
+
+		return XR_SUCCESS;
+	}
+#endif
+} // namespace OpenXRProvider
@@ -34,27 +34,40 @@ namespace OpenXRProvider
 
 	XRExtHandTracking::~XRExtHandTracking()
 	{
-		PFN_xrDestroyHandTrackerEXT xrDestroyHandTrackerEXT = nullptr;
-		m_xrLastCallResult =
-			XR_CALL( xrGetInstanceProcAddr( m_xrInstance, "xrDestroyHandTrackerEXT", ( PFN_xrVoidFunction * )&xrDestroyHandTrackerEXT ), m_pXRLogger, true );
+		DestroyHandTrackers();
+	}
+
+	void XRExtHandTracking::DestroyHandTrackers()
+	{
+		// Extension was never enabled on an instance
+		if ( !m_pXRDispatchTable || !m_pXRDispatchTable->xrDestroyHandTrackerEXT )
+			return;
 
 		if ( m_HandTracker_Left )
-			m_xrLastCallResult = XR_CALL_SILENT( xrDestroyHandTrackerEXT( m_HandTracker_Left ), m_pXRLogger );
+		{
+			m_xrLastCallResult = XR_CALL_SILENT( m_pXRDispatchTable->xrDestroyHandTrackerEXT( m_HandTracker_Left ), m_pXRLogger );
 
-		if ( m_xrLastCallResult == XR_SUCCESS )
-			m_pXRLogger->info( "Left Hand Tracker destroyed." );
+			if ( m_xrLastCallResult == XR_SUCCESS )
+				m_pXRLogger->info( "Left Hand Tracker destroyed." );
+		}
 
 		if ( m_HandTracker_Right )
-			m_xrLastCallResult = XR_CALL_SILENT( xrDestroyHandTrackerEXT( m_HandTracker_Right ), m_pXRLogger );
+		{
+			m_xrLastCallResult = XR_CALL_SILENT( m_pXRDispatchTable->xrDestroyHandTrackerEXT( m_HandTracker_Right ), m_pXRLogger );
+
+			if ( m_xrLastCallResult == XR_SUCCESS )
+				m_pXRLogger->info( "Right Hand Tracker destroyed." );
+		}
 
-		if ( m_xrLastCallResult == XR_SUCCESS )
-			m_pXRLogger->info( "Right Hand Tracker destroyed." );
+		m_HandTracker_Left = XR_NULL_HANDLE;
+		m_HandTracker_Right = XR_NULL_HANDLE;
 	}
 
 	void XRExtHandTracking::Init( const XrInstance xrInstance, const XrSession xrSession )
 	{
 		assert( xrInstance != XR_NULL_HANDLE );
 		assert( xrSession != XR_NULL_HANDLE );
+		assert( m_pXRDispatchTable && m_pXRDispatchTable->xrCreateHandTrackerEXT && m_pXRDispatchTable->xrLocateHandJointsEXT );
 
 		m_xrInstance = xrInstance;
 		m_xrSession = xrSession;
@@ -65,14 +78,10 @@ namespace OpenXRProvider
 		xrHandTrackerCreateInfo.hand = XR_HAND_LEFT_EXT;
 		xrHandTrackerCreateInfo.handJointSet = XR_HAND_JOINT_SET_DEFAULT_EXT;
 
-		PFN_xrCreateHandTrackerEXT xrCreateHandTrackerEXT = nullptr;
-		m_xrLastCallResult =
-			XR_CALL( xrGetInstanceProcAddr( m_xrInstance, "xrCreateHandTrackerEXT", ( PFN_xrVoidFunction * )&xrCreateHandTrackerEXT ), m_pXRLogger, true );
-
-		m_xrLastCallResult = XR_CALL( xrCreateHandTrackerEXT( xrSession, &xrHandTrackerCreateInfo, &m_HandTracker_Left ), m_pXRLogger, true );
+		m_xrLastCallResult = XR_CALL( m_pXRDispatchTable->xrCreateHandTrackerEXT( xrSession, &xrHandTrackerCreateInfo, &m_HandTracker_Left ), m_pXRLogger, true );
 
 		xrHandTrackerCreateInfo.hand = XR_HAND_RIGHT_EXT;
-		m_xrLastCallResult = XR_CALL( xrCreateHandTrackerEXT( xrSession, &xrHandTrackerCreateInfo, &m_HandTracker_Right ), m_pXRLogger, true );
+		m_xrLastCallResult = XR_CALL( m_pXRDispatchTable->xrCreateHandTrackerEXT( xrSession, &xrHandTrackerCreateInfo, &m_HandTracker_Right ), m_pXRLogger, true );
 
 		// Setup hand joint velocities
 		m_xrVelocities_Left.jointCount = XR_HAND_JOINT_COUNT_EXT;
@@ -89,15 +98,11 @@ namespace OpenXRProvider
 		m_xrLocations_Right.jointCount = XR_HAND_JOINT_COUNT_EXT;
 		m_xrLocations_Right.jointLocations = &m_XRHandJointsData_Right[ 0 ];
 		m_xrLocations_Right.next = nullptr;
-
-		// Setup function locate hand joints function pointer
-		m_xrLastCallResult =
-			XR_CALL( xrGetInstanceProcAddr( m_xrInstance, "xrLocateHandJointsEXT", ( PFN_xrVoidFunction * )&xrLocateHandJointsEXT ), m_pXRLogger, true );
 	}
 
 	void XRExtHandTracking::LocateHandJoints( XrHandEXT eHand, XrSpace xrSpace, XrTime xrTime, XrHandJointsMotionRangeEXT eMotionrange )
 	{
-		assert( xrLocateHandJointsEXT );
+		assert( m_pXRDispatchTable );
 
 		bool bIsLeftHand = eHand == XR_HAND_LEFT_EXT;
 
@@ -128,7 +133,7 @@ namespace OpenXRProvider
 		}
 
 		XR_CALL_SILENT(
-			xrLocateHandJointsEXT(
+			m_pXRDispatchTable->xrLocateHandJointsEXT(
 				bIsLeftHand ? m_HandTracker_Left : m_HandTracker_Right, &xrHandJointsLocateInfo, bIsLeftHand ? &m_xrLocations_Left : &m_xrLocations_Right ),
 			m_pXRLogger );
 	}
@@ -54,11 +54,8 @@ namespace OpenXRProvider
 				break;
 		}
 
-		PFN_xrGetVisibilityMaskKHR xrGetVisibilityMaskKHR = nullptr;
-		m_xrLastCallResult =
-			XR_CALL( xrGetInstanceProcAddr( m_xrInstance, "xrGetVisibilityMaskKHR", ( PFN_xrVoidFunction * )&xrGetVisibilityMaskKHR ), m_pXRLogger, false );
-
-		if ( m_xrLastCallResult != XR_SUCCESS )
+		// Extension function wasn't retrieved from the instance
+		if ( !m_pXRDispatchTable || !m_pXRDispatchTable->xrGetVisibilityMaskKHR )
 			return false;
 
 		// Get index and vertex counts
@@ -67,7 +64,7 @@ namespace OpenXRProvider
 		pXRVisibilityMask.vertexCapacityInput = 0;
 
 		m_xrLastCallResult = XR_CALL_SILENT(
-			xrGetVisibilityMaskKHR( m_xrSession, XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO, eEye == EYE_LEFT ? 0 : 1, xrVisibilityMaskType, &pXRVisibilityMask ),
+			m_pXRDispatchTable->xrGetVisibilityMaskKHR( m_xrSession, XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO, eEye == EYE_LEFT ? 0 : 1, xrVisibilityMaskType, &pXRVisibilityMask ),
 			m_pXRLogger );
 
 		if ( m_xrLastCallResult != XR_SUCCESS )
@@ -102,7 +99,7 @@ namespace OpenXRProvider
 		pXRVisibilityMask.vertices = vXrVertices.data();
 
 		m_xrLastCallResult = XR_CALL_SILENT(
-			xrGetVisibilityMaskKHR( m_xrSession, XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO, eEye == EYE_LEFT ? 0 : 1, xrVisibilityMaskType, &pXRVisibilityMask ),
+			m_pXRDispatchTable->xrGetVisibilityMaskKHR( m_xrSession, XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO, eEye == EYE_LEFT ? 0 : 1, xrVisibilityMaskType, &pXRVisibilityMask ),
 			m_pXRLogger );
 
 		if ( m_xrLastCallResult != XR_SUCCESS )
@@ -0,0 +1,459 @@
+/* Copyright 2021 Rune Berg (GitHub: https://github.com/1runeberg, Twitter: https://twitter.com/1runeberg)
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *  BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ *  GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+ *  DAMAGE.
+ *
+ */
+
+
+#pragma once
+
+#include <fstream>
+#include <sstream>
+
+#include <XRCapabilityCache.h>
+#include <input/XRActionManifest.h>
+
+namespace OpenXRProvider
+{
+	/// Header of a compiled manifest, followed by each record array and the string table in the same order as the counts
+	struct XRManifestFileHeader
+	{
+		uint32_t Magic = 0;
+		uint32_t Version = 0;
+		uint64_t SourceHash = 0;
+		uint32_t ActionSetCount = 0;
+		uint32_t ActionCount = 0;
+		uint32_t SubactionPathCount = 0;
+		uint32_t ProfileCount = 0;
+		uint32_t BindingCount = 0;
+		uint32_t StringBytes = 0;
+	};
+
+	/// Split a manifest line into tokens, a quoted token can have spaces
+	static std::vector< std::string > TokenizeManifestLine( const std::string &sLine )
+	{
+		std::vector< std::string > vTokens;
+		size_t i = 0;
+
+		while ( i < sLine.size() )
+		{
+			if ( isspace( ( unsigned char )sLine[ i ] ) )
+			{
+				i++;
+				continue;
+			}
+
+			if ( sLine[ i ] == '#' )
+				break;
+
+			if ( sLine[ i ] == '"' )
+			{
+				size_t nEnd = sLine.find( '"', i + 1 );
+				if ( nEnd == std::string::npos )
+					nEnd = sLine.size();
+
+				vTokens.push_back( sLine.substr( i + 1, nEnd - i - 1 ) );
+				i = nEnd + 1;
+				continue;
+			}
+
+			size_t nStart = i;
+			while ( i < sLine.size() && !isspace( ( unsigned char )sLine[ i ] ) )
+				i++;
+
+			vTokens.push_back( sLine.substr( nStart, i - nStart ) );
+		}
+
+		return vTokens;
+	}
+
+	/// Read a record array of a compiled manifest. The count must already be checked against the file size
+	template< typename T >
+	static bool ReadManifestRecords( std::ifstream &cacheFile, std::vector< T > &vRecords, uint32_t nCount )
+	{
+		vRecords.resize( nCount );
+		return nCount == 0 || ( bool )cacheFile.read( ( char * )vRecords.data(), sizeof( T ) * nCount );
+	}
+
+	/// Write a record array of a compiled manifest
+	template< typename T >
+	static void WriteManifestRecords( std::ofstream &cacheFile, const std::vector< T > &vRecords )
+	{
+		if ( !vRecords.empty() )
+			cacheFile.write( ( const char * )vRecords.data(), sizeof( T ) * vRecords.size() );
+	}
+
+	XRActionManifest::XRActionManifest( std::shared_ptr< spdlog::logger > pLogger )
+		: m_pXRLogger( pLogger )
+	{
+	}
+
+	XRActionManifest::~XRActionManifest() {}
+
+	bool XRActionManifest::Load( const char *sManifestFile, const char *sCacheFile /*= nullptr */ )
+	{
+		assert( sManifestFile );
+		Clear();
+
+		// (1) Read the text manifest, only its hash is needed if the cache matches
+		std::ifstream manifestFile( sManifestFile, std::ios::binary );
+		if ( !manifestFile )
+		{
+			// Without its source the cache can't be checked for staleness, only for being a complete and consistent manifest
+			if ( sCacheFile && LoadCompiled( sCacheFile, 0 ) )
+			{
+				m_pXRLogger->warn( "Action manifest {} not found, using compiled manifest {} without checking it against its source", sManifestFile, sCacheFile );
+				return true;
+			}
+
+			m_pXRLogger->error( "Unable to open action manifest {}", sManifestFile );
+			return false;
+		}
+
+		std::string sSource( ( std::istreambuf_iterator< char >( manifestFile ) ), std::istreambuf_iterator< char >() );
+		uint64_t nSourceHash = XRCapabilityCache::Hash( sSource.data(), sSource.size() );
+		uint32_t nFileVersion = k_nFileVersion;
+		nSourceHash = XRCapabilityCache::Hash( &nFileVersion, sizeof( nFileVersion ), nSourceHash );
+
+		// (2) Use the compiled cache if it was compiled from this manifest
+		if ( sCacheFile && LoadCompiled( sCacheFile, nSourceHash ) )
+		{
+			m_pXRLogger->info( "Action manifest loaded from compiled manifest {}", sCacheFile );
+			return true;
+		}
+
+		// (3) Parse the manifest and compile it for the next launch
+		if ( !Parse( sSource ) )
+		{
+			Clear();
+			return false;
+		}
+
+		if ( sCacheFile && !SaveCompiled( sCacheFile, nSourceHash ) )
+			m_pXRLogger->warn( "Unable to write compiled action manifest {}", sCacheFile );
+
+		m_pXRLogger->info( "Action manifest {} parsed: {} action sets, {} actions, {} bindings for {} interaction profiles", 
+			sManifestFile, m_vActionSets.size(), m_vActions.size(), m_vBindings.size(), m_vProfiles.size() );
+
+		return true;
+	}
+
+	bool XRActionManifest::Parse( const std::string &sSource )
+	{
+		std::map< std::string, uint32_t > mapActionSets;
+		std::map< std::string, uint32_t > mapActions;
+
+		std::istringstream sourceStream( sSource );
+		std::string sLine;
+		uint32_t nLine = 0;
+
+		while ( std::getline( sourceStream, sLine ) )
+		{
+			nLine++;
+
+			std::vector< std::string > vTokens = TokenizeManifestLine( sLine );
+			if ( vTokens.empty() )
+				continue;
+
+			const std::string &sKey = vTokens[ 0 ];
+
+			if ( sKey == "actionset" && vTokens.size() == 4 )
+			{
+				if ( mapActionSets.find( vTokens[ 1 ] ) != mapActionSets.end() )
+				{
+					m_pXRLogger->error( "Action manifest line {}: action set {} is already defined", nLine, vTokens[ 1 ] );
+					return false;
+				}
+
+				if ( !XRNameIsWellFormed( vTokens[ 1 ].c_str(), XR_MAX_ACTION_SET_NAME_SIZE ) )
+				{
+					m_pXRLogger->error( "Action manifest line {}: invalid action set name {}. Use up to {} lower case letters, numbers, '-', '_' or '.'", 
+						nLine, vTokens[ 1 ], XR_MAX_ACTION_SET_NAME_SIZE - 1 );
+					return false;
+				}
+
+				if ( vTokens[ 2 ].empty() || vTokens[ 2 ].size() >= XR_MAX_LOCALIZED_ACTION_SET_NAME_SIZE )
+				{
+					m_pXRLogger->error( "Action manifest line {}: localized name of action set {} must have 1 to {} characters", nLine, vTokens[ 1 ], XR_MAX_LOCALIZED_ACTION_SET_NAME_SIZE - 1 );
+					return false;
+				}
+
+				XRManifestActionSet xrActionSet;
+				xrActionSet.Name = AddString( vTokens[ 1 ] );
+				xrActionSet.LocalizedName = AddString( vTokens[ 2 ] );
+				xrActionSet.Priority = ( uint32_t )strtoul( vTokens[ 3 ].c_str(), nullptr, 10 );
+
+				mapActionSets[ vTokens[ 1 ] ] = ( uint32_t )m_vActionSets.size();
+				m_vActionSets.push_back( xrActionSet );
+			}
+			else if ( sKey == "action" && vTokens.size() >= 5 )
+			{
+				auto itActionSet = mapActionSets.find( vTokens[ 1 ] );
+				if ( itActionSet == mapActionSets.end() )
+				{
+					m_pXRLogger->error( "Action manifest line {}: unknown action set {}", nLine, vTokens[ 1 ] );
+					return false;
+				}
+
+				if ( mapActions.find( vTokens[ 2 ] ) != mapActions.end() )
+				{
+					m_pXRLogger->error( "Action manifest line {}: action {} is already defined", nLine, vTokens[ 2 ] );
+					return false;
+				}
+
+				if ( !XRNameIsWellFormed( vTokens[ 2 ].c_str(), XR_MAX_ACTION_NAME_SIZE ) )
+				{
+					m_pXRLogger->error( "Action manifest line {}: invalid action name {}. Use up to {} lower case letters, numbers, '-', '_' or '.'", 
+						nLine, vTokens[ 2 ], XR_MAX_ACTION_NAME_SIZE - 1 );
+					return false;
+				}
+
+				if ( vTokens[ 3 ].empty() || vTokens[ 3 ].size() >= XR_MAX_LOCALIZED_ACTION_NAME_SIZE )
+				{
+					m_pXRLogger->error( "Action manifest line {}: localized name of action {} must have 1 to {} characters", nLine, vTokens[ 2 ], XR_MAX_LOCALIZED_ACTION_NAME_SIZE - 1 );
+					return false;
+				}
+
+				XRManifestAction xrAction;
+				xrAction.ActionSet = itActionSet->second;
+				xrAction.Name = AddString( vTokens[ 2 ] );
+				xrAction.LocalizedName = AddString( vTokens[ 3 ] );
+
+				const std::string &sType = vTokens[ 4 ];
+				if ( sType == "boolean" )
+					xrAction.Type = XR_ACTION_TYPE_BOOLEAN_INPUT;
+				else if ( sType == "float" )
+					xrAction.Type = XR_ACTION_TYPE_FLOAT_INPUT;
+				else if ( sType == "vector2f" )
+					xrAction.Type = XR_ACTION_TYPE_VECTOR2F_INPUT;
+				else if ( sType == "pose" )
+					xrAction.Type = XR_ACTION_TYPE_POSE_INPUT;
+				else if ( sType == "vibration" )
+					xrAction.Type = XR_ACTION_TYPE_VIBRATION_OUTPUT;
+				else
+				{
+					m_pXRLogger->error( "Action manifest line {}: unknown action type {}", nLine, sType );
+					return false;
+				}
+
+				// Subaction paths of an action are stored next to each other so they can be passed to the runtime as is
+				xrAction.FirstSubactionPath = ( uint32_t )m_vSubactionPaths.size();
+				for ( size_t i = 5; i < vTokens.size(); i++ )
+				{
+					if ( !XRPathIsWellFormed( vTokens[ i ].c_str() ) )
+					{
+						m_pXRLogger->error( "Action manifest line {}: invalid subaction path {}", nLine, vTokens[ i ] );
+						return false;
+					}
+
+					XRManifestPath xrPath;
+					xrPath.Path = AddString( vTokens[ i ] );
+					xrPath.Hash = XRPathHash( vTokens[ i ].c_str() );
+					m_vSubactionPaths.push_back( xrPath );
+				}
+				xrAction.SubactionPathCount = ( uint32_t )( vTokens.size() - 5 );
+
+				mapActions[ vTokens[ 2 ] ] = ( uint32_t )m_vActions.size();
+				m_vActions.push_back( xrAction );
+			}
+			else if ( sKey == "binding" && vTokens.size() == 4 )
+			{
+				auto itAction = mapActions.find( vTokens[ 2 ] );
+				if ( itAction == mapActions.end() )
+				{
+					m_pXRLogger->error( "Action manifest line {}: unknown action {}", nLine, vTokens[ 2 ] );
+					return false;
+				}
+
+				if ( !XRPathStartsWith( vTokens[ 1 ].c_str(), "/interaction_profiles/" ) || !XRPathIsWellFormed( vTokens[ 1 ].c_str() ) ||
+					 !XRPathStartsWith( vTokens[ 3 ].c_str(), "/user/" ) || !XRPathIsWellFormed( vTokens[ 3 ].c_str() ) )
+				{
+					m_pXRLogger->error( "Action manifest line {}: invalid interaction profile or binding path", nLine );
+					return false;
+				}
+
+				XRManifestBinding xrBinding;
+				xrBinding.Profile = AddPath( m_vProfiles, vTokens[ 1 ] );
+				xrBinding.Action = itAction->second;
+				xrBinding.Path = AddString( vTokens[ 3 ] );
+				xrBinding.Hash = XRPathHash( vTokens[ 3 ].c_str() );
+				m_vBindings.push_back( xrBinding );
+			}
+			else
+			{
+				m_pXRLogger->error( "Action manifest line {}: unrecognized entry {}", nLine, sKey );
+				return false;
+			}
+		}
+
+		// Each profile's bindings are suggested in a single call
+		std::stable_sort( m_vBindings.begin(), m_vBindings.end(), 
+			[]( const XRManifestBinding &a, const XRManifestBinding &b ) { return a.Profile < b.Profile; } );
+
+		return true;
+	}
+
+	bool XRActionManifest::LoadCompiled( const char *sCacheFile, uint64_t nSourceHash )
+	{
+		std::ifstream cacheFile( sCacheFile, std::ios::binary );
+		if ( !cacheFile )
+			return false;
+
+		// ========================================================================
+		// (1) Check the header, and that the counts it has describe exactly the rest of the file before allocating anything for them
+		// ========================================================================
+		XRManifestFileHeader xrHeader;
+		if ( !cacheFile.read( ( char * )&xrHeader, sizeof( xrHeader ) ) || xrHeader.Magic != k_nFileMagic || xrHeader.Version != k_nFileVersion ||
+			 ( nSourceHash != 0 && xrHeader.SourceHash != nSourceHash ) )
+			return false;
+
+		std::streamoff nRecordsStart = cacheFile.tellg();
+		cacheFile.seekg( 0, std::ios::end );
+		std::streamoff nFileEnd = cacheFile.tellg();
+		cacheFile.seekg( nRecordsStart, std::ios::beg );
+
+		uint64_t nRecordBytes = ( uint64_t )xrHeader.ActionSetCount * sizeof( XRManifestActionSet ) + ( uint64_t )xrHeader.ActionCount * sizeof( XRManifestAction ) +
+								( uint64_t )xrHeader.SubactionPathCount * sizeof( XRManifestPath ) + ( uint64_t )xrHeader.ProfileCount * sizeof( XRManifestPath ) +
+								( uint64_t )xrHeader.BindingCount * sizeof( XRManifestBinding ) + xrHeader.StringBytes;
+
+		if ( nRecordsStart < 0 || nFileEnd < nRecordsStart || ( uint64_t )( nFileEnd - nRecordsStart ) != nRecordBytes )
+			return false;
+
+		// ========================================================================
+		// (2) Read the records and check every index and string offset in them
+		// ========================================================================
+		bool bIsLoaded = ReadManifestRecords( cacheFile, m_vActionSets, xrHeader.ActionSetCount ) &&
+						 ReadManifestRecords( cacheFile, m_vActions, xrHeader.ActionCount ) &&
+						 ReadManifestRecords( cacheFile, m_vSubactionPaths, xrHeader.SubactionPathCount ) &&
+						 ReadManifestRecords( cacheFile, m_vProfiles, xrHeader.ProfileCount ) &&
+						 ReadManifestRecords( cacheFile, m_vBindings, xrHeader.BindingCount ) &&
+						 ReadManifestRecords( cacheFile, m_vStrings, xrHeader.StringBytes );
+
+		// A corrupt cache must not index past its own tables. Strings must start right after another one ends
+		bIsLoaded = bIsLoaded && !m_vStrings.empty() && m_vStrings.back() == 0;
+
+		auto IsStringValid = [ & ]( uint32_t nOffset ) { return nOffset < xrHeader.StringBytes && ( nOffset == 0 || m_vStrings[ nOffset - 1 ] == 0 ); };
+		auto IsPathValid = [ & ]( uint32_t nOffset, uint64_t nHash ) { return IsStringValid( nOffset ) && XRPathHash( GetString( nOffset ) ) == nHash; };
+
+		for ( const XRManifestActionSet &xrActionSet : m_vActionSets )
+		{
+			bIsLoaded = bIsLoaded && IsStringValid( xrActionSet.Name ) && IsStringValid( xrActionSet.LocalizedName ) &&
+						XRNameIsWellFormed( GetString( xrActionSet.Name ), XR_MAX_ACTION_SET_NAME_SIZE ) &&
+						strnlen( GetString( xrActionSet.LocalizedName ), XR_MAX_LOCALIZED_ACTION_SET_NAME_SIZE ) < XR_MAX_LOCALIZED_ACTION_SET_NAME_SIZE;
+		}
+
+		for ( const XRManifestAction &xrAction : m_vActions )
+		{
+			bIsLoaded = bIsLoaded && xrAction.ActionSet < xrHeader.ActionSetCount && IsStringValid( xrAction.Name ) && IsStringValid( xrAction.LocalizedName ) &&
+						XRNameIsWellFormed( GetString( xrAction.Name ), XR_MAX_ACTION_NAME_SIZE ) &&
+						strnlen( GetString( xrAction.LocalizedName ), XR_MAX_LOCALIZED_ACTION_NAME_SIZE ) < XR_MAX_LOCALIZED_ACTION_NAME_SIZE &&
+						( xrAction.Type == XR_ACTION_TYPE_BOOLEAN_INPUT || xrAction.Type == XR_ACTION_TYPE_FLOAT_INPUT || xrAction.Type == XR_ACTION_TYPE_VECTOR2F_INPUT ||
+						  xrAction.Type == XR_ACTION_TYPE_POSE_INPUT || xrAction.Type == XR_ACTION_TYPE_VIBRATION_OUTPUT ) &&
+						( uint64_t )xrAction.FirstSubactionPath + xrAction.SubactionPathCount <= xrHeader.SubactionPathCount;
+		}
+
+		for ( const XRManifestPath &xrPath : m_vSubactionPaths )
+			bIsLoaded = bIsLoaded && IsPathValid( xrPath.Path, xrPath.Hash );
+
+		for ( const XRManifestPath &xrPath : m_vProfiles )
+			bIsLoaded = bIsLoaded && IsPathValid( xrPath.Path, xrPath.Hash );
+
+		for ( const XRManifestBinding &xrBinding : m_vBindings )
+		{
+			bIsLoaded = bIsLoaded && xrBinding.Profile < xrHeader.ProfileCount && xrBinding.Action < xrHeader.ActionCount &&
+						IsPathValid( xrBinding.Path, xrBinding.Hash );
+		}
+
+		if ( !bIsLoaded )
+		{
+			Clear();
+			return false;
+		}
+
+		m_bIsFromCache = true;
+		return true;
+	}
+
+	bool XRActionManifest::SaveCompiled( const char *sCacheFile, uint64_t nSourceHash ) const
+	{
+		std::ofstream cacheFile( sCacheFile, std::ios::binary | std::ios::trunc );
+		if ( !cacheFile )
+			return false;
+
+		XRManifestFileHeader xrHeader;
+		xrHeader.Magic = k_nFileMagic;
+		xrHeader.Version = k_nFileVersion;
+		xrHeader.SourceHash = nSourceHash;
+		xrHeader.ActionSetCount = ( uint32_t )m_vActionSets.size();
+		xrHeader.ActionCount = ( uint32_t )m_vActions.size();
+		xrHeader.SubactionPathCount = ( uint32_t )m_vSubactionPaths.size();
+		xrHeader.ProfileCount = ( uint32_t )m_vProfiles.size();
+		xrHeader.BindingCount = ( uint32_t )m_vBindings.size();
+		xrHeader.StringBytes = ( uint32_t )m_vStrings.size();
+
+		cacheFile.write( ( const char * )&xrHeader, sizeof( xrHeader ) );
+		WriteManifestRecords( cacheFile, m_vActionSets );
+		WriteManifestRecords( cacheFile, m_vActions );
+		WriteManifestRecords( cacheFile, m_vSubactionPaths );
+		WriteManifestRecords( cacheFile, m_vProfiles );
+		WriteManifestRecords( cacheFile, m_vBindings );
+		WriteManifestRecords( cacheFile, m_vStrings );
+
+		return ( bool )cacheFile;
+	}
+
+	uint32_t XRActionManifest::AddString( const std::string &sString )
+	{
+		uint32_t nOffset = ( uint32_t )m_vStrings.size();
+		m_vStrings.insert( m_vStrings.end(), sString.begin(), sString.end() );
+		m_vStrings.push_back( 0 );
+
+		return nOffset;
+	}
+
+	uint32_t XRActionManifest::AddPath( std::vector< XRManifestPath > &vPaths, const std::string &sPath )
+	{
+		uint64_t nHash = XRPathHash( sPath.c_str() );
+		for ( uint32_t i = 0; i < ( uint32_t )vPaths.size(); i++ )
+		{
+			if ( vPaths[ i ].Hash == nHash && sPath == GetString( vPaths[ i ].Path ) )
+				return i;
+		}
+
+		XRManifestPath xrPath;
+		xrPath.Path = AddString( sPath );
+		xrPath.Hash = nHash;
+		vPaths.push_back( xrPath );
+
+		return ( uint32_t )( vPaths.size() - 1 );
+	}
+
+	void XRActionManifest::Clear()
+	{
+		m_bIsFromCache = false;
+		m_vStrings.clear();
+		m_vActionSets.clear();
+		m_vActions.clear();
+		m_vSubactionPaths.clear();
+		m_vProfiles.clear();
+		m_vBindings.clear();
+	}
+
+} // namespace OpenXRProvider
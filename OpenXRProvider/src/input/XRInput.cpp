@@ -36,6 +36,8 @@ namespace OpenXRProvider
 
 		// Retain pointer to logger
 		m_pXRLogger = m_pXRCore->GetLogger();
+		m_pXRDeferredLog = m_pXRCore->GetDeferredLog();
+		m_pXRDispatchTable = m_pXRCore->GetDispatchTable();
 
 		// Check xr render manager
 		if ( !m_pXRRender )
@@ -61,96 +63,87 @@ namespace OpenXRProvider
 			throw std::runtime_error( eMessage );
 		}
 
-		// Generate all supported input profiles
-		GenerateInputProfiles();
+		// Resolve the profile and user paths once, XrPaths stay valid for the life of the instance
+		m_pXRPathTable = new XRPathTable( m_pXRCore->GetXRInstance(), m_pXRDispatchTable, m_pXRLogger );
+		InternInputProfilePaths();
+
+		// Keep actions working if the session has to be recreated
+		m_pXRCore->RegisterSessionCallback( { &XRInput::Callback_XRSession, this } );
 
 		m_pXRLogger->info( "Input manager created successfully" );
 	}
 
 	XRInput::~XRInput()
 	{
+		m_pXRCore->DeregisterSessionCallback( this );
+
 		// Delete actions
 		if ( m_vActions.size() > 0 )
 		{
 			for	each( XrAction xrAction in m_vActions ) 
-				m_xrLastCallResult = xrDestroyAction( xrAction );
+				m_xrLastCallResult = m_pXRDispatchTable->xrDestroyAction( xrAction );
 		}
 
 		// Delete action sets
 		if (m_vActionSets.size() > 0)
 		{
 			for	each( XrActionSet xrActionSet in m_vActionSets ) 
-				m_xrLastCallResult = xrDestroyActionSet( xrActionSet );
+				m_xrLastCallResult = m_pXRDispatchTable->xrDestroyActionSet( xrActionSet );
 		}
 
 		// Delete input profiles
+		for ( auto &xrInputProfile : m_mapInputProfiles )
+			delete xrInputProfile.second;
 
-		if ( m_pXRInputProfile_GoogleDaydream )
-			delete m_pXRInputProfile_GoogleDaydream;
-
-		if ( m_pXRInputProfile_HTCVive )
-			delete m_pXRInputProfile_HTCVive;
-
-		if ( m_pXRInputProfile_HTCVivePro )
-			delete m_pXRInputProfile_HTCVivePro;
-
-		if ( m_pXRInputProfile_KhronosSimple )
-			delete m_pXRInputProfile_KhronosSimple;
-
-		if ( m_pXRInputProfile_MicrosoftMR )
-			delete m_pXRInputProfile_MicrosoftMR;
-
-		if ( m_pXRInputProfile_MicrosoftXBox )
-			delete m_pXRInputProfile_MicrosoftXBox;
-
-		if ( m_pXRInputProfile_OculusGo )
-			delete m_pXRInputProfile_OculusGo;
-
-		if ( m_pXRInputProfile_OculusTouch )
-			delete m_pXRInputProfile_OculusTouch;
-
-		if ( m_pXRInputProfile_ValveIndex )
-			delete m_pXRInputProfile_ValveIndex;
+		if ( m_pXRPathTable )
+			delete m_pXRPathTable;
 	}
 
-	void XRInput::GenerateInputProfiles()
+	XRInputProfile *XRInput::InputProfile( const XRInputProfileDesc &xrDescriptor )
 	{
-		assert( m_pXRCore && m_pXRCore->GetXRSession() != XR_NULL_HANDLE );
-
-		// Google Daydream
-		m_pXRInputProfile_GoogleDaydream = new XRInputProfile_GoogleDaydream( m_pXRLogger );
-
-		// HTC Vive
-		m_pXRInputProfile_HTCVive = new XRInputProfile_HTCVive( m_pXRLogger );
+		auto it = m_mapInputProfiles.find( &xrDescriptor );
+		if ( it != m_mapInputProfiles.end() )
+			return it->second;
 
-		// HTC Vive Pro
-		m_pXRInputProfile_HTCVivePro = new XRInputProfile_HTCVivePro( m_pXRLogger );
+		XRInputProfile *pInputProfile = new XRInputProfile( xrDescriptor, m_pXRLogger );
+		m_mapInputProfiles[ &xrDescriptor ] = pInputProfile;
 
-		// Khronos Simple
-		m_pXRInputProfile_KhronosSimple = new XRInputProfile_KhronosSimple( m_pXRLogger );
-
-		// Microsoft MR
-		m_pXRInputProfile_MicrosoftMR = new XRInputProfile_MicrosoftMR( m_pXRLogger );
-
-		// Microsoft XBox
-		m_pXRInputProfile_MicrosoftXBox = new XRInputProfile_MicrosoftXBox(  m_pXRLogger );
+		return pInputProfile;
+	}
 
-		// Oculus Go
-		m_pXRInputProfile_OculusGo = new XRInputProfile_OculusGo( m_pXRLogger );
+	void XRInput::InternInputProfilePaths()
+	{
+		const XRInputProfileDesc *pInputProfiles[] = 
+		{
+			&XRInputProfile_GoogleDaydream::Descriptor,
+			&XRInputProfile_HTCVive::Descriptor,
+			&XRInputProfile_HTCVivePro::Descriptor,
+			&XRInputProfile_KhronosSimple::Descriptor,
+			&XRInputProfile_MicrosoftMR::Descriptor,
+			&XRInputProfile_MicrosoftXBox::Descriptor,
+			&XRInputProfile_OculusGo::Descriptor,
+			&XRInputProfile_OculusTouch::Descriptor,
+			&XRInputProfile_ValveIndex::Descriptor
+		};
+
+		// Hashes were computed at compile time, so interning a profile is a single table probe or runtime call
+		for ( const XRInputProfileDesc *pInputProfile : pInputProfiles )
+		{
+			XrPath xrPath;
+			if ( m_pXRPathTable->Intern( pInputProfile->Hash, pInputProfile->Path, &xrPath ) == XR_SUCCESS )
+				m_mapInputProfileByPath[ xrPath ] = pInputProfile;
+		}
 
-		// Oculus Touch
-		m_pXRInputProfile_OculusTouch = new XRInputProfile_OculusTouch( m_pXRLogger );
+		const char *sUserPaths[] = { "/user/hand/left", "/user/hand/right", "/user/head", "/user/gamepad" };
+		for ( const char *sUserPath : sUserPaths )
+			m_pXRPathTable->GetPath( sUserPath );
 
-		// Valve Index Controller
-		m_pXRInputProfile_ValveIndex = new XRInputProfile_ValveIndex( m_pXRLogger );
+		m_pXRLogger->info( "{} input profile and user paths interned", m_pXRPathTable->GetCount() );
 	}
 
 	XrPath XRInput::GetXRPath( const char *sPath ) 
 	{
-		XrPath xrPath;
-		xrStringToPath( m_pXRCore->GetXRInstance(), sPath, &xrPath );
-
-		return xrPath;
+		return m_pXRPathTable->GetPath( sPath );
 	}
 
 	XrActionSet XRInput::CreateActionSet( const char *pName, const char *pLocalizedName, uint32_t nPriority ) 
@@ -163,7 +156,7 @@ namespace OpenXRProvider
 		xrActionSetCreateInfo.priority = nPriority;
 
 		XrActionSet xrActionSet;
-		m_xrLastCallResult = XR_CALL_SILENT( xrCreateActionSet( m_pXRCore->GetXRInstance(), &xrActionSetCreateInfo, &xrActionSet ), m_pXRLogger );
+		m_xrLastCallResult = XR_CALL_SILENT( m_pXRDispatchTable->xrCreateActionSet( m_pXRCore->GetXRInstance(), &xrActionSetCreateInfo, &xrActionSet ), m_pXRLogger );
 
 		if ( m_xrLastCallResult == XR_SUCCESS )
 			m_vActionSets.push_back( xrActionSet );
@@ -181,20 +174,23 @@ namespace OpenXRProvider
 
 		// Create action
 		XrActionCreateInfo xrActionCreateInfo { XR_TYPE_ACTION_CREATE_INFO };
-		strcpy_s( xrActionCreateInfo.actionName, XR_MAX_ACTION_SET_NAME_SIZE, pName );
-		strcpy_s( xrActionCreateInfo.localizedActionName, XR_MAX_LOCALIZED_ACTION_SET_NAME_SIZE, pLocalizedName );
+		strcpy_s( xrActionCreateInfo.actionName, XR_MAX_ACTION_NAME_SIZE, pName );
+		strcpy_s( xrActionCreateInfo.localizedActionName, XR_MAX_LOCALIZED_ACTION_NAME_SIZE, pLocalizedName );
 		xrActionCreateInfo.actionType = xrActionType;
 		xrActionCreateInfo.countSubactionPaths = nFilterCount;
 		xrActionCreateInfo.subactionPaths = xrFilters;
 
 		XrAction xrAction;
-		m_xrLastCallResult = XR_CALL_SILENT( xrCreateAction( xrActionSet, &xrActionCreateInfo, &xrAction ), m_pXRLogger );
+		m_xrLastCallResult = XR_CALL_SILENT( m_pXRDispatchTable->xrCreateAction( xrActionSet, &xrActionCreateInfo, &xrAction ), m_pXRLogger );
 
 		if ( m_xrLastCallResult == XR_SUCCESS )
 		{
 			// Add action to array of created actions for this session
 			m_vActions.push_back( xrAction );
 
+			// Add its states to the snapshot retrieved on every sync
+			RegisterAction( xrActionSet, xrAction, xrActionType, nFilterCount, xrFilters );
+
 			// If this is a pose action, create a corresponding action space
 			if ( xrActionType == XR_ACTION_TYPE_POSE_INPUT )
 			{
@@ -206,13 +202,12 @@ namespace OpenXRProvider
 				xrActionSpaceCreateInfo.poseInActionSpace = xrPose;
 				xrActionSpaceCreateInfo.subactionPath = nFilterCount > 0 ? xrFilters[0] : XR_NULL_PATH;
 
-				XrSpace xrSpace;
-				m_xrLastCallResult = xrCreateActionSpace( m_pXRCore->GetXRSession(), &xrActionSpaceCreateInfo, &xrSpace );
+				m_mapActionSpaceCreateInfo.insert( std::pair< XrAction, XrActionSpaceCreateInfo >( xrAction, xrActionSpaceCreateInfo ) );
+				m_xrLastCallResult = CreateActionSpace( xrActionSpaceCreateInfo );
 
 				if ( m_xrLastCallResult == XR_SUCCESS )
 				{
-					m_mapActionSpace.insert( std::pair< XrAction, XrSpace >( xrAction, xrSpace ) );
-					m_pXRLogger->info( "Action {} created with reference space handle ({})", pName, ( uint64_t )xrSpace );
+					m_pXRLogger->info( "Action {} created with reference space handle ({})", pName, ( uint64_t )m_mapActionSpace[ xrAction ] );
 				}
 				else
 				{
@@ -238,7 +233,7 @@ namespace OpenXRProvider
 	{
 		assert( sString && m_pXRCore && m_pXRCore->GetXRInstance() != XR_NULL_HANDLE );
 
-		m_xrLastCallResult = XR_CALL_SILENT( xrStringToPath( m_pXRCore->GetXRInstance(), sString, xrPath ), m_pXRLogger );
+		m_xrLastCallResult = m_pXRPathTable->Intern( sString, xrPath );
 
 		return m_xrLastCallResult;
 	}
@@ -248,11 +243,10 @@ namespace OpenXRProvider
 		assert( m_pXRCore && m_pXRCore->GetXRInstance() != XR_NULL_HANDLE );
 		assert( sControllerPath && sComponentPath && xrPath );
 
-		char sFullPath[ XR_MAX_PATH_LENGTH ];
-		strcpy_s( sFullPath, XR_MAX_PATH_LENGTH, sControllerPath );
-		strcat_s( sFullPath, XR_MAX_PATH_LENGTH, sComponentPath );
+		// The concatenated path is only built if it isn't interned yet
+		m_xrLastCallResult = m_pXRPathTable->Intern( sControllerPath, xrPath, sComponentPath );
 
-		return StringToXrPath( sFullPath, xrPath );
+		return m_xrLastCallResult;
 	}
 
 	XrActionSuggestedBinding XRInput::CreateActionBinding( XrAction xrAction, const char *sControllerPath, const char *sComponentPath, std::vector< XrActionSuggestedBinding > *vActionBindings ) 
@@ -261,7 +255,7 @@ namespace OpenXRProvider
 
 		// Check if the component path is a full path (i.e. already has the controller path such as /user/hand/left/input/pose
 		// this can happen for controllers such as Oculus touch with handed keys (e.g. X,Y keys are only for the left hand)
-		bool bIsFullPath = ( strstr( "/user/", sComponentPath ) != NULL );
+		bool bIsFullPath = XRPathStartsWith( sComponentPath, "/user/" );
 
 		XrPath xrPath;
 		if ( bIsFullPath )
@@ -278,6 +272,19 @@ namespace OpenXRProvider
 		return xrActionSuggestedBinding;
 	}
 
+	XrActionSuggestedBinding XRInput::CreateActionBinding( XrAction xrAction, const XRInputBinding &xrInputBinding )
+	{
+		assert( xrAction != 0 && xrInputBinding.Profile && xrInputBinding.Component );
+
+		// The binding was validated against the profile's table and its hash computed when it was declared
+		XrActionSuggestedBinding xrActionSuggestedBinding { xrAction, XR_NULL_PATH };
+		m_xrLastCallResult = m_pXRPathTable->Intern( xrInputBinding.Hash, xrInputBinding.UserPath, &xrActionSuggestedBinding.binding, xrInputBinding.Component->Path );
+
+		InputProfile( *xrInputBinding.Profile )->ActionBindings()->push_back( xrActionSuggestedBinding );
+
+		return xrActionSuggestedBinding;
+	}
+
 	XrResult XRInput::SuggestActionBindings( std::vector< XrActionSuggestedBinding > *vActionBindings, const char *sInteractionProfilePath ) 
 	{
 		assert
@@ -287,8 +294,7 @@ namespace OpenXRProvider
 			m_pXRCore->GetXRSession() != XR_NULL_HANDLE 
 		);
 
-		XrPath xrPath;
-		xrStringToPath( m_pXRCore->GetXRInstance(), sInteractionProfilePath, &xrPath );
+		XrPath xrPath = GetXRPath( sInteractionProfilePath );
 
 		m_xrLastCallResult = XR_ERROR_VALIDATION_FAILURE;
 		if ( vActionBindings->size() < 1 )
@@ -302,7 +308,7 @@ namespace OpenXRProvider
 		xrInteractionProfileSuggestedBinding.suggestedBindings = vActionBindings->data();
 		xrInteractionProfileSuggestedBinding.countSuggestedBindings = ( uint32_t )vActionBindings->size();
 
-		m_xrLastCallResult = XR_CALL_SILENT( xrSuggestInteractionProfileBindings( 
+		m_xrLastCallResult = XR_CALL_SILENT( m_pXRDispatchTable->xrSuggestInteractionProfileBindings( 
 			m_pXRCore->GetXRInstance(), &xrInteractionProfileSuggestedBinding ), m_pXRLogger );
 
 		if ( m_xrLastCallResult != XR_SUCCESS )
@@ -320,15 +326,190 @@ namespace OpenXRProvider
 		XrActiveActionSet xrActiveActionSet { xrActionSet, xrFilter };
 		m_vActiveActionSets.push_back( xrActiveActionSet );
 
+		for ( size_t i = 0; i < m_vActionHandleSets.size(); i++ )
+		{
+			if ( m_vActionHandleSets[ i ] == xrActionSet )
+				m_vActionHandleActive[ i ] = 1;
+		}
+
+		// Action sets can only be attached to a session once, so actions must all be created before the first activation
+		if ( !m_bActionSetsAttached )
+			AttachActionSets();
+	}
+
+	XrResult XRInput::LoadActionManifest( const char *sManifestFile, const char *sCacheFile /*= nullptr */ )
+	{
+		assert( sManifestFile && m_pXRCore && m_pXRCore->GetXRSession() != XR_NULL_HANDLE );
+
+		if ( m_bActionSetsAttached )
+		{
+			m_pXRLogger->error( "Unable to load action manifest {}. Action sets are already attached to the session", sManifestFile );
+			return m_xrLastCallResult = XR_ERROR_ACTIONSETS_ALREADY_ATTACHED;
+		}
+
+		XRActionManifest xrManifest( m_pXRLogger );
+		if ( !xrManifest.Load( sManifestFile, sCacheFile ) )
+			return m_xrLastCallResult = XR_ERROR_VALIDATION_FAILURE;
+
+		// (1) Action sets
+		std::vector< XrActionSet > vActionSets;
+		for ( const XRManifestActionSet &xrManifestActionSet : xrManifest.GetActionSets() )
+		{
+			const char *sName = xrManifest.GetString( xrManifestActionSet.Name );
+			XrActionSet xrActionSet = CreateActionSet( sName, xrManifest.GetString( xrManifestActionSet.LocalizedName ), xrManifestActionSet.Priority );
+
+			if ( m_xrLastCallResult != XR_SUCCESS )
+				return m_xrLastCallResult;
+
+			vActionSets.push_back( xrActionSet );
+			m_mapManifestActionSets[ sName ] = xrActionSet;
+		}
+
+		// (2) Subaction paths, hashed when the manifest was compiled
+		std::vector< XrPath > vSubactionPaths;
+		for ( const XRManifestPath &xrManifestPath : xrManifest.GetSubactionPaths() )
+		{
+			XrPath xrPath;
+			if ( m_pXRPathTable->Intern( xrManifestPath.Hash, xrManifest.GetString( xrManifestPath.Path ), &xrPath ) != XR_SUCCESS )
+				return m_xrLastCallResult = XR_ERROR_PATH_INVALID;
+
+			vSubactionPaths.push_back( xrPath );
+		}
+
+		// (3) Actions
+		std::vector< XrAction > vActions;
+		for ( const XRManifestAction &xrManifestAction : xrManifest.GetActions() )
+		{
+			const char *sName = xrManifest.GetString( xrManifestAction.Name );
+			size_t nActionCount = m_vActions.size();
+			XrAction xrAction = CreateAction( vActionSets[ xrManifestAction.ActionSet ], sName, xrManifest.GetString( xrManifestAction.LocalizedName ), 
+				xrManifestAction.Type, xrManifestAction.SubactionPathCount, xrManifestAction.SubactionPathCount > 0 ? &vSubactionPaths[ xrManifestAction.FirstSubactionPath ] : nullptr );
+
+			// A pose action whose action space failed is still usable once the space is recreated
+			if ( m_vActions.size() == nActionCount )
+				return m_xrLastCallResult;
+
+			vActions.push_back( xrAction );
+			m_mapManifestActions[ sName ] = xrAction;
+		}
+
+		// (4) Suggested bindings, one call per interaction profile (bindings are sorted by profile)
+		const std::vector< XRManifestBinding > &vManifestBindings = xrManifest.GetBindings();
+		std::vector< XrActionSuggestedBinding > vActionBindings;
+
+		for ( size_t i = 0; i < vManifestBindings.size(); i++ )
+		{
+			const XRManifestBinding &xrManifestBinding = vManifestBindings[ i ];
+
+			XrActionSuggestedBinding xrActionSuggestedBinding { vActions[ xrManifestBinding.Action ], XR_NULL_PATH };
+			if ( m_pXRPathTable->Intern( xrManifestBinding.Hash, xrManifest.GetString( xrManifestBinding.Path ), &xrActionSuggestedBinding.binding ) != XR_SUCCESS )
+				return m_xrLastCallResult = XR_ERROR_PATH_INVALID;
+
+			vActionBindings.push_back( xrActionSuggestedBinding );
+
+			if ( i + 1 < vManifestBindings.size() && vManifestBindings[ i + 1 ].Profile == xrManifestBinding.Profile )
+				continue;
+
+			// Runtimes ignore profiles they don't support, so a failed suggestion doesn't stop the others
+			SuggestActionBindings( &vActionBindings, xrManifest.GetString( xrManifest.GetProfiles()[ xrManifestBinding.Profile ].Path ) );
+			vActionBindings.clear();
+		}
+
+		// (5) Activate the action sets, the first activation attaches them all to the session
+		for ( XrActionSet xrActionSet : vActionSets )
+			ActivateActionSet( xrActionSet );
+
+		m_pXRLogger->info( "Action manifest {} loaded{}", sManifestFile, xrManifest.GetIsFromCache() ? " (compiled)" : "" );
+
+		return m_xrLastCallResult;
+	}
+
+	XrActionSet XRInput::GetManifestActionSet( const char *sName ) const
+	{
+		auto it = m_mapManifestActionSets.find( sName );
+		return it != m_mapManifestActionSets.end() ? it->second : XR_NULL_HANDLE;
+	}
+
+	XrAction XRInput::GetManifestAction( const char *sName ) const
+	{
+		auto it = m_mapManifestActions.find( sName );
+		return it != m_mapManifestActions.end() ? it->second : XR_NULL_HANDLE;
+	}
+
+	XrResult XRInput::AttachActionSets()
+	{
 		XrSessionActionSetsAttachInfo xrSessionActionSetsAttachInfo { XR_TYPE_SESSION_ACTION_SETS_ATTACH_INFO };
 		xrSessionActionSetsAttachInfo.countActionSets = ( uint32_t )m_vActionSets.size();
 		xrSessionActionSetsAttachInfo.actionSets = m_vActionSets.data();
 
-		m_xrLastCallResult = XR_CALL_SILENT( xrAttachSessionActionSets( m_pXRCore->GetXRSession(), &xrSessionActionSetsAttachInfo ), m_pXRLogger );
+		m_xrLastCallResult = XR_CALL_SILENT( m_pXRDispatchTable->xrAttachSessionActionSets( m_pXRCore->GetXRSession(), &xrSessionActionSetsAttachInfo ), m_pXRLogger );
 
 		if ( m_xrLastCallResult == XR_SUCCESS )
+		{
+			m_bActionSetsAttached = true;
 			m_pXRLogger->info( "{} action sets attached to the current session ({})", xrSessionActionSetsAttachInfo.countActionSets, ( uint64_t )m_pXRCore->GetXRSession() );
+		}
+
+		return m_xrLastCallResult;
+	}
+
+	XrResult XRInput::CreateActionSpace( const XrActionSpaceCreateInfo &xrActionSpaceCreateInfo )
+	{
+		XrSpace xrSpace = XR_NULL_HANDLE;
+		XrResult xrResult = m_pXRDispatchTable->xrCreateActionSpace( m_pXRCore->GetXRSession(), &xrActionSpaceCreateInfo, &xrSpace );
+
+		if ( xrResult != XR_SUCCESS )
+			return xrResult;
+
+		m_mapActionSpace[ xrActionSpaceCreateInfo.action ] = xrSpace;
+
+		// Locate the action space along with every other registered space (same slot if it's being recreated)
+		XRSpaceRegistry *pXRSpaceRegistry = m_pXRCore->GetSpaceRegistry();
+		std::map< XrAction, uint32_t >::iterator const iter = m_mapActionSpaceSlot.find( xrActionSpaceCreateInfo.action );
+
+		if ( iter != m_mapActionSpaceSlot.end() )
+			pXRSpaceRegistry->SetSpace( iter->second, xrSpace );
+		else
+			m_mapActionSpaceSlot.insert( std::pair< XrAction, uint32_t >( xrActionSpaceCreateInfo.action, pXRSpaceRegistry->AddSpace( xrSpace ) ) );
+
+		return xrResult;
+	}
+
+	void XRInput::Callback_XRSession( EXRSessionEvent eSessionEvent, void *pUserContext )
+	{
+		XRInput *pXRInput = static_cast< XRInput * >( pUserContext );
+
+		if ( eSessionEvent == SESSION_EVENT_DESTROYING )
+		{
+			// Action spaces are children of the session
+			for ( const auto &actionSpace : pXRInput->m_mapActionSpace )
+				XR_CALL_SILENT( pXRInput->m_pXRDispatchTable->xrDestroySpace( actionSpace.second ), pXRInput->m_pXRLogger );
+
+			// Keep the slots, the new spaces are set to the same ones
+			for ( const auto &actionSpaceSlot : pXRInput->m_mapActionSpaceSlot )
+				pXRInput->m_pXRCore->GetSpaceRegistry()->SetSpace( actionSpaceSlot.second, XR_NULL_HANDLE );
+
+			pXRInput->m_mapActionSpace.clear();
+			return;
+		}
+
+		// Actions aren't tied to the session running, only to the session itself
+		if ( eSessionEvent != SESSION_EVENT_CREATED )
+			return;
+
+		// Action sets, actions and suggested bindings belong to the instance, so they only need to be attached to the new session
+		if ( pXRInput->m_bActionSetsAttached )
+			pXRInput->AttachActionSets();
+
+		for ( const auto &actionSpaceCreateInfo : pXRInput->m_mapActionSpaceCreateInfo )
+		{
+			XrResult xrResult = pXRInput->CreateActionSpace( actionSpaceCreateInfo.second );
+
+			if ( xrResult != XR_SUCCESS )
+				pXRInput->m_pXRLogger->error( "Unable to recreate the action space for action ({}). Result was {}", ( uint64_t )actionSpaceCreateInfo.first, XrEnumToString( xrResult ) );
+		}
 
+		pXRInput->m_pXRLogger->info( "{} action space(s) recreated for XR Session (Handle {})", pXRInput->m_mapActionSpace.size(), ( uint64_t )pXRInput->m_pXRCore->GetXRSession() );
 	}
 
 	XrResult XRInput::SyncActiveActionSetsData() 
@@ -342,17 +523,246 @@ namespace OpenXRProvider
 		xrActionSyncInfo.countActiveActionSets = ( uint32_t )m_vActiveActionSets.size();
 		xrActionSyncInfo.activeActionSets = m_vActiveActionSets.data();
 
-		m_xrLastCallResult = XR_CALL_SILENT( xrSyncActions( m_pXRCore->GetXRSession(), &xrActionSyncInfo ), m_pXRLogger );
+		m_xrLastCallResult = XR_CALL_DEFERRED( m_pXRDispatchTable->xrSyncActions( m_pXRCore->GetXRSession(), &xrActionSyncInfo ), m_pXRDeferredLog );
+		m_pXRCore->CheckSessionLost( m_xrLastCallResult );
+
+		// Input ages are measured against the time of this sync
+		m_xrLastSyncTime = m_pXRCore->GetClock()->Now();
+
+		if ( m_xrLastCallResult == XR_SUCCESS )
+			UpdateActionStateSnapshot();
 
 		return m_xrLastCallResult;
 	}
 
+	void XRInput::RegisterAction( XrActionSet xrActionSet, XrAction xrAction, XrActionType xrActionType, uint32_t nFilterCount, XrPath *xrFilters )
+	{
+		// Output actions (haptics) have no state
+		if ( xrActionType == XR_ACTION_TYPE_VIBRATION_OUTPUT )
+			return;
+
+		bool bIsActive = false;
+		for ( const XrActiveActionSet &xrActiveActionSet : m_vActiveActionSets )
+			bIsActive |= xrActiveActionSet.actionSet == xrActionSet;
+
+		// One handle for the combined state, then one for each subaction path
+		for ( uint32_t i = 0; i <= nFilterCount; i++ )
+		{
+			XrActionStateGetInfo xrActionStateGetInfo { XR_TYPE_ACTION_STATE_GET_INFO };
+			xrActionStateGetInfo.action = xrAction;
+			xrActionStateGetInfo.subactionPath = i == 0 ? XR_NULL_PATH : xrFilters[ i - 1 ];
+
+			m_vActionHandleGetInfos.push_back( xrActionStateGetInfo );
+			m_vActionHandleTypes.push_back( xrActionType );
+			m_vActionHandleSets.push_back( xrActionSet );
+			m_vActionHandleActive.push_back( bIsActive ? 1 : 0 );
+			m_vActionHandleEventValues.push_back( { 0.f, 0.f } );
+			m_xrActionStateSnapshot.States.push_back( XRActionState() );
+		}
+	}
+
+	uint32_t XRInput::GetActionHandle( XrAction xrAction, XrPath xrSubactionPath ) const
+	{
+		for ( uint32_t i = 0; i < ( uint32_t )m_vActionHandleGetInfos.size(); i++ )
+		{
+			if ( m_vActionHandleGetInfos[ i ].action == xrAction && m_vActionHandleGetInfos[ i ].subactionPath == xrSubactionPath )
+				return i;
+		}
+
+		return k_nInvalidActionHandle;
+	}
+
+	void XRInput::UpdateActionStateSnapshot()
+	{
+		XrSession xrSession = m_pXRCore->GetXRSession();
+		uint32_t nHandles = ( uint32_t )m_vActionHandleGetInfos.size();
+
+		m_xrActionStateSnapshot.SyncIndex++;
+		m_xrActionStateSnapshot.SyncTime = m_xrLastSyncTime;
+
+		// OpenXR has no batched state query, so retrieve every state in one tight loop with prebuilt get infos
+		for ( uint32_t i = 0; i < nHandles; i++ )
+		{
+			XRActionState &xrState = m_xrActionStateSnapshot.States[ i ];
+			const XrActionStateGetInfo *pGetInfo = &m_vActionHandleGetInfos[ i ];
+			XrBool32 bWasActive = xrState.IsActive;
+
+			if ( !m_vActionHandleActive[ i ] )
+			{
+				xrState.IsActive = XR_FALSE;
+				xrState.ChangedSinceLastSync = XR_FALSE;
+
+				if ( m_bInputEventsEnabled )
+					QueueInputEvents( i, bWasActive );
+
+				continue;
+			}
+
+			XrResult xrResult = XR_ERROR_ACTIONSET_NOT_ATTACHED;
+			switch ( m_vActionHandleTypes[ i ] )
+			{
+				case XR_ACTION_TYPE_BOOLEAN_INPUT:
+				{
+					XrActionStateBoolean xrActionState { XR_TYPE_ACTION_STATE_BOOLEAN };
+					xrResult = m_pXRDispatchTable->xrGetActionStateBoolean( xrSession, pGetInfo, &xrActionState );
+
+					xrState.Boolean = xrActionState.currentState;
+					xrState.LastChangeTime = xrActionState.lastChangeTime;
+					xrState.IsActive = xrActionState.isActive;
+					xrState.ChangedSinceLastSync = xrActionState.changedSinceLastSync;
+					break;
+				}
+
+				case XR_ACTION_TYPE_FLOAT_INPUT:
+				{
+					XrActionStateFloat xrActionState { XR_TYPE_ACTION_STATE_FLOAT };
+					xrResult = m_pXRDispatchTable->xrGetActionStateFloat( xrSession, pGetInfo, &xrActionState );
+
+					xrState.Float = xrActionState.currentState;
+					xrState.LastChangeTime = xrActionState.lastChangeTime;
+					xrState.IsActive = xrActionState.isActive;
+					xrState.ChangedSinceLastSync = xrActionState.changedSinceLastSync;
+					break;
+				}
+
+				case XR_ACTION_TYPE_VECTOR2F_INPUT:
+				{
+					XrActionStateVector2f xrActionState { XR_TYPE_ACTION_STATE_VECTOR2F };
+					xrResult = m_pXRDispatchTable->xrGetActionStateVector2f( xrSession, pGetInfo, &xrActionState );
+
+					xrState.Vector2f = xrActionState.currentState;
+					xrState.LastChangeTime = xrActionState.lastChangeTime;
+					xrState.IsActive = xrActionState.isActive;
+					xrState.ChangedSinceLastSync = xrActionState.changedSinceLastSync;
+					break;
+				}
+
+				case XR_ACTION_TYPE_POSE_INPUT:
+				{
+					XrActionStatePose xrActionState { XR_TYPE_ACTION_STATE_POSE };
+					xrResult = m_pXRDispatchTable->xrGetActionStatePose( xrSession, pGetInfo, &xrActionState );
+
+					xrState.IsActive = xrActionState.isActive;
+					xrState.ChangedSinceLastSync = XR_FALSE;
+					break;
+				}
+
+				default:
+					break;
+			}
+
+			if ( xrResult != XR_SUCCESS )
+			{
+				xrState.IsActive = XR_FALSE;
+				xrState.ChangedSinceLastSync = XR_FALSE;
+			}
+			else
+			{
+				RecordInputAge( xrState.ChangedSinceLastSync, xrState.LastChangeTime );
+			}
+
+			if ( m_bInputEventsEnabled )
+				QueueInputEvents( i, bWasActive );
+		}
+	}
+
+	void XRInput::SetInputEventsEnabled( bool bEnabled, float fAnalogThreshold /*= 0.05f */ )
+	{
+		m_bInputEventsEnabled = bEnabled;
+		m_fInputEventThreshold = fAnalogThreshold;
+
+		// Analog events are relative to the state at the time events were enabled
+		for ( size_t i = 0; i < m_vActionHandleEventValues.size(); i++ )
+		{
+			const XRActionState &xrState = m_xrActionStateSnapshot.States[ i ];
+			if ( m_vActionHandleTypes[ i ] == XR_ACTION_TYPE_BOOLEAN_INPUT )
+				m_vActionHandleEventValues[ i ] = { xrState.IsActive && xrState.Boolean ? 1.f : 0.f, 0.f };
+			else if ( m_vActionHandleTypes[ i ] == XR_ACTION_TYPE_FLOAT_INPUT )
+				m_vActionHandleEventValues[ i ] = { xrState.Float, 0.f };
+			else if ( m_vActionHandleTypes[ i ] == XR_ACTION_TYPE_VECTOR2F_INPUT )
+				m_vActionHandleEventValues[ i ] = xrState.Vector2f;
+		}
+
+		m_nDroppedInputEvents.store( 0, std::memory_order_relaxed );
+	}
+
+	void XRInput::QueueInputEvents( uint32_t nHandle, XrBool32 bWasActive )
+	{
+		const XRActionState &xrState = m_xrActionStateSnapshot.States[ nHandle ];
+
+		XRInputEvent xrInputEvent;
+		xrInputEvent.ActionHandle = nHandle;
+		xrInputEvent.Time = xrState.LastChangeTime;
+
+		// An action that goes inactive while held reports no change, so release it (or return it to rest) here. There is no change time either
+		bool bDeactivated = bWasActive && !xrState.IsActive;
+		if ( bDeactivated )
+			xrInputEvent.Time = m_xrActionStateSnapshot.SyncTime;
+
+		switch ( m_vActionHandleTypes[ nHandle ] )
+		{
+			case XR_ACTION_TYPE_BOOLEAN_INPUT:
+			{
+				XrVector2f &xrLastValue = m_vActionHandleEventValues[ nHandle ];
+				bool bPressed = !bDeactivated && xrState.Boolean;
+
+				if ( bDeactivated ? xrLastValue.x == 0.f : !xrState.ChangedSinceLastSync )
+					return;
+
+				xrLastValue.x = bPressed ? 1.f : 0.f;
+				xrInputEvent.Type = bPressed ? INPUT_EVENT_PRESSED : INPUT_EVENT_RELEASED;
+				xrInputEvent.Value.x = xrLastValue.x;
+				break;
+			}
+
+			case XR_ACTION_TYPE_FLOAT_INPUT:
+			case XR_ACTION_TYPE_VECTOR2F_INPUT:
+			{
+				if ( !bDeactivated && !xrState.ChangedSinceLastSync )
+					return;
+
+				XrVector2f xrValue = m_vActionHandleTypes[ nHandle ] == XR_ACTION_TYPE_FLOAT_INPUT ? XrVector2f { xrState.Float, 0.f } : xrState.Vector2f;
+				if ( bDeactivated )
+					xrValue = { 0.f, 0.f };
+
+				XrVector2f &xrLastValue = m_vActionHandleEventValues[ nHandle ];
+
+				// Small moves accumulate until they pass the threshold, so slow drifts still produce events. Returning to rest always does
+				bool bReturnedToRest = xrValue.x == 0.f && xrValue.y == 0.f && ( xrLastValue.x != 0.f || xrLastValue.y != 0.f );
+				if ( !bReturnedToRest && std::max( std::fabs( xrValue.x - xrLastValue.x ), std::fabs( xrValue.y - xrLastValue.y ) ) < m_fInputEventThreshold )
+					return;
+
+				xrLastValue = xrValue;
+				xrInputEvent.Type = INPUT_EVENT_ANALOG;
+				xrInputEvent.Value = xrValue;
+				break;
+			}
+
+			case XR_ACTION_TYPE_POSE_INPUT:
+			{
+				if ( xrState.IsActive == bWasActive )
+					return;
+
+				// Pose states have no change time
+				xrInputEvent.Type = xrState.IsActive ? INPUT_EVENT_POSE_TRACKING_GAINED : INPUT_EVENT_POSE_TRACKING_LOST;
+				xrInputEvent.Time = m_xrActionStateSnapshot.SyncTime;
+				break;
+			}
+
+			default:
+				return;
+		}
+
+		if ( !m_InputEvents.Push( xrInputEvent ) )
+			m_nDroppedInputEvents.fetch_add( 1, std::memory_order_relaxed );
+	}
+
 	XrResult XRInput::GetActionPose( XrAction xrAction, XrTime xrTime, XrSpaceLocation *xrLocation ) 
 	{
 		// Find the action space for the action
 		std::map< XrAction, XrSpace >::iterator const iter = m_mapActionSpace.find( xrAction );
 		if ( iter != m_mapActionSpace.end() )
-			m_xrLastCallResult = xrLocateSpace( iter->second, m_pXRCore->GetXRSpace(), xrTime, xrLocation );
+			m_xrLastCallResult = m_pXRDispatchTable->xrLocateSpace( iter->second, m_pXRCore->GetXRSpace(), xrTime, xrLocation );
 		else
 			return XR_ERROR_VALIDATION_FAILURE;
 
@@ -365,9 +775,10 @@ namespace OpenXRProvider
 
 		XrActionStateGetInfo xrActionStateGetInfo { XR_TYPE_ACTION_STATE_GET_INFO };
 		xrActionStateGetInfo.action = xrAction;
-		m_xrLastCallResult = XR_CALL_SILENT( xrGetActionStateBoolean( 
-			m_pXRCore->GetXRSession(), &xrActionStateGetInfo, xrActionState ), m_pXRLogger );
+		m_xrLastCallResult = XR_CALL_DEFERRED( m_pXRDispatchTable->xrGetActionStateBoolean( 
+			m_pXRCore->GetXRSession(), &xrActionStateGetInfo, xrActionState ), m_pXRDeferredLog );
 
+		RecordInputAge( xrActionState->changedSinceLastSync, xrActionState->lastChangeTime );
 		return m_xrLastCallResult;
 	}
 
@@ -377,8 +788,9 @@ namespace OpenXRProvider
 
 		XrActionStateGetInfo xrActionStateGetInfo { XR_TYPE_ACTION_STATE_GET_INFO };
 		xrActionStateGetInfo.action = xrAction;
-		m_xrLastCallResult = XR_CALL_SILENT( xrGetActionStateFloat( m_pXRCore->GetXRSession(), &xrActionStateGetInfo, xrActionState ), m_pXRLogger );
+		m_xrLastCallResult = XR_CALL_DEFERRED( m_pXRDispatchTable->xrGetActionStateFloat( m_pXRCore->GetXRSession(), &xrActionStateGetInfo, xrActionState ), m_pXRDeferredLog );
 
+		RecordInputAge( xrActionState->changedSinceLastSync, xrActionState->lastChangeTime );
 		return m_xrLastCallResult;
 	}
 
@@ -388,18 +800,28 @@ namespace OpenXRProvider
 
 		XrActionStateGetInfo xrActionStateGetInfo { XR_TYPE_ACTION_STATE_GET_INFO };
 		xrActionStateGetInfo.action = xrAction;
-		m_xrLastCallResult = XR_CALL_SILENT( xrGetActionStateVector2f( m_pXRCore->GetXRSession(), &xrActionStateGetInfo, xrActionState ), m_pXRLogger );
+		m_xrLastCallResult = XR_CALL_DEFERRED( m_pXRDispatchTable->xrGetActionStateVector2f( m_pXRCore->GetXRSession(), &xrActionStateGetInfo, xrActionState ), m_pXRDeferredLog );
 
+		RecordInputAge( xrActionState->changedSinceLastSync, xrActionState->lastChangeTime );
 		return m_xrLastCallResult;
 	}
 
+	void XRInput::RecordInputAge( XrBool32 bChangedSinceLastSync, XrTime xrLastChangeTime )
+	{
+		// Only a change since the last sync says how old the input was when it reached this frame
+		if ( m_xrLastCallResult != XR_SUCCESS || !bChangedSinceLastSync || xrLastChangeTime == 0 || m_xrLastSyncTime == 0 )
+			return;
+
+		m_pXRCore->GetClock()->RecordLatency( LATENCY_INPUT_AGE, m_xrLastSyncTime - xrLastChangeTime );
+	}
+
 	XrResult XRInput::GetActionStatePose( XrAction xrAction, XrActionStatePose *xrActionState ) 
 	{
 		assert( xrAction != XR_NULL_HANDLE && xrActionState && m_pXRCore && m_pXRCore->GetXRSession() );
 
 		XrActionStateGetInfo xrActionStateGetInfo { XR_TYPE_ACTION_STATE_GET_INFO };
 		xrActionStateGetInfo.action = xrAction;
-		m_xrLastCallResult = XR_CALL_SILENT( xrGetActionStatePose( m_pXRCore->GetXRSession(), &xrActionStateGetInfo, xrActionState ), m_pXRLogger );
+		m_xrLastCallResult = XR_CALL_DEFERRED( m_pXRDispatchTable->xrGetActionStatePose( m_pXRCore->GetXRSession(), &xrActionStateGetInfo, xrActionState ), m_pXRDeferredLog );
 
 		return m_xrLastCallResult;
 	}
@@ -411,33 +833,17 @@ namespace OpenXRProvider
 		XrPath xrPath = GetXRPath( sUserPath );
 
 		XrInteractionProfileState xrInteractionProfileState { XR_TYPE_INTERACTION_PROFILE_STATE };
-		m_xrLastCallResult = xrGetCurrentInteractionProfile(m_pXRCore->GetXRSession(), xrPath, &xrInteractionProfileState);
+		m_xrLastCallResult = m_pXRDispatchTable->xrGetCurrentInteractionProfile(m_pXRCore->GetXRSession(), xrPath, &xrInteractionProfileState);
 
-		XrPath xrInputProfilePath = GetXRPath( m_pXRInputProfile_ValveIndex->GetInputProfile() );
+		if ( m_xrLastCallResult != XR_SUCCESS || xrInteractionProfileState.interactionProfile == XR_NULL_PATH )
+			return "";
 
-		if ( m_xrLastCallResult == XR_SUCCESS )
-		{
-			if (xrInteractionProfileState.interactionProfile == GetXRPath( m_pXRInputProfile_ValveIndex->GetInputProfile() ) )
-				return m_pXRInputProfile_ValveIndex->GetInputProfile();
-			else if ( xrInteractionProfileState.interactionProfile == GetXRPath( m_pXRInputProfile_KhronosSimple->GetInputProfile() ) )
-				return m_pXRInputProfile_KhronosSimple->GetInputProfile();
-			else if ( xrInteractionProfileState.interactionProfile == GetXRPath( m_pXRInputProfile_HTCVive->GetInputProfile() ) )
-				return m_pXRInputProfile_HTCVive->GetInputProfile();
-			else if ( xrInteractionProfileState.interactionProfile == GetXRPath( m_pXRInputProfile_HTCVivePro->GetInputProfile() ) )
-				return m_pXRInputProfile_HTCVivePro->GetInputProfile();
-			else if ( xrInteractionProfileState.interactionProfile == GetXRPath( m_pXRInputProfile_OculusTouch->GetInputProfile() ) )
-				return m_pXRInputProfile_OculusTouch->GetInputProfile();
-			else if ( xrInteractionProfileState.interactionProfile == GetXRPath( m_pXRInputProfile_OculusGo->GetInputProfile() ) )
-				return m_pXRInputProfile_OculusGo->GetInputProfile();
-			else if ( xrInteractionProfileState.interactionProfile == GetXRPath( m_pXRInputProfile_MicrosoftMR->GetInputProfile() ) )
-				return m_pXRInputProfile_MicrosoftMR->GetInputProfile();
-			else if ( xrInteractionProfileState.interactionProfile == GetXRPath( m_pXRInputProfile_MicrosoftXBox->GetInputProfile() ) )
-				return m_pXRInputProfile_MicrosoftXBox->GetInputProfile();
-			else if ( xrInteractionProfileState.interactionProfile == GetXRPath( m_pXRInputProfile_GoogleDaydream->GetInputProfile() ) )
-				return m_pXRInputProfile_GoogleDaydream->GetInputProfile();
-		}
+		auto it = m_mapInputProfileByPath.find( xrInteractionProfileState.interactionProfile );
+		if ( it != m_mapInputProfileByPath.end() )
+			return it->second->Path;
 
-		return "";
+		// A profile the provider has no input profile object for, the runtime's string is cached after the first lookup
+		return m_pXRPathTable->GetString( xrInteractionProfileState.interactionProfile );
 	}
 
 	XrResult XRInput::GenerateHaptic(
@@ -457,7 +863,7 @@ namespace OpenXRProvider
 		xrHapticActionInfo.action = xrAction;
 
 		m_xrLastCallResult = XR_CALL_SILENT( 
-			xrApplyHapticFeedback( m_pXRCore->GetXRSession(), &xrHapticActionInfo, ( const XrHapticBaseHeader * )&xrHapticVibration ), m_pXRLogger );
+			m_pXRDispatchTable->xrApplyHapticFeedback( m_pXRCore->GetXRSession(), &xrHapticActionInfo, ( const XrHapticBaseHeader * )&xrHapticVibration ), m_pXRLogger );
 
 		return m_xrLastCallResult;
 	}
@@ -0,0 +1,137 @@
+/* Copyright 2021 Rune Berg (GitHub: https://github.com/1runeberg, Twitter: https://twitter.com/1runeberg)
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *  BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ *  GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+ *  DAMAGE.
+ *
+ */
+
+
+#pragma once
+
+#include <input/XRPathTable.h>
+
+namespace OpenXRProvider
+{
+	XRPathTable::XRPathTable( XrInstance xrInstance, const XRDispatchTable *pXRDispatchTable, std::shared_ptr< spdlog::logger > pLogger )
+		: m_xrInstance( xrInstance )
+		, m_pXRDispatchTable( pXRDispatchTable )
+		, m_pXRLogger( pLogger )
+	{
+		assert( m_xrInstance != XR_NULL_HANDLE && m_pXRDispatchTable );
+	}
+
+	XRPathTable::~XRPathTable() {}
+
+	uint64_t XRPathTable::Hash( const char *sPath, const char *sSuffix /*= nullptr */ )
+	{
+		uint64_t nHash = XRPathHash( sPath );
+
+		if ( sSuffix )
+			nHash = XRPathHash( sSuffix, nHash );
+
+		return nHash;
+	}
+
+	bool XRPathTable::IsMatch( const std::string &sInterned, const char *sPath, const char *sSuffix )
+	{
+		size_t nPathLength = strlen( sPath );
+		if ( sInterned.compare( 0, nPathLength, sPath ) != 0 )
+			return false;
+
+		return sInterned.compare( nPathLength, std::string::npos, sSuffix ? sSuffix : "" ) == 0;
+	}
+
+	XrResult XRPathTable::Intern( const char *sPath, XrPath *xrPath, const char *sSuffix /*= nullptr */ )
+	{
+		assert( sPath );
+
+		return Intern( Hash( sPath, sSuffix ), sPath, xrPath, sSuffix );
+	}
+
+	XrResult XRPathTable::Intern( uint64_t nHash, const char *sPath, XrPath *xrPath, const char *sSuffix /*= nullptr */ )
+	{
+		assert( sPath && xrPath );
+
+		// (1) Already interned
+		auto it = m_mapPathByHash.find( nHash );
+		if ( it != m_mapPathByHash.end() && IsMatch( m_mapStringByPath[ it->second ], sPath, sSuffix ) )
+		{
+			*xrPath = it->second;
+			return XR_SUCCESS;
+		}
+
+		// (2) Convert it with the runtime
+		std::string sFullPath( sPath );
+		if ( sSuffix )
+			sFullPath += sSuffix;
+
+		*xrPath = XR_NULL_PATH;
+		XrResult xrResult = XR_CALL_SILENT( m_pXRDispatchTable->xrStringToPath( m_xrInstance, sFullPath.c_str(), xrPath ), m_pXRLogger );
+
+		if ( xrResult != XR_SUCCESS )
+		{
+			*xrPath = XR_NULL_PATH;
+			return xrResult;
+		}
+
+		// (3) Intern it both ways. On a hash collision the first string keeps the hash slot and the other one is only cached by path
+		if ( it == m_mapPathByHash.end() )
+			m_mapPathByHash[ nHash ] = *xrPath;
+
+		m_mapStringByPath[ *xrPath ] = sFullPath;
+
+		return xrResult;
+	}
+
+	XrPath XRPathTable::GetPath( const char *sPath )
+	{
+		XrPath xrPath;
+		Intern( sPath, &xrPath );
+
+		return xrPath;
+	}
+
+	const char *XRPathTable::GetString( XrPath xrPath )
+	{
+		if ( xrPath == XR_NULL_PATH )
+			return "";
+
+		auto it = m_mapStringByPath.find( xrPath );
+		if ( it != m_mapStringByPath.end() )
+			return it->second.c_str();
+
+		// Not interned yet (e.g. a profile or path the runtime reported that the app never used)
+		char sPath[ XR_MAX_PATH_LENGTH ];
+		uint32_t nLength = 0;
+		XrResult xrResult = XR_CALL_SILENT( m_pXRDispatchTable->xrPathToString( m_xrInstance, xrPath, XR_MAX_PATH_LENGTH, &nLength, sPath ), m_pXRLogger );
+
+		if ( xrResult != XR_SUCCESS )
+			return "";
+
+		std::string &sInterned = m_mapStringByPath[ xrPath ];
+		sInterned = sPath;
+
+		uint64_t nHash = Hash( sPath );
+		if ( m_mapPathByHash.find( nHash ) == m_mapPathByHash.end() )
+			m_mapPathByHash[ nHash ] = xrPath;
+
+		return sInterned.c_str();
+	}
+
+} // namespace OpenXRProvider
@@ -21,20 +21,71 @@
  *
  */
 
+
 #pragma once
 
-#include <input/XRInputProfile_HTCVivePro.h>
+#include <rendering/XRFrameArena.h>
 
 namespace OpenXRProvider
 {
-	XRInputProfile_HTCVivePro::XRInputProfile_HTCVivePro( std::shared_ptr< spdlog::logger > pLogger )
-		: XRBaseInput( pLogger )
+	XRFrameArena::XRFrameArena()
+	{
+		Reset();
+	}
+
+	XRFrameArena::~XRFrameArena() {}
+
+	void XRFrameArena::Reset()
 	{
+		m_nLayerCount = 0;
+		m_nProjectionViewCount = 0;
+		m_nDepthInfoCount = 0;
+		m_nProjectionLayerCount = 0;
+	}
+
+	XrCompositionLayerProjectionView *XRFrameArena::AllocateProjectionViews( uint32_t nCount )
+	{
+		if ( m_nProjectionViewCount + nCount > k_nMaxProjectionViews )
+			return nullptr;
+
+		XrCompositionLayerProjectionView *pViews = &m_xrProjectionViews[ m_nProjectionViewCount ];
+		for ( uint32_t i = 0; i < nCount; i++ )
+			pViews[ i ] = { XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW };
+
+		m_nProjectionViewCount += nCount;
+		return pViews;
+	}
+
+	XrCompositionLayerDepthInfoKHR *XRFrameArena::AllocateDepthInfos( uint32_t nCount )
+	{
+		if ( m_nDepthInfoCount + nCount > k_nMaxProjectionViews )
+			return nullptr;
+
+		XrCompositionLayerDepthInfoKHR *pDepthInfos = &m_xrDepthInfos[ m_nDepthInfoCount ];
+		for ( uint32_t i = 0; i < nCount; i++ )
+			pDepthInfos[ i ] = { XR_TYPE_COMPOSITION_LAYER_DEPTH_INFO_KHR };
+
+		m_nDepthInfoCount += nCount;
+		return pDepthInfos;
+	}
+
+	XrCompositionLayerProjection *XRFrameArena::AllocateProjectionLayer()
+	{
+		if ( m_nProjectionLayerCount == k_nMaxProjectionLayers )
+			return nullptr;
+
+		XrCompositionLayerProjection *pLayer = &m_xrProjectionLayers[ m_nProjectionLayerCount++ ];
+		*pLayer = { XR_TYPE_COMPOSITION_LAYER_PROJECTION };
+		return pLayer;
 	}
 
-	XRInputProfile_HTCVivePro::~XRInputProfile_HTCVivePro()
+	bool XRFrameArena::AddLayer( const XrCompositionLayerBaseHeader *pLayer )
 	{
+		if ( !pLayer || m_nLayerCount == k_nMaxLayers )
+			return false;
 
+		m_pLayers[ m_nLayerCount++ ] = pLayer;
+		return true;
 	}
 
 } // namespace OpenXRProvider
@@ -0,0 +1,104 @@
+/* Copyright 2021 Rune Berg (GitHub: https://github.com/1runeberg, Twitter: https://twitter.com/1runeberg)
+ *
+ *  SPDX-License-Identifier: MIT
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ *  BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ *  GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+ *  DAMAGE.
+ *
+ */
+
+
+#pragma once
+
+#include <rendering/XRFrameTelemetry.h>
+
+namespace OpenXRProvider
+{
+	XRFrameTelemetry::XRFrameTelemetry()
+	{
+		Reset();
+	}
+
+	XRFrameTelemetry::~XRFrameTelemetry() {}
+
+	void XRFrameTelemetry::Record( const XRFrameStats &xrFrameStats )
+	{
+		XRFrameStats &xrFrame = m_xrFrames[ m_nNextFrame ];
+		xrFrame = xrFrameStats;
+		xrFrame.Durations[ FRAME_TIMING_DISPLAY_DELTA ] = 0;
+		xrFrame.MissedFrame = false;
+		xrFrame.MissedFrameCount = 0;
+
+		// A jump of more than one and a half display periods means the compositor had to show at least one frame twice
+		if ( m_xrLastDisplayTime != 0 && xrFrame.PredictedDisplayTime > m_xrLastDisplayTime )
+		{
+			xrFrame.Durations[ FRAME_TIMING_DISPLAY_DELTA ] = xrFrame.PredictedDisplayTime - m_xrLastDisplayTime;
+
+			if ( xrFrame.PredictedDisplayPeriod > 0 && xrFrame.Durations[ FRAME_TIMING_DISPLAY_DELTA ] * 2 > xrFrame.PredictedDisplayPeriod * 3 )
+			{
+				XrDuration nPeriods =
+					( xrFrame.Durations[ FRAME_TIMING_DISPLAY_DELTA ] + xrFrame.PredictedDisplayPeriod / 2 ) / xrFrame.PredictedDisplayPeriod;
+				xrFrame.MissedFrame = true;
+				xrFrame.MissedFrameCount = ( uint32_t )( nPeriods - 1 );
+				m_nTotalMissedFrames += xrFrame.MissedFrameCount;
+			}
+		}
+
+		m_xrLastDisplayTime = xrFrame.PredictedDisplayTime;
+		m_nNextFrame = ( m_nNextFrame + 1 ) % k_nMaxFrames;
+		m_nFrameCount = std::min( m_nFrameCount + 1, k_nMaxFrames );
+		m_nTotalFrames++;
+	}
+
+	void XRFrameTelemetry::Reset()
+	{
+		m_nNextFrame = 0;
+		m_nFrameCount = 0;
+		m_nTotalFrames = 0;
+		m_nTotalMissedFrames = 0;
+		m_xrLastDisplayTime = 0;
+	}
+
+	const XRFrameStats *XRFrameTelemetry::GetFrameStats( uint32_t nFramesAgo ) const
+	{
+		if ( nFramesAgo >= m_nFrameCount )
+			return nullptr;
+
+		return &m_xrFrames[ ( m_nNextFrame + k_nMaxFrames - 1 - nFramesAgo ) % k_nMaxFrames ];
+	}
+
+	XRFrameTimingPercentiles XRFrameTelemetry::GetPercentiles( EXRFrameTiming eTiming )
+	{
+		XRFrameTimingPercentiles xrPercentiles;
+		if ( m_nFrameCount == 0 || eTiming >= FRAME_TIMING_COUNT )
+			return xrPercentiles;
+
+		for ( uint32_t i = 0; i < m_nFrameCount; i++ )
+			m_nSortScratch[ i ] = m_xrFrames[ i ].Durations[ eTiming ];
+
+		std::sort( m_nSortScratch, m_nSortScratch + m_nFrameCount );
+
+		// Nearest rank
+		uint32_t nLast = m_nFrameCount - 1;
+		xrPercentiles.P50 = m_nSortScratch[ ( nLast * 50 ) / 100 ];
+		xrPercentiles.P95 = m_nSortScratch[ ( nLast * 95 ) / 100 ];
+		xrPercentiles.P99 = m_nSortScratch[ ( nLast * 99 ) / 100 ];
+
+		return xrPercentiles;
+	}
+
+} // namespace OpenXRProvider
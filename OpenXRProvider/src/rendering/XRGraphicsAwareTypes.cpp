@@ -23,7 +23,7 @@
 
 #pragma once
 
-#include "../../Sandbox/third_party/glad/include/glad/glad.h"
+#include <glad/glad.h>
 
 #include <rendering/XRGraphicsAwareTypes.h>
 
@@ -34,21 +34,22 @@ namespace OpenXRProvider
 		XrSystemId *xrSystemId,
 		XRAppGraphicsInfo *xrAppGraphicsInfo,
 		XrSession *xrSession,
-		XrResult *xrResult )
+		XrResult *xrResult,
+		const XRDispatchTable *pXRDispatchTable )
+		: m_pXRDispatchTable( pXRDispatchTable )
 	{
 		assert( xrInstance );
 		assert( xrSystemId );
 		assert( xrAppGraphicsInfo );
 		assert( xrSession );
 		assert( xrResult );
+		assert( pXRDispatchTable );
 
 		m_xrGraphicsBinding = nullptr;
 
 #ifdef XR_USE_GRAPHICS_API_OPENGL
 
 		XrGraphicsRequirementsOpenGLKHR xrRequirements = { XR_TYPE_GRAPHICS_REQUIREMENTS_OPENGL_KHR };
-		PFN_xrGetOpenGLGraphicsRequirementsKHR xrGetOpenGLGraphicsRequirementsKHR = nullptr;
-		xrGetInstanceProcAddr( *xrInstance, "xrGetOpenGLGraphicsRequirementsKHR", ( PFN_xrVoidFunction * )&xrGetOpenGLGraphicsRequirementsKHR );
 
 		// Setup Graphics bindings
 		XrGraphicsBindingOpenGLWin32KHR xrGraphicsBinding = { XR_TYPE_GRAPHICS_BINDING_OPENGL_WIN32_KHR };
@@ -56,7 +57,14 @@ namespace OpenXRProvider
 		xrGraphicsBinding.hDC = xrAppGraphicsInfo->hdc;
 		xrGraphicsBinding.hGLRC = xrAppGraphicsInfo->hglrc;
 
-		*xrResult = xrGetOpenGLGraphicsRequirementsKHR( *xrInstance, *xrSystemId, &xrRequirements );
+		// Graphics api extension wasn't enabled on the instance
+		if ( !m_pXRDispatchTable->xrGetOpenGLGraphicsRequirementsKHR )
+		{
+			*xrResult = XR_ERROR_FUNCTION_UNSUPPORTED;
+			return;
+		}
+
+		*xrResult = m_pXRDispatchTable->xrGetOpenGLGraphicsRequirementsKHR( *xrInstance, *xrSystemId, &xrRequirements );
 
 		if ( *xrResult != XR_SUCCESS )
 			return; // Not throwing a runtime error here as we want to report why the create session failed.
@@ -66,7 +74,7 @@ namespace OpenXRProvider
 		xrSessionCreateInfo.next = &xrGraphicsBinding;
 		xrSessionCreateInfo.systemId = *xrSystemId;
 
-		*xrResult = xrCreateSession( *xrInstance, &xrSessionCreateInfo, xrSession );
+		*xrResult = m_pXRDispatchTable->xrCreateSession( *xrInstance, &xrSessionCreateInfo, xrSession );
 
 		if ( *xrResult != XR_SUCCESS )
 			return; // Not throwing a runtime error here as we want to report why the create session failed.
@@ -80,29 +88,15 @@ namespace OpenXRProvider
 
 	XrResult XRGraphicsAPI::GenerateSwapchainImages( const XrSwapchain &xrSwapChain, const uint32_t nEye, const bool bIsDepth )
 	{
-		// Check how many images are in this swapchain from the runtime
-		uint32_t nNumOfSwapchainImages;
-		XrResult xrResult = xrEnumerateSwapchainImages( xrSwapChain, 0, &nNumOfSwapchainImages, nullptr );
-		if ( xrResult != XR_SUCCESS )
-			return xrResult;
-
-		// Generate swapchain image holders based on retrieved count from the runtime
 #if XR_USE_GRAPHICS_API_OPENGL
 		std::vector< XrSwapchainImageOpenGLKHR > xrSwapchainImages;
-		xrSwapchainImages.resize( nNumOfSwapchainImages );
-
-		for ( uint32_t i = 0; i < nNumOfSwapchainImages; i++ )
-		{
-			xrSwapchainImages[ i ] = { XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_KHR };
-		}
 #endif
-
-		// Retrieve swapchain images from the runtime
-		xrResult = xrEnumerateSwapchainImages(
-			xrSwapChain, nNumOfSwapchainImages, &nNumOfSwapchainImages, reinterpret_cast< XrSwapchainImageBaseHeader * >( xrSwapchainImages.data() ) );
+		XrResult xrResult = EnumerateSwapchainImages( xrSwapChain, xrSwapchainImages );
 		if ( xrResult != XR_SUCCESS )
 			return xrResult;
 
+		uint32_t nNumOfSwapchainImages = ( uint32_t )xrSwapchainImages.size();
+
 		// Add the images to our swapchain image cache for drawing to later
 		for ( uint32_t i = 0; i < ( uint32_t )nNumOfSwapchainImages; i++ )
 		{
@@ -125,9 +119,87 @@ namespace OpenXRProvider
 		return XR_SUCCESS;
 	}
 
+	XrResult XRGraphicsAPI::GenerateLayerSwapchainImages( const XrSwapchain &xrSwapChain, const uint32_t nLayerId )
+	{
+		// Layers keep their slot until cleared, otherwise reuse the slot of a destroyed layer before growing the array
+		std::map< uint32_t, uint32_t >::const_iterator const iter = m_mapLayerSlot.find( nLayerId );
+
+		uint32_t nSlot = 0;
+		if ( iter != m_mapLayerSlot.end() )
+		{
+			nSlot = iter->second;
+		}
+		else if ( !m_vFreeLayerSlots.empty() )
+		{
+			nSlot = m_vFreeLayerSlots.back();
+			m_vFreeLayerSlots.pop_back();
+		}
+		else
+		{
+			nSlot = ( uint32_t )m_xrLayerSwapchainImages.size();
+			m_xrLayerSwapchainImages.emplace_back();
+		}
+
+		m_mapLayerSlot[ nLayerId ] = nSlot;
+		return EnumerateSwapchainImages( xrSwapChain, m_xrLayerSwapchainImages[ nSlot ] );
+	}
+
+	void XRGraphicsAPI::ClearLayerSwapchainImages( const uint32_t nLayerId )
+	{
+		std::map< uint32_t, uint32_t >::const_iterator const iter = m_mapLayerSlot.find( nLayerId );
+		if ( iter == m_mapLayerSlot.end() )
+			return;
+
+		m_xrLayerSwapchainImages[ iter->second ].clear();
+		m_vFreeLayerSlots.push_back( iter->second );
+		m_mapLayerSlot.erase( iter );
+	}
+
+	uint32_t XRGraphicsAPI::GetLayerSwapchainImageCount( const uint32_t nLayerId )
+	{
+		std::vector< XrSwapchainImageOpenGLKHR > *pImages = GetLayerSwapchainImages( nLayerId );
+		if ( !pImages )
+			return 0;
+
+		return ( uint32_t )pImages->size();
+	}
+
+#if XR_USE_GRAPHICS_API_OPENGL
+	XrResult XRGraphicsAPI::EnumerateSwapchainImages( const XrSwapchain &xrSwapChain, std::vector< XrSwapchainImageOpenGLKHR > &xrSwapchainImages )
+	{
+		// Check how many images are in this swapchain from the runtime
+		uint32_t nNumOfSwapchainImages;
+		XrResult xrResult = m_pXRDispatchTable->xrEnumerateSwapchainImages( xrSwapChain, 0, &nNumOfSwapchainImages, nullptr );
+		if ( xrResult != XR_SUCCESS )
+			return xrResult;
+
+		// Generate swapchain image holders based on retrieved count from the runtime
+		xrSwapchainImages.resize( nNumOfSwapchainImages );
+
+		for ( uint32_t i = 0; i < nNumOfSwapchainImages; i++ )
+		{
+			xrSwapchainImages[ i ] = { XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_KHR };
+		}
+
+		// Retrieve swapchain images from the runtime
+		return m_pXRDispatchTable->xrEnumerateSwapchainImages(
+			xrSwapChain, nNumOfSwapchainImages, &nNumOfSwapchainImages, reinterpret_cast< XrSwapchainImageBaseHeader * >( xrSwapchainImages.data() ) );
+	}
+
+	std::vector< XrSwapchainImageOpenGLKHR > *XRGraphicsAPI::GetLayerSwapchainImages( const uint32_t nLayerId )
+	{
+		std::map< uint32_t, uint32_t >::const_iterator const iter = m_mapLayerSlot.find( nLayerId );
+		if ( iter == m_mapLayerSlot.end() )
+			return nullptr;
+
+		return &m_xrLayerSwapchainImages[ iter->second ];
+	}
+#endif
+
 	uint32_t XRGraphicsAPI::GetSwapchainImageCount( const EXREye eEye, const bool bIsDepth )
 	{
-		switch ( eEye )
+		// Both eyes share the left eye swapchain in stereo texture array mode
+		switch ( m_bIsStereoTextureArray ? EYE_LEFT : eEye )
 		{
 			case OpenXRProvider::EYE_LEFT:
 				if ( bIsDepth )
@@ -151,9 +223,15 @@ namespace OpenXRProvider
 		return GetTextures2D( eEye, bGetDepth )[ nSwapchainIndex ].image;
 	}
 
-	std::vector< XrSwapchainImageOpenGLKHR > XRGraphicsAPI::GetTextures2D( const EXREye eEye, const bool bGetDepth )
+	uint32_t XRGraphicsAPI::GetTextureTarget() const
+	{
+		return m_bIsStereoTextureArray ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_2D;
+	}
+
+	const std::vector< XrSwapchainImageOpenGLKHR > &XRGraphicsAPI::GetTextures2D( const EXREye eEye, const bool bGetDepth ) const
 	{
-		switch ( eEye )
+		// Both eyes share the left eye swapchain in stereo texture array mode
+		switch ( m_bIsStereoTextureArray ? EYE_LEFT : eEye )
 		{
 			case OpenXRProvider::EYE_LEFT:
 				if ( bGetDepth )
@@ -171,6 +249,126 @@ namespace OpenXRProvider
 		return m_xrSwapchainImages_Color_L;
 	}
 
+	uint32_t XRGraphicsAPI::GetLayerTexture2D( const uint32_t nLayerId, uint32_t nSwapchainIndex )
+	{
+		std::vector< XrSwapchainImageOpenGLKHR > *pImages = GetLayerSwapchainImages( nLayerId );
+		if ( !pImages || nSwapchainIndex >= pImages->size() )
+			return 0;
+
+		return ( *pImages )[ nSwapchainIndex ].image;
+	}
+
+	bool XRGraphicsAPI::BuildRenderTargets( const uint32_t nWidth, const uint32_t nHeight, const bool bShareTransientDepth )
+	{
+		DestroyRenderTargets();
+
+		// ====================================================================================================
+		// (1) Load the gl entry points for this module (uses the app's current context)
+		// ====================================================================================================
+		if ( !glGenFramebuffers && !gladLoadGL() )
+			return false;
+
+		GLint nPreviousFramebuffer = 0;
+		glGetIntegerv( GL_FRAMEBUFFER_BINDING, &nPreviousFramebuffer );
+
+		// ====================================================================================================
+		// (2) Build a complete framebuffer for every color and depth swapchain image pair of each eye
+		// ====================================================================================================
+		bool bIsComplete = true;
+		for ( uint32_t nEye = 0; nEye < 2; nEye++ )
+		{
+			const std::vector< XrSwapchainImageOpenGLKHR > &vColorImages = GetTextures2D( ( EXREye )nEye, false );
+			const std::vector< XrSwapchainImageOpenGLKHR > &vDepthImages = GetTextures2D( ( EXREye )nEye, true );
+			std::vector< uint32_t > &vRenderTargets = nEye == 0 ? m_vRenderTargets_L : m_vRenderTargets_R;
+
+			const uint32_t nColorCount = ( uint32_t )vColorImages.size();
+			const uint32_t nDepthCount = ( uint32_t )vDepthImages.size();
+			m_nRenderTargetDepthStride = nDepthCount > 0 ? nDepthCount : 1;
+
+			// ----------------------------------------------------------------------------------------------------
+			// (a) No depth swapchain, create transient depth either once per eye or once per color image
+			// ----------------------------------------------------------------------------------------------------
+			size_t nTransientDepthStart = m_vTransientDepth.size();
+			if ( nDepthCount == 0 && nColorCount > 0 )
+			{
+				uint32_t nTransientDepthCount = bShareTransientDepth ? 1 : nColorCount;
+				m_vTransientDepth.resize( nTransientDepthStart + nTransientDepthCount );
+				glGenRenderbuffers( ( GLsizei )nTransientDepthCount, &m_vTransientDepth[ nTransientDepthStart ] );
+
+				for ( uint32_t i = 0; i < nTransientDepthCount; i++ )
+				{
+					glBindRenderbuffer( GL_RENDERBUFFER, m_vTransientDepth[ nTransientDepthStart + i ] );
+					glRenderbufferStorage( GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, ( GLsizei )nWidth, ( GLsizei )nHeight );
+				}
+				glBindRenderbuffer( GL_RENDERBUFFER, 0 );
+			}
+
+			// ----------------------------------------------------------------------------------------------------
+			// (b) Attach the images once, array slices are selected by eye in stereo texture array mode
+			// ----------------------------------------------------------------------------------------------------
+			vRenderTargets.resize( ( size_t )nColorCount * m_nRenderTargetDepthStride );
+			if ( vRenderTargets.empty() )
+				continue;
+
+			glGenFramebuffers( ( GLsizei )vRenderTargets.size(), vRenderTargets.data() );
+
+			for ( uint32_t nColor = 0; nColor < nColorCount; nColor++ )
+			{
+				for ( uint32_t nDepth = 0; nDepth < m_nRenderTargetDepthStride; nDepth++ )
+				{
+					glBindFramebuffer( GL_FRAMEBUFFER, vRenderTargets[ ( size_t )nColor * m_nRenderTargetDepthStride + nDepth ] );
+
+					if ( m_bIsStereoTextureArray )
+						glFramebufferTextureLayer( GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, vColorImages[ nColor ].image, 0, ( GLint )nEye );
+					else
+						glFramebufferTexture2D( GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, vColorImages[ nColor ].image, 0 );
+
+					if ( nDepthCount > 0 && m_bIsStereoTextureArray )
+						glFramebufferTextureLayer( GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, vDepthImages[ nDepth ].image, 0, ( GLint )nEye );
+					else if ( nDepthCount > 0 )
+						glFramebufferTexture2D( GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, vDepthImages[ nDepth ].image, 0 );
+					else
+						glFramebufferRenderbuffer(
+							GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_vTransientDepth[ nTransientDepthStart + ( bShareTransientDepth ? 0 : nColor ) ] );
+
+					bIsComplete = bIsComplete && glCheckFramebufferStatus( GL_FRAMEBUFFER ) == GL_FRAMEBUFFER_COMPLETE;
+				}
+			}
+		}
+
+		glBindFramebuffer( GL_FRAMEBUFFER, ( GLuint )nPreviousFramebuffer );
+
+		if ( !bIsComplete )
+			DestroyRenderTargets();
+
+		return bIsComplete;
+	}
+
+	void XRGraphicsAPI::DestroyRenderTargets()
+	{
+		if ( !m_vRenderTargets_L.empty() )
+			glDeleteFramebuffers( ( GLsizei )m_vRenderTargets_L.size(), m_vRenderTargets_L.data() );
+
+		if ( !m_vRenderTargets_R.empty() )
+			glDeleteFramebuffers( ( GLsizei )m_vRenderTargets_R.size(), m_vRenderTargets_R.data() );
+
+		if ( !m_vTransientDepth.empty() )
+			glDeleteRenderbuffers( ( GLsizei )m_vTransientDepth.size(), m_vTransientDepth.data() );
+
+		m_vRenderTargets_L.clear();
+		m_vRenderTargets_R.clear();
+		m_vTransientDepth.clear();
+		m_nRenderTargetDepthStride = 1;
+	}
+
+	uint32_t XRGraphicsAPI::GetRenderTarget( const EXREye eEye, const uint32_t nColorIndex, const uint32_t nDepthIndex ) const
+	{
+		const std::vector< uint32_t > &vRenderTargets = eEye == EYE_LEFT ? m_vRenderTargets_L : m_vRenderTargets_R;
+		const size_t nIndex = ( size_t )nColorIndex * m_nRenderTargetDepthStride + ( m_nRenderTargetDepthStride > 1 ? nDepthIndex : 0 );
+
+		return nIndex < vRenderTargets.size() ? vRenderTargets[ nIndex ] : 0;
+	}
+
 	std::string XRGraphicsAPI::GetTextureFormatName( int64_t nTextureFormat )
 	{
 		switch ( nTextureFormat )
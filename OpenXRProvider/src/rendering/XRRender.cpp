@@ -44,6 +44,8 @@ namespace OpenXRProvider
 
 		// Retain pointer to logger
 		m_pXRLogger = m_pXRCore->GetLogger();
+		m_pXRDeferredLog = m_pXRCore->GetDeferredLog();
+		m_pXRDispatchTable = m_pXRCore->GetDispatchTable();
 
 		// Check xr instance
 		if ( m_pXRCore->GetXRInstance() == XR_NULL_HANDLE )
@@ -72,67 +74,78 @@ namespace OpenXRProvider
 			throw std::runtime_error( eMessage );
 		}
 
-		// Get number of view configurations the runtime supports
-		uint32_t nViewConfigTypeCount = 0;
-		m_xrLastCallResult = XR_CALL(
-			xrEnumerateViewConfigurations( m_pXRCore->GetXRInstance(), m_pXRCore->GetXRSystemId(), 0, &nViewConfigTypeCount, nullptr ),
-			m_pXRLogger,
-			true );
-
-		// Retrieve all the view configuration types the runtime supports
-		std::vector< XrViewConfigurationType > xrViewConfigTypes( nViewConfigTypeCount );
-		m_xrLastCallResult = XR_CALL_SILENT(
-			xrEnumerateViewConfigurations(
-				m_pXRCore->GetXRInstance(), m_pXRCore->GetXRSystemId(), nViewConfigTypeCount, &nViewConfigTypeCount, xrViewConfigTypes.data() ),
-			m_pXRLogger );
+		// Use the configuration views from the capability cache if the runtime hasn't changed since the last launch
+		XRCapabilityCache *pXRCapabilityCache = m_pXRCore->GetCapabilityCache();
+		uint32_t nViewCount = 0;
 
-		// Look for Stereo (VR) config. TODO: XR_VIEW_CONFIGURATION_TYPE_PRIMARY_MONO (AR Support)
-		bool bStereoFound = false;
-		for ( uint32_t i = 0; i < nViewConfigTypeCount; ++i )
+		if ( pXRCapabilityCache && pXRCapabilityCache->GetIsValid() && pXRCapabilityCache->GetCapabilities().ViewConfigViews.size() == k_nVRViewCount )
 		{
-			if ( xrViewConfigTypes[ i ] == XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO )
-			{
-				bStereoFound = true;
-				break;
-			}
-		}
+			m_vXRViewConfigs = pXRCapabilityCache->GetCapabilities().ViewConfigViews;
+			nViewCount = ( uint32_t )m_vXRViewConfigs.size();
 
-		// Check if Stereo (VR) is supported by the runtime
-		if ( !bStereoFound )
-		{
-			std::string eMessage = ( "Failed to create XR Render manager. The active runtime does not support VR" );
-			m_pXRLogger->error( eMessage );
-			throw std::runtime_error( eMessage );
+			m_pXRLogger->info( "Using {} cached configuration views (one for each eye)", nViewCount );
 		}
+		else
+		{
+			// Get number of view configurations the runtime supports
+			uint32_t nViewConfigTypeCount = 0;
+			m_xrLastCallResult = XR_CALL(
+				m_pXRDispatchTable->xrEnumerateViewConfigurations( m_pXRCore->GetXRInstance(), m_pXRCore->GetXRSystemId(), 0, &nViewConfigTypeCount, nullptr ),
+				m_pXRLogger,
+				true );
+
+			// Retrieve all the view configuration types the runtime supports
+			std::vector< XrViewConfigurationType > xrViewConfigTypes( nViewConfigTypeCount );
+			m_xrLastCallResult = XR_CALL_SILENT(
+				m_pXRDispatchTable->xrEnumerateViewConfigurations(
+					m_pXRCore->GetXRInstance(), m_pXRCore->GetXRSystemId(), nViewConfigTypeCount, &nViewConfigTypeCount, xrViewConfigTypes.data() ),
+				m_pXRLogger );
 
-		m_pXRLogger->info( "Runtime confirms VR support amongst its {} supported view configuration(s)", nViewConfigTypeCount );
-
-		// Get number of configuration views supported by the runtime
-		uint32_t nViewCount = 0;
-		m_xrLastCallResult = xrEnumerateViewConfigurationViews(
-			m_pXRCore->GetXRInstance(), m_pXRCore->GetXRSystemId(), XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO, 0, &nViewCount, nullptr );
-
-		// Retrieve configuration views from the runtime
-		m_vXRViewConfigs.resize( nViewCount, { XR_TYPE_VIEW_CONFIGURATION_VIEW } );
-		m_xrLastCallResult = XR_CALL(
-			xrEnumerateViewConfigurationViews(
-				m_pXRCore->GetXRInstance(),
-				m_pXRCore->GetXRSystemId(),
-				XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO,
-				nViewCount,
-				&nViewCount,
-				m_vXRViewConfigs.data() ),
-			m_pXRLogger,
-			true );
+			// Look for Stereo (VR) config. TODO: XR_VIEW_CONFIGURATION_TYPE_PRIMARY_MONO (AR Support)
+			bool bStereoFound = false;
+			for ( uint32_t i = 0; i < nViewConfigTypeCount; ++i )
+			{
+				if ( xrViewConfigTypes[ i ] == XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO )
+				{
+					bStereoFound = true;
+					break;
+				}
+			}
 
-		m_pXRLogger->info( "Successfully retrieved {} configuration views from the runtime. Should be two for VR (one for each eye)", nViewCount );
+			// Check if Stereo (VR) is supported by the runtime
+			if ( !bStereoFound )
+			{
+				std::string eMessage = ( "Failed to create XR Render manager. The active runtime does not support VR" );
+				m_pXRLogger->error( eMessage );
+				throw std::runtime_error( eMessage );
+			}
 
-		// Begin XR Session
-		XrSessionBeginInfo xrSessionBeginInfo = { XR_TYPE_SESSION_BEGIN_INFO };
-		xrSessionBeginInfo.primaryViewConfigurationType = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
-		m_xrLastCallResult = XR_CALL( xrBeginSession( m_pXRCore->GetXRSession(), &xrSessionBeginInfo ), m_pXRLogger, true );
+			m_pXRLogger->info( "Runtime confirms VR support amongst its {} supported view configuration(s)", nViewConfigTypeCount );
+
+			// Get number of configuration views supported by the runtime
+			m_xrLastCallResult = m_pXRDispatchTable->xrEnumerateViewConfigurationViews(
+				m_pXRCore->GetXRInstance(), m_pXRCore->GetXRSystemId(), XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO, 0, &nViewCount, nullptr );
+
+			// Retrieve configuration views from the runtime
+			m_vXRViewConfigs.resize( nViewCount, { XR_TYPE_VIEW_CONFIGURATION_VIEW } );
+			m_xrLastCallResult = XR_CALL(
+				m_pXRDispatchTable->xrEnumerateViewConfigurationViews(
+					m_pXRCore->GetXRInstance(),
+					m_pXRCore->GetXRSystemId(),
+					XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO,
+					nViewCount,
+					&nViewCount,
+					m_vXRViewConfigs.data() ),
+				m_pXRLogger,
+				true );
+
+			m_pXRLogger->info( "Successfully retrieved {} configuration views from the runtime. Should be two for VR (one for each eye)", nViewCount );
+
+			if ( pXRCapabilityCache )
+				pXRCapabilityCache->GetCapabilities().ViewConfigViews = m_vXRViewConfigs;
+		}
 
-		m_pXRLogger->info( "XR Session started (Handle {})", ( uint64_t )m_pXRCore->GetXRSession() );
+		// The session is begun by XRCore once the runtime reports it ready (PollXREvents), not here
 
 		// Allocate xr views
 		m_vXRViews.resize( nViewCount, { XR_TYPE_VIEW } );
@@ -151,281 +164,1434 @@ namespace OpenXRProvider
 
 		// Set swapchain details
 		m_bDepthHandling = m_pXRCore->GetIsDepthSupported();
-		m_nTextureArraySize = xrRenderInfo.TextureArraySize;
+		m_bStereoTextureArray = xrRenderInfo.UseStereoTextureArray;
+		m_nTextureArraySize = m_bStereoTextureArray ? k_nVRViewCount : xrRenderInfo.TextureArraySize;
 		m_nTextureMipCount = xrRenderInfo.TextureMipCount;
-		m_nTextureWidth = m_vXRViewConfigs[ 0 ].recommendedImageRectWidth;
-		m_nTextureHeight = m_vXRViewConfigs[ 0 ].recommendedImageRectHeight;
+		m_xrDynamicResolution = xrRenderInfo.DynamicResolution;
+
+		XrExtent2Di xrSwapchainExtent = GetSwapchainExtent( 0 );
+		m_nTextureWidth = ( uint32_t )xrSwapchainExtent.width;
+		m_nTextureHeight = ( uint32_t )xrSwapchainExtent.height;
+
+		// Render rects start at the recommended size (or as close as the dynamic resolution bounds allow)
+		m_fMaxAllocatedScale = std::min(
+			( float )m_nTextureWidth / ( float )m_vXRViewConfigs[ 0 ].recommendedImageRectWidth,
+			( float )m_nTextureHeight / ( float )m_vXRViewConfigs[ 0 ].recommendedImageRectHeight );
+		SetDynamicResolution( m_xrDynamicResolution );
 		SetSwapchainFormat( xrRenderInfo.RequestTextureFormats, xrRenderInfo.RequestDepthFormats );
 	
 		// Generate Swapchains
+		m_bCacheRenderTargets = xrRenderInfo.CacheRenderTargets;
+		m_bShareTransientDepth = xrRenderInfo.ShareTransientDepth;
+		GenerateViewSwapchains();
+
+		// Add supported extension - Visibility Mask
+		for	each( void *xrExtension in m_pXRCore->GetXREnabledExtensions() )
+			{
+				XRBaseExt *xrInstanceExtension = static_cast< XRBaseExt * >( xrExtension );
+
+				if ( strcmp( xrInstanceExtension->GetExtensionName(), XR_KHR_VISIBILITY_MASK_EXTENSION_NAME ) == 0 )
+				{
+					m_pXRVisibilityMask = static_cast< XRExtVisibilityMask * >( xrExtension );
+
+					m_pXRVisibilityMask->m_xrInstance = m_pXRCore->GetXRInstance();
+					m_pXRVisibilityMask->m_xrSession = m_pXRCore->GetXRSession();
+					break;
+				}
+			}
+
+		// Rebuild the swapchains if the session has to be recreated
+		m_pXRCore->RegisterSessionCallback( { &XRRender::Callback_XRSession, this } );
+
+		m_pXRLogger->info( "Render manager created successfully" );
+	}
+
+	XRRender::~XRRender()
+	{
+		m_pXRCore->DeregisterSessionCallback( this );
+
+		// Make sure the frame pacing thread isn't touching the session anymore
+		StopFramePacing();
+
+		// Destroy composition layers
+		while ( !m_vXRLayers.empty() )
+			DestroyLayer( m_vXRLayers.back().Id );
+
+#ifdef XR_USE_GRAPHICS_API_OPENGL
+		// Destroy cached render targets before the images they reference
+		m_pXRCore->GetGraphicsAPI()->DestroyRenderTargets();
+#endif
+
+		// Destroy Swapchains
+		DestroySwapchains( m_vXRSwapChainsColor );
+		DestroySwapchains( m_vXRSwapChainsDepth );
+
+		// Clear Swapchains
+		m_vXRSwapChainsColor.clear();
+		m_vXRSwapChainsDepth.clear();
+	}
+
+	void XRRender::DestroySwapchains( std::vector< XrSwapchain > &vXRSwapchains )
+	{
+		uint32_t nSwapChains = ( uint32_t )vXRSwapchains.size();
+		for ( uint32_t i = 0; i < nSwapChains; i++ )
+		{
+			if ( vXRSwapchains[ i ] != XR_NULL_HANDLE )
+			{
+				m_xrLastCallResult = XR_CALL_SILENT( m_pXRDispatchTable->xrDestroySwapchain( vXRSwapchains[ i ] ), m_pXRLogger );
+				if ( m_xrLastCallResult != XR_SUCCESS )
+				{
+					const char *xrEnumStr = XrEnumToString( m_xrLastCallResult );
+					std::string eMessage = "Unable to destroy swapchain with error ";
+					eMessage.append( xrEnumStr );
+
+					m_pXRLogger->error( "{} ({})", eMessage, std::to_string( m_xrLastCallResult ) );
+					throw std::runtime_error( eMessage );
+				}
+				else
+				{
+					m_pXRLogger->info( "Swapchain destroyed for eye ({})", i );
+				}
+			}
+		}
+	}
+
+	void XRRender::GenerateViewSwapchains()
+	{
+		m_pXRCore->GetGraphicsAPI()->SetStereoTextureArray( m_bStereoTextureArray );
 		GenerateSwapchains( false ); // Color textures
 
-		if ( m_bDepthHandling )
-			GenerateSwapchains( true ); // Depth textures
+		if ( m_bDepthHandling )
+			GenerateSwapchains( true ); // Depth textures
+
+		// Generate Swapchain images (color)
+		for ( uint32_t i = 0; i < m_vXRSwapChainsColor.size(); i++ )
+		{
+			m_xrLastCallResult = m_pXRCore->GetGraphicsAPI()->GenerateSwapchainImages( m_vXRSwapChainsColor[ i ], i, false );
+
+			if ( m_xrLastCallResult != XR_SUCCESS )
+			{
+				const char *xrEnumStr = XrEnumToString( m_xrLastCallResult );
+				std::string eMessage = "Failed to generate swapchain color buffers with error ";
+				eMessage.append( xrEnumStr );
+
+				m_pXRLogger->error( "{} ({})", eMessage, std::to_string( m_xrLastCallResult ) );
+				throw std::runtime_error( eMessage );
+			}
+
+			m_pXRLogger->info(
+				"{} Swapchain color buffers generated for eye ({})", m_pXRCore->GetGraphicsAPI()->GetSwapchainImageCount( i == 0 ? EYE_LEFT : EYE_RIGHT, false ), i );
+		}
+
+		// Generate Swapchain images (depth)
+		if ( m_bDepthHandling )
+		{
+			for ( uint32_t i = 0; i < m_vXRSwapChainsDepth.size(); i++ )
+			{
+				m_xrLastCallResult = m_pXRCore->GetGraphicsAPI()->GenerateSwapchainImages( m_vXRSwapChainsDepth[ i ], i, true );
+
+				if ( m_xrLastCallResult != XR_SUCCESS )
+				{
+					const char *xrEnumStr = XrEnumToString( m_xrLastCallResult );
+					std::string eMessage = "Failed to generate swapchain depth buffers with error ";
+					eMessage.append( xrEnumStr );
+
+					m_pXRLogger->error( "{} ({})", eMessage, std::to_string( m_xrLastCallResult ) );
+					throw std::runtime_error( eMessage );
+				}
+
+				m_pXRLogger->info(
+					"{} Swapchain depth buffers generated for eye ({})", m_pXRCore->GetGraphicsAPI()->GetSwapchainImageCount( i == 0 ? EYE_LEFT : EYE_RIGHT, true ), i );
+			}
+
+			// Depth that doesn't line up with the color images would reproject incorrectly, so don't submit it at all
+			if ( !ValidateDepthSwapchains() )
+			{
+				m_bDepthHandling = false;
+				m_pXRLogger->warn( "Depth swapchains will not be submitted to the runtime" );
+			}
+		}
+		else
+		{
+			m_pXRLogger->info("Runtime does not support depth composition. No Swapchain depth buffers will be generated");
+		}
+
+#ifdef XR_USE_GRAPHICS_API_OPENGL
+		// Build the render target cache (one framebuffer per swapchain image)
+		if ( m_bCacheRenderTargets )
+		{
+			if ( m_pXRCore->GetGraphicsAPI()->BuildRenderTargets( m_nTextureWidth, m_nTextureHeight, m_bShareTransientDepth ) )
+				m_pXRLogger->info( "Render target cache built ({} transient depth)", m_bShareTransientDepth ? "shared" : "per image" );
+			else
+				m_pXRLogger->warn( "Unable to build the render target cache. App must attach the swapchain images itself" );
+		}
+#endif
+	}
+
+	void XRRender::Callback_XRSession( EXRSessionEvent eSessionEvent, void *pUserContext )
+	{
+		XRRender *pXRRender = static_cast< XRRender * >( pUserContext );
+
+		try
+		{
+			switch ( eSessionEvent )
+			{
+				case SESSION_EVENT_DESTROYING:
+					pXRRender->ReleaseSessionResources();
+					break;
+
+				case SESSION_EVENT_CREATED:
+					pXRRender->RestoreSessionResources();
+					break;
+
+				case SESSION_EVENT_STOPPING:
+					pXRRender->SuspendSessionFrames();
+					break;
+
+				case SESSION_EVENT_READY:
+					pXRRender->ResumeSessionFrames();
+					break;
+
+				default:
+					break;
+			}
+		}
+		catch ( const std::exception &e )
+		{
+			pXRRender->m_pXRLogger->error( "Render manager failed to follow the recreated session: {}", e.what() );
+		}
+	}
+
+	void XRRender::SuspendSessionFrames()
+	{
+		// ========================================================================
+		// (1) Stop calling the runtime from the frame pacing thread. The requested frames in flight are kept for when the session is ready
+		// ========================================================================
+		StopFramePacingThread( false );
+
+		// ========================================================================
+		// (2) Give back images acquired for a frame that will never be submitted. The swapchains outlive the session running
+		// ========================================================================
+		if ( !m_vXRSwapChainsColor.empty() )
+			ReleaseViewImages();
+
+		ReleaseLayerImages();
+
+		m_bFrameBegun = false;
+		m_bViewsValid = false;
+	}
+
+	void XRRender::ResumeSessionFrames()
+	{
+		if ( m_nFramesInFlight > 0 && !m_FramePacingThread.joinable() )
+			StartFramePacingThread();
+	}
+
+	void XRRender::ReleaseSessionResources()
+	{
+		// ========================================================================
+		// (1) Stop calling the runtime from the frame pacing thread, it's restarted with the same frames in flight once the new session is ready
+		// ========================================================================
+		StopFramePacingThread( false );
+
+		m_bFrameBegun = false;
+		m_bViewsValid = false;
+		m_bImagesAcquired = false;
+		for ( uint32_t i = 0; i < k_nVRViewCount; i++ )
+		{
+			m_bColorImageAcquired[ i ] = false;
+			m_bDepthImageAcquired[ i ] = false;
+		}
+
+		// ========================================================================
+		// (2) Destroy the layer swapchains, the layers themselves are kept
+		// ========================================================================
+		for ( XRLayer &xrLayer : m_vXRLayers )
+		{
+			if ( xrLayer.Swapchain != XR_NULL_HANDLE )
+				XR_CALL_SILENT( m_pXRDispatchTable->xrDestroySwapchain( xrLayer.Swapchain ), m_pXRLogger );
+
+			m_pXRCore->GetGraphicsAPI()->ClearLayerSwapchainImages( xrLayer.Id );
+			xrLayer.Swapchain = XR_NULL_HANDLE;
+			xrLayer.IsImageAcquired = false;
+			xrLayer.HasContent = false;
+		}
+
+		// ========================================================================
+		// (3) Destroy the view swapchains. Formats, view configs and sizes are kept to rebuild them as they were
+		// ========================================================================
+#ifdef XR_USE_GRAPHICS_API_OPENGL
+		m_pXRCore->GetGraphicsAPI()->DestroyRenderTargets();
+#endif
+		DestroySwapchains( m_vXRSwapChainsColor );
+		DestroySwapchains( m_vXRSwapChainsDepth );
+
+		m_vXRSwapChainsColor.clear();
+		m_vXRSwapChainsDepth.clear();
+		m_vXRSwapChainInfosColor.clear();
+		m_vXRSwapChainInfosDepth.clear();
+
+		// Late latched spaces belong to the old session
+		ClearLateLatchSpaces();
+		ResetHMDState();
+	}
+
+	void XRRender::RestoreSessionResources()
+	{
+		// ========================================================================
+		// (1) Recreate the view swapchains with the already negotiated formats (the graphics api object is new),
+		//     keeping the negotiated depth handling as is
+		// ========================================================================
+		GenerateViewSwapchains();
+
+		// ========================================================================
+		// (2) Recreate the layer swapchains
+		// ========================================================================
+		for ( XRLayer &xrLayer : m_vXRLayers )
+		{
+			m_xrLastCallResult = CreateSwapchain(
+				xrLayer.Info.Width,
+				xrLayer.Info.Height,
+				xrLayer.Info.Format == 0 ? m_nTextureFormat : xrLayer.Info.Format,
+				1,
+				1,
+				1,
+				false,
+				xrLayer.Info.IsStatic ? XR_SWAPCHAIN_CREATE_STATIC_IMAGE_BIT : 0,
+				&xrLayer.Swapchain );
+
+			if ( m_xrLastCallResult == XR_SUCCESS )
+				m_xrLastCallResult = m_pXRCore->GetGraphicsAPI()->GenerateLayerSwapchainImages( xrLayer.Swapchain, xrLayer.Id );
+
+			if ( m_xrLastCallResult != XR_SUCCESS )
+			{
+				m_pXRLogger->error( "Failed to recreate swapchain for layer ({}) with error {}. Layer is hidden", xrLayer.Id, XrEnumToString( m_xrLastCallResult ) );
+				xrLayer.IsVisible = false;
+				continue;
+			}
+
+			// Spaces the app created belong to the old session, the app has to recreate the layer
+			if ( xrLayer.Info.Space != XR_NULL_HANDLE )
+			{
+				m_pXRLogger->warn( "Layer ({}) is placed in an app space from the lost session. Layer is hidden until the app recreates it", xrLayer.Id );
+				xrLayer.IsVisible = false;
+			}
+
+			UpdateLayerStruct( xrLayer );
+		}
+
+		// ========================================================================
+		// (3) Point extensions to the new session. Frame pacing resumes once the session is ready
+		// ========================================================================
+		if ( m_pXRVisibilityMask )
+			m_pXRVisibilityMask->m_xrSession = m_pXRCore->GetXRSession();
+
+		m_pXRLogger->info( "Render manager resources recreated for XR Session (Handle {})", ( uint64_t )m_pXRCore->GetXRSession() );
+	}
+
+	void XRRender::ResetHMDState()
+	{
+		m_pXRHMDState->LeftEye.Pose = { { 0.f, 0.f, 0.f, 1.f }, { 0.f, 0.f, 0.f } };
+		m_pXRHMDState->RightEye.Pose = { { 0.f, 0.f, 0.f, 1.f }, { 0.f, 0.f, 0.f } };
+
+		m_pXRHMDState->LeftEye.FoV = { -k_fTau, k_fTau, k_fTau, -k_fTau };
+		m_pXRHMDState->RightEye.FoV = { -k_fTau, k_fTau, k_fTau, -k_fTau };
+
+		m_pXRHMDState->IsPositionTracked = false;
+		m_pXRHMDState->IsOrientationTracked = false;
+	}
+
+	bool XRRender::StartFramePacing( uint32_t nFramesInFlight )
+	{
+		assert( m_pXRCore && m_pXRLogger );
+
+		if ( m_bFrameBegun )
+		{
+			m_pXRLogger->error( "Unable to change frame pacing while a frame is in progress. Call StartFramePacing outside of a frame" );
+			return false;
+		}
+
+		// Restart cleanly if the app is switching between pipelined modes
+		StopFramePacingThread( true );
+
+		if ( nFramesInFlight > k_nMaxFramesInFlight )
+		{
+			m_pXRLogger->warn( "Requested {} frames in flight, but only up to {} are supported. Clamping.", nFramesInFlight, k_nMaxFramesInFlight );
+			nFramesInFlight = k_nMaxFramesInFlight;
+		}
+
+		m_nFramesInFlight = nFramesInFlight;
+
+		// The thread is (re)started by WaitFrame or once the session is ready if it isn't running yet
+		if ( m_nFramesInFlight > 0 && m_pXRCore->GetIsSessionRunning() )
+			StartFramePacingThread();
+
+		return true;
+	}
+
+	void XRRender::StopFramePacing()
+	{
+		StopFramePacingThread( true );
+		m_nFramesInFlight = 0;
+	}
+
+	void XRRender::StartFramePacingThread()
+	{
+		// Neither thread is active at this point, so the handoff state can be reset safely
+		m_FrameTokens.Clear();
+		m_nFramesBegun = m_xrCurrentFrameToken.FrameIndex;
+		m_nFramesEnded = m_xrCurrentFrameToken.FrameIndex;
+		m_bPacedFrameBegun = false;
+		m_bFramePacingFailed = false;
+		m_bFramePacingActive = true;
+
+		m_FramePacingThread = std::thread( &XRRender::FramePacingLoop, this );
+
+		m_pXRLogger->info( "Frame pacing thread started with {} frame(s) in flight", m_nFramesInFlight );
+	}
+
+	void XRRender::StopFramePacingThread( bool bCloseOutFrames )
+	{
+		if ( !m_FramePacingThread.joinable() )
+			return;
+
+		{
+			std::lock_guard< std::mutex > lock( m_FramePacingMutex );
+			m_bFramePacingActive = false;
+		}
+
+		m_FramePacingSignal.notify_all();
+		m_FramePacingThread.join();
+
+		// Frames still in the ring are discarded along with the session when it's ending
+		if ( !bCloseOutFrames )
+		{
+			m_FrameTokens.Clear();
+			m_pXRLogger->info( "Frame pacing thread stopped" );
+			return;
+		}
+
+		// Close out frames the pacing thread waited on that the render thread never picked up, so the runtime's
+		// wait/begin/end sequence stays balanced once the render thread goes back to calling the runtime directly
+		XRFrameToken xrFrameToken;
+		while ( m_FrameTokens.Pop( xrFrameToken ) )
+		{
+			if ( xrFrameToken.FrameIndex > m_nFramesBegun )
+			{
+				XrFrameBeginInfo xrBeginFrameInfo { XR_TYPE_FRAME_BEGIN_INFO };
+				m_xrLastCallResult = XR_CALL_DEFERRED( m_pXRDispatchTable->xrBeginFrame( m_pXRCore->GetXRSession(), &xrBeginFrameInfo ), m_pXRDeferredLog );
+				if ( XR_FAILED( m_xrLastCallResult ) )
+					continue;
+			}
+			else if ( !m_bPacedFrameBegun )
+			{
+				continue;
+			}
+
+			XrFrameEndInfo xrEndFrameInfo { XR_TYPE_FRAME_END_INFO };
+			xrEndFrameInfo.displayTime = xrFrameToken.PredictedDisplayTime;
+			xrEndFrameInfo.environmentBlendMode = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
+			m_xrLastCallResult = XR_CALL_DEFERRED( m_pXRDispatchTable->xrEndFrame( m_pXRCore->GetXRSession(), &xrEndFrameInfo ), m_pXRDeferredLog );
+
+			m_xrCurrentFrameToken = xrFrameToken;
+		}
+
+		m_pXRLogger->info( "Frame pacing thread stopped" );
+	}
+
+	void XRRender::FramePacingLoop()
+	{
+		uint64_t nFrameIndex = m_nFramesEnded;
+
+		while ( m_bFramePacingActive )
+		{
+			++nFrameIndex;
+
+			// ========================================================================
+			// (1) Don't run further ahead of the render thread than the frames in flight allow
+			// ========================================================================
+			{
+				std::unique_lock< std::mutex > lock( m_FramePacingMutex );
+				m_FramePacingSignal.wait(
+					lock, [ & ] { return !m_bFramePacingActive || ( nFrameIndex - 1 ) - m_nFramesEnded.load( std::memory_order_acquire ) < m_nFramesInFlight; } );
+			}
+
+			if ( !m_bFramePacingActive )
+				break;
+
+			// ========================================================================
+			// (2) Wait for a new frame
+			// ========================================================================
+			XrFrameWaitInfo xrWaitFrameInfo { XR_TYPE_FRAME_WAIT_INFO };
+			XrFrameState xrFrameState { XR_TYPE_FRAME_STATE };
+
+			XrDuration nWaitStart = XRFrameTelemetry::GetTimeNs();
+			XrResult xrResult = XR_CALL_DEFERRED( m_pXRDispatchTable->xrWaitFrame( m_pXRCore->GetXRSession(), &xrWaitFrameInfo, &xrFrameState ), m_pXRDeferredLog );
+			XrDuration nWaitEnd = XRFrameTelemetry::GetTimeNs();
+
+			if ( xrResult != XR_SUCCESS )
+			{
+				// WaitFrame stops this thread and starts a new one on its next call if the session is still running
+				m_pXRCore->CheckSessionLost( xrResult );
+
+				{
+					std::lock_guard< std::mutex > lock( m_FramePacingMutex );
+					m_bFramePacingFailed = true;
+				}
+
+				m_FramePacingSignal.notify_all();
+				break;
+			}
+
+			// ========================================================================
+			// (3) Hand the frame token to the render thread
+			// ========================================================================
+			XRFrameToken xrFrameToken;
+			xrFrameToken.FrameIndex = nFrameIndex;
+			xrFrameToken.PredictedDisplayTime = xrFrameState.predictedDisplayTime;
+			xrFrameToken.PredictedDisplayPeriod = xrFrameState.predictedDisplayPeriod;
+			xrFrameToken.ShouldRender = xrFrameState.shouldRender == XR_TRUE;
+			xrFrameToken.WaitDuration = nWaitEnd - nWaitStart;
+			xrFrameToken.WaitEndTime = nWaitEnd;
+
+			// The ring holds as many tokens as frames in flight and (1) keeps the unended frames below that, so the push can't fail.
+			// The push itself is lock-free, the mutex is only taken so a render thread about to sleep can't miss the wakeup
+			m_FrameTokens.Push( xrFrameToken );
+			{
+				std::lock_guard< std::mutex > lock( m_FramePacingMutex );
+			}
+
+			m_FramePacingSignal.notify_all();
+
+			// ========================================================================
+			// (4) Begin the frame once the previous one has been ended by the render thread
+			// ========================================================================
+			{
+				std::unique_lock< std::mutex > lock( m_FramePacingMutex );
+				m_FramePacingSignal.wait( lock, [ & ] { return !m_bFramePacingActive || m_nFramesEnded.load( std::memory_order_acquire ) >= nFrameIndex - 1; } );
+			}
+
+			if ( !m_bFramePacingActive )
+				break;
+
+			XrFrameBeginInfo xrBeginFrameInfo { XR_TYPE_FRAME_BEGIN_INFO };
+			XrDuration nBeginStart = XRFrameTelemetry::GetTimeNs();
+			xrResult = XR_CALL_DEFERRED( m_pXRDispatchTable->xrBeginFrame( m_pXRCore->GetXRSession(), &xrBeginFrameInfo ), m_pXRDeferredLog );
+
+			{
+				std::lock_guard< std::mutex > lock( m_FramePacingMutex );
+				m_nPacedBeginDuration.store( XRFrameTelemetry::GetTimeNs() - nBeginStart, std::memory_order_relaxed );
+				m_bPacedFrameBegun.store( !XR_FAILED( xrResult ), std::memory_order_relaxed );
+				m_nFramesBegun.store( nFrameIndex, std::memory_order_release );
+			}
+
+			m_FramePacingSignal.notify_all();
+		}
+	}
+
+	void XRRender::SetPacedFrameEnded()
+	{
+		{
+			std::lock_guard< std::mutex > lock( m_FramePacingMutex );
+			m_nFramesEnded.store( m_xrCurrentFrameToken.FrameIndex, std::memory_order_release );
+		}
+
+		m_FramePacingSignal.notify_all();
+	}
+
+	bool XRRender::WaitFrame( XRFrameToken *pFrameToken )
+	{
+		assert( m_pXRCore && m_pXRLogger );
+
+		// ========================================================================
+		// (1) Wait for a new frame
+		// ========================================================================
+		if ( m_nFramesInFlight > 0 )
+		{
+			// Pipelined - (re)start the pacing thread if it stopped, e.g. after the session ended or a wait failed
+			if ( !m_FramePacingThread.joinable() )
+			{
+				if ( !m_pXRCore->GetIsSessionRunning() )
+					return false;
+
+				StartFramePacingThread();
+			}
+
+			// Pick up the frame the pacing thread already waited on, only sleeping if none is queued yet
+			bool bHasFrameToken = m_FrameTokens.Pop( m_xrCurrentFrameToken );
+			if ( !bHasFrameToken )
+			{
+				{
+					std::unique_lock< std::mutex > lock( m_FramePacingMutex );
+					m_FramePacingSignal.wait( lock, [ & ] { return m_FrameTokens.GetSize() > 0 || !m_bFramePacingActive || m_bFramePacingFailed; } );
+				}
+
+				bHasFrameToken = m_FrameTokens.Pop( m_xrCurrentFrameToken );
+			}
+
+			if ( !bHasFrameToken )
+			{
+				if ( m_bFramePacingFailed )
+					StopFramePacingThread( true );
+
+				return false;
+			}
+
+			m_xrFrameState = { XR_TYPE_FRAME_STATE };
+			m_xrFrameState.predictedDisplayTime = m_xrCurrentFrameToken.PredictedDisplayTime;
+			m_xrFrameState.predictedDisplayPeriod = m_xrCurrentFrameToken.PredictedDisplayPeriod;
+			m_xrFrameState.shouldRender = m_xrCurrentFrameToken.ShouldRender ? XR_TRUE : XR_FALSE;
+		}
+		else
+		{
+			XrFrameWaitInfo xrWaitFrameInfo { XR_TYPE_FRAME_WAIT_INFO };
+			m_xrFrameState = { XR_TYPE_FRAME_STATE };
+
+			XrDuration nWaitStart = XRFrameTelemetry::GetTimeNs();
+			m_xrLastCallResult = XR_CALL_DEFERRED( m_pXRDispatchTable->xrWaitFrame( m_pXRCore->GetXRSession(), &xrWaitFrameInfo, &m_xrFrameState ), m_pXRDeferredLog );
+			if ( m_xrLastCallResult != XR_SUCCESS )
+			{
+				m_pXRCore->CheckSessionLost( m_xrLastCallResult );
+				return false;
+			}
+
+			m_xrCurrentFrameToken.WaitEndTime = XRFrameTelemetry::GetTimeNs();
+			m_xrCurrentFrameToken.WaitDuration = m_xrCurrentFrameToken.WaitEndTime - nWaitStart;
+
+			m_xrCurrentFrameToken.FrameIndex++;
+			m_xrCurrentFrameToken.PredictedDisplayTime = m_xrFrameState.predictedDisplayTime;
+			m_xrCurrentFrameToken.PredictedDisplayPeriod = m_xrFrameState.predictedDisplayPeriod;
+			m_xrCurrentFrameToken.ShouldRender = m_xrFrameState.shouldRender == XR_TRUE;
+		}
+
+		m_xrPredictedDisplayTime = m_xrFrameState.predictedDisplayTime;
+		m_xrPredictedDisplayPeriod = m_xrFrameState.predictedDisplayPeriod;
+
+		// Start this frame's stats
+		m_xrCurrentFrameStats = XRFrameStats();
+		m_xrCurrentFrameStats.FrameIndex = m_xrCurrentFrameToken.FrameIndex;
+		m_xrCurrentFrameStats.PredictedDisplayTime = m_xrCurrentFrameToken.PredictedDisplayTime;
+		m_xrCurrentFrameStats.PredictedDisplayPeriod = m_xrCurrentFrameToken.PredictedDisplayPeriod;
+		m_xrCurrentFrameStats.ShouldRender = m_xrCurrentFrameToken.ShouldRender;
+		m_xrCurrentFrameStats.Durations[ FRAME_TIMING_WAIT ] = m_xrCurrentFrameToken.WaitDuration;
+
+		// Latency probe - how far ahead of the wait returning the frame will be displayed
+		XRClock *pXRClock = m_pXRCore->GetClock();
+		if ( !pXRClock->GetIsExact() )
+			pXRClock->Calibrate( m_xrCurrentFrameToken.PredictedDisplayTime, m_xrCurrentFrameToken.PredictedDisplayPeriod, m_xrCurrentFrameToken.WaitEndTime );
+
+		pXRClock->RecordLatency( LATENCY_DISPLAY_LEAD, m_xrCurrentFrameToken.PredictedDisplayTime - pXRClock->ToXrTime( m_xrCurrentFrameToken.WaitEndTime ) );
+
+		if ( pFrameToken )
+			*pFrameToken = m_xrCurrentFrameToken;
+
+		return true;
+	}
+
+	bool XRRender::BeginFrame()
+	{
+		assert( m_pXRCore && m_pXRLogger );
+
+		// ========================================================================
+		// (2) Begin frame before doing any GPU work
+		// ========================================================================
+		if ( m_nFramesInFlight > 0 )
+		{
+			// Pipelined - the pacing thread begins the frame as soon as the previous one has ended
+			{
+				std::unique_lock< std::mutex > lock( m_FramePacingMutex );
+				m_FramePacingSignal.wait(
+					lock, [ & ] { return !m_bFramePacingActive || m_bFramePacingFailed || m_nFramesBegun.load( std::memory_order_acquire ) >= m_xrCurrentFrameToken.FrameIndex; } );
+			}
+
+			if ( m_nFramesBegun.load( std::memory_order_acquire ) < m_xrCurrentFrameToken.FrameIndex )
+				return false;
+
+			// Mark a frame that failed to begin as done so the pacing thread can move on to the next one
+			if ( !m_bPacedFrameBegun.load( std::memory_order_relaxed ) )
+			{
+				SetPacedFrameEnded();
+				return false;
+			}
+
+			m_xrCurrentFrameStats.Durations[ FRAME_TIMING_BEGIN ] = m_nPacedBeginDuration.load( std::memory_order_relaxed );
+		}
+		else
+		{
+			XrFrameBeginInfo xrBeginFrameInfo { XR_TYPE_FRAME_BEGIN_INFO };
+			XrDuration nBeginStart = XRFrameTelemetry::GetTimeNs();
+			m_xrLastCallResult = XR_CALL_DEFERRED( m_pXRDispatchTable->xrBeginFrame( m_pXRCore->GetXRSession(), &xrBeginFrameInfo ), m_pXRDeferredLog );
+
+			// XR_FRAME_DISCARDED is a success code, the previous frame was simply never ended
+			if ( XR_FAILED( m_xrLastCallResult ) )
+			{
+				m_pXRCore->CheckSessionLost( m_xrLastCallResult );
+				return false;
+			}
+
+			m_xrCurrentFrameStats.Durations[ FRAME_TIMING_BEGIN ] = XRFrameTelemetry::GetTimeNs() - nBeginStart;
+		}
+
+		m_bFrameBegun = true;
+		m_bViewsValid = false;
+
+		// Render rects stay fixed from here until EndFrame
+		UpdateRenderScale();
+
+		if ( !m_xrFrameState.shouldRender )
+			return true;
+
+		// ========================================================================
+		// (3) Get space and time information for this frame
+		// ========================================================================
+		if ( m_bLateLatching )
+			LateLatch();
+		else
+			LocateViews();
+
+		// A frame has been begun at this point, so the app must still end it even if we can't locate the views
+		return true;
+	}
+
+	bool XRRender::LocateViews()
+	{
+		XrViewLocateInfo xrFrameSpaceTimeInfo { XR_TYPE_VIEW_LOCATE_INFO };
+		xrFrameSpaceTimeInfo.viewConfigurationType = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
+		xrFrameSpaceTimeInfo.displayTime = m_xrFrameState.predictedDisplayTime;
+		xrFrameSpaceTimeInfo.space = m_pXRCore->GetXRSpace();
+
+		// Locate into scratch views first so a failed (late) locate doesn't clobber poses that are already in use
+		XrView xrLocatedViews[ k_nVRViewCount ] = { { XR_TYPE_VIEW }, { XR_TYPE_VIEW } };
+		XrViewState xrFrameViewState { XR_TYPE_VIEW_STATE };
+		uint32_t nFoundViewsCount;
+		XrDuration nLocateStart = XRFrameTelemetry::GetTimeNs();
+		m_xrLastCallResult = XR_CALL_DEFERRED(
+			m_pXRDispatchTable->xrLocateViews( m_pXRCore->GetXRSession(), &xrFrameSpaceTimeInfo, &xrFrameViewState, k_nVRViewCount, &nFoundViewsCount, xrLocatedViews ),
+			m_pXRDeferredLog );
+		m_xrCurrentFrameStats.Durations[ FRAME_TIMING_LOCATE_VIEWS ] += XRFrameTelemetry::GetTimeNs() - nLocateStart;
+
+		if ( m_xrLastCallResult != XR_SUCCESS )
+			return false;
+
+		// Update HMD State
+		m_pXRHMDState->IsPositionTracked = xrFrameViewState.viewStateFlags & XR_VIEW_STATE_POSITION_TRACKED_BIT;
+		m_pXRHMDState->IsOrientationTracked = xrFrameViewState.viewStateFlags & XR_VIEW_STATE_ORIENTATION_TRACKED_BIT;
+
+		if ( !( xrFrameViewState.viewStateFlags & XR_VIEW_STATE_POSITION_VALID_BIT ) || !( xrFrameViewState.viewStateFlags & XR_VIEW_STATE_ORIENTATION_VALID_BIT ) )
+			return false;
+
+		for ( uint32_t i = 0; i < k_nVRViewCount; i++ )
+			m_vXRViews[ i ] = xrLocatedViews[ i ];
+
+		SetHMDState( EXREye::EYE_LEFT, &( m_pXRHMDState->LeftEye ) );
+		SetHMDState( EXREye::EYE_RIGHT, &( m_pXRHMDState->RightEye ) );
+		m_bViewsValid = true;
+		m_nViewsLocatedTime = nLocateStart;
+
+		return true;
+	}
+
+	void XRRender::EnableLateLatching( XRLateLatchData *pGpuPoseBuffer, bool bLatchAtEndFrame )
+	{
+		m_bLateLatching = true;
+		m_bLatchAtEndFrame = bLatchAtEndFrame;
+		m_pLateLatchBuffer = pGpuPoseBuffer;
+
+		m_pXRLogger->info( "Late latching enabled{}", bLatchAtEndFrame ? " (latching at end frame)" : "" );
+	}
+
+	void XRRender::DisableLateLatching()
+	{
+		m_bLateLatching = false;
+		m_bLatchAtEndFrame = false;
+		m_pLateLatchBuffer = nullptr;
+	}
+
+	bool XRRender::AddLateLatchSpace( XrSpace xrSpace, uint32_t *pSlot )
+	{
+		assert( pSlot );
+
+		if ( xrSpace == XR_NULL_HANDLE || m_nLateLatchSpaceCount == XRLateLatchData::k_nMaxSpaces )
+			return false;
+
+		*pSlot = m_nLateLatchSpaceCount;
+		m_xrLateLatchSpaces[ m_nLateLatchSpaceCount++ ] = xrSpace;
+		return true;
+	}
+
+	bool XRRender::LateLatch()
+	{
+		if ( !m_bLateLatching || !m_bFrameBegun || !m_xrFrameState.shouldRender )
+			return false;
+
+		// ========================================================================
+		// (1) Re-locate the views at this frame's predicted display time
+		// ========================================================================
+		bool bLatched = LocateViews();
+
+		// ========================================================================
+		// (2) Publish the poses the projection layer will be submitted with
+		// ========================================================================
+		if ( !m_pLateLatchBuffer )
+			return bLatched;
+
+		if ( m_bViewsValid )
+		{
+			XrVector3f xrScale { 1.f, 1.f, 1.f };
+			for ( uint32_t i = 0; i < k_nVRViewCount; i++ )
+			{
+				XrMatrix4x4f xrEyeMatrix;
+				XrMatrix4x4f_CreateTranslationRotationScale( &xrEyeMatrix, &m_vXRViews[ i ].pose.position, &m_vXRViews[ i ].pose.orientation, &xrScale );
+				XrMatrix4x4f_InvertRigidBody( &m_pLateLatchBuffer->ViewMatrix[ i ], &xrEyeMatrix );
+			}
+		}
+
+		// ========================================================================
+		// (3) Re-locate and publish the late latch spaces (e.g. controllers)
+		// ========================================================================
+		for ( uint32_t i = 0; i < m_nLateLatchSpaceCount; i++ )
+		{
+			XrSpaceLocation xrSpaceLocation { XR_TYPE_SPACE_LOCATION };
+			m_xrLastCallResult = XR_CALL_DEFERRED(
+				m_pXRDispatchTable->xrLocateSpace( m_xrLateLatchSpaces[ i ], m_pXRCore->GetXRSpace(), m_xrFrameState.predictedDisplayTime, &xrSpaceLocation ), m_pXRDeferredLog );
+
+			bool bIsValid = m_xrLastCallResult == XR_SUCCESS && ( xrSpaceLocation.locationFlags & XR_SPACE_LOCATION_POSITION_VALID_BIT ) &&
+							( xrSpaceLocation.locationFlags & XR_SPACE_LOCATION_ORIENTATION_VALID_BIT );
+
+			if ( bIsValid )
+			{
+				XrVector3f xrScale { 1.f, 1.f, 1.f };
+				XrMatrix4x4f_CreateTranslationRotationScale(
+					&m_pLateLatchBuffer->SpaceMatrix[ i ], &xrSpaceLocation.pose.position, &xrSpaceLocation.pose.orientation, &xrScale );
+			}
+
+			m_pLateLatchBuffer->SpaceValid[ i ] = bIsValid ? 1 : 0;
+		}
+
+		return bLatched;
+	}
+
+	bool XRRender::AcquireViewImages( uint32_t *pImageIndices )
+	{
+		assert( m_pXRCore && m_pXRLogger );
+
+		// Only render when the runtime asks for it and we have valid eye poses to render from
+		if ( !m_bFrameBegun || !m_xrFrameState.shouldRender || !m_bViewsValid )
+			return false;
+
+		XrDuration nAcquireStart = XRFrameTelemetry::GetTimeNs();
+
+		// ========================================================================
+		// (4) Grab image from swapchain for the app to render to
+		// ========================================================================
+		XrSwapchainImageAcquireInfo xrAcquireInfo { XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO };
+		XrSwapchainImageWaitInfo xrWaitInfo { XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO };
+		xrWaitInfo.timeout = XR_INFINITE_DURATION;
+
+		// One swapchain per eye, or a single one shared by both eyes in stereo texture array mode
+		uint32_t nSwapchainCount = ( uint32_t )m_vXRSwapChainsColor.size();
+		for ( uint32_t i = 0; i < nSwapchainCount; i++ )
+		{
+			// ----------------------------------------------------------------
+			// (a) Acquire swapchain image
+			// ----------------------------------------------------------------
+			m_xrLastCallResult =
+				XR_CALL_DEFERRED( m_pXRDispatchTable->xrAcquireSwapchainImage( m_vXRSwapChainsColor[ i ], &xrAcquireInfo, &m_nAcquiredColorImageIndex[ i ] ), m_pXRDeferredLog );
+
+			if ( m_xrLastCallResult != XR_SUCCESS )
+			{
+				ReleaseViewImages();
+				return false;
+			}
+
+			m_bColorImageAcquired[ i ] = true;
+
+			// ----------------------------------------------------------------
+			// (b) Wait for swapchain image
+			// ----------------------------------------------------------------
+			m_xrLastCallResult = XR_CALL_DEFERRED( m_pXRDispatchTable->xrWaitSwapchainImage( m_vXRSwapChainsColor[ i ], &xrWaitInfo ), m_pXRDeferredLog );
+
+			if ( m_xrLastCallResult != XR_SUCCESS )
+			{
+				ReleaseViewImages();
+				return false;
+			}
+
+			// ----------------------------------------------------------------
+			// (c) Acquire and wait for the matching depth image
+			// ----------------------------------------------------------------
+			if ( m_bDepthHandling )
+			{
+				m_xrLastCallResult =
+					XR_CALL_DEFERRED( m_pXRDispatchTable->xrAcquireSwapchainImage( m_vXRSwapChainsDepth[ i ], &xrAcquireInfo, &m_nAcquiredDepthImageIndex[ i ] ), m_pXRDeferredLog );
+
+				if ( m_xrLastCallResult == XR_SUCCESS )
+				{
+					m_bDepthImageAcquired[ i ] = true;
+					m_xrLastCallResult = XR_CALL_DEFERRED( m_pXRDispatchTable->xrWaitSwapchainImage( m_vXRSwapChainsDepth[ i ], &xrWaitInfo ), m_pXRDeferredLog );
+				}
+
+				if ( m_xrLastCallResult != XR_SUCCESS )
+				{
+					ReleaseViewImages();
+					return false;
+				}
+			}
+		}
+
+		if ( pImageIndices )
+		{
+			for ( uint32_t i = 0; i < k_nVRViewCount; i++ )
+				pImageIndices[ i ] = m_nAcquiredColorImageIndex[ GetSwapchainIndex( i ) ];
+		}
+
+		m_bImagesAcquired = true;
+		m_xrCurrentFrameStats.Durations[ FRAME_TIMING_ACQUIRE ] = XRFrameTelemetry::GetTimeNs() - nAcquireStart;
+		return true;
+	}
+
+	bool XRRender::ReleaseViewImages()
+	{
+		m_bImagesAcquired = false;
+
+		// Only release images we're still holding, a partially failed acquire can leave some eyes without one
+		bool bSuccess = true;
+		XrSwapchainImageReleaseInfo xrSwapChainReleaseInfo { XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO };
+
+		for ( uint32_t i = 0; i < k_nVRViewCount; i++ )
+		{
+			if ( m_bColorImageAcquired[ i ] )
+			{
+				m_xrLastCallResult = XR_CALL_DEFERRED( m_pXRDispatchTable->xrReleaseSwapchainImage( m_vXRSwapChainsColor[ i ], &xrSwapChainReleaseInfo ), m_pXRDeferredLog );
+				bSuccess = bSuccess && m_xrLastCallResult == XR_SUCCESS;
+				m_bColorImageAcquired[ i ] = false;
+			}
+
+			if ( m_bDepthImageAcquired[ i ] )
+			{
+				m_xrLastCallResult = XR_CALL_DEFERRED( m_pXRDispatchTable->xrReleaseSwapchainImage( m_vXRSwapChainsDepth[ i ], &xrSwapChainReleaseInfo ), m_pXRDeferredLog );
+				bSuccess = bSuccess && m_xrLastCallResult == XR_SUCCESS;
+				m_bDepthImageAcquired[ i ] = false;
+			}
+		}
+
+		return bSuccess;
+	}
+
+	bool XRRender::EndFrame( std::vector< XrCompositionLayerBaseHeader * > *pAppLayers )
+	{
+		assert( m_pXRCore && m_pXRLogger );
+
+		if ( !m_bFrameBegun )
+			return false;
+
+		// ----------------------------------------------------------------
+		// (d) Release swapchain images, the app is done rendering to them
+		// ----------------------------------------------------------------
+		// The GPU reads the pose buffer at execution time, so give it the freshest poses before the images go back to the runtime.
+		// Latched while the frame still counts as begun, LateLatch does nothing outside of a frame
+		if ( m_bLateLatching && m_bLatchAtEndFrame && m_bImagesAcquired )
+			LateLatch();
+
+		m_bFrameBegun = false;
+
+		XrDuration nReleaseStart = XRFrameTelemetry::GetTimeNs();
+
+		bool bHasRenderedViews = m_bImagesAcquired;
+
+		// Depth is only submitted if every depth image was acquired (and rendered to) this frame
+		bool bHasRenderedDepth = m_bDepthHandling && m_xrDepthSubmitInfo.Submit;
+		for ( size_t i = 0; i < m_vXRSwapChainsDepth.size(); i++ )
+			bHasRenderedDepth = bHasRenderedDepth && m_bDepthImageAcquired[ i ];
+
+		if ( !ReleaseViewImages() )
+			bHasRenderedViews = false;
+
+		ReleaseLayerImages();
+
+		m_xrCurrentFrameStats.Durations[ FRAME_TIMING_RELEASE ] = XRFrameTelemetry::GetTimeNs() - nReleaseStart;
+
+		// All structs submitted this frame live in the arena so nothing is allocated and every chain stays valid until xrEndFrame
+		m_xrFrameArena.Reset();
+
+		// Layers that go under the projection layer (e.g. skyboxes)
+		if ( m_xrFrameState.shouldRender )
+			AddLayersToFrame( true );
+
+		if ( bHasRenderedViews )
+		{
+			// ----------------------------------------------------------------
+			// (e) Add projection view for each rendered swapchain image
+			// ----------------------------------------------------------------
+			XrCompositionLayerProjectionView *pProjectionViews = m_xrFrameArena.AllocateProjectionViews( k_nVRViewCount );
+			XrCompositionLayerDepthInfoKHR *pDepthInfos = bHasRenderedDepth ? m_xrFrameArena.AllocateDepthInfos( k_nVRViewCount ) : nullptr;
+			XrCompositionLayerProjection *pProjectionLayer = m_xrFrameArena.AllocateProjectionLayer();
+			assert( pProjectionViews && pProjectionLayer );
+
+			for ( uint32_t i = 0; i < k_nVRViewCount; i++ )
+			{
+				pProjectionViews[ i ].pose = m_vXRViews[ i ].pose;
+				pProjectionViews[ i ].fov = m_vXRViews[ i ].fov;
+				pProjectionViews[ i ].subImage.swapchain = m_vXRSwapChainsColor[ GetSwapchainIndex( i ) ];
+				pProjectionViews[ i ].subImage.imageArrayIndex = GetTextureArrayIndex( ( EXREye )i );
+				pProjectionViews[ i ].subImage.imageRect = m_xrRenderRects[ i ];
+
+				if ( pDepthInfos )
+				{
+					pDepthInfos[ i ].subImage.swapchain = m_vXRSwapChainsDepth[ GetSwapchainIndex( i ) ];
+					pDepthInfos[ i ].subImage.imageArrayIndex = GetTextureArrayIndex( ( EXREye )i );
+					pDepthInfos[ i ].subImage.imageRect = m_xrRenderRects[ i ];
+					pDepthInfos[ i ].minDepth = 0.0f;
+					pDepthInfos[ i ].maxDepth = 1.0f;
+
+					// nearZ/farZ are the distances at minDepth/maxDepth, so reversed-Z swaps them
+					pDepthInfos[ i ].nearZ = m_xrDepthSubmitInfo.ReversedZ ? m_xrDepthSubmitInfo.FarZ : m_xrDepthSubmitInfo.NearZ;
+					pDepthInfos[ i ].farZ = m_xrDepthSubmitInfo.ReversedZ ? m_xrDepthSubmitInfo.NearZ : m_xrDepthSubmitInfo.FarZ;
+
+					pProjectionViews[ i ].next = &pDepthInfos[ i ];
+				}
+			}
+
+			// ----------------------------------------------------------------
+			// (f) Assemble projection layers
+			// ----------------------------------------------------------------
+			pProjectionLayer->layerFlags = XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT;
+			pProjectionLayer->space = m_pXRCore->GetXRSpace();
+			pProjectionLayer->viewCount = k_nVRViewCount;
+			pProjectionLayer->views = pProjectionViews;
+			m_xrFrameArena.AddLayer( reinterpret_cast< XrCompositionLayerBaseHeader * >( pProjectionLayer ) );
+		}
+
+		// Layers that go on top of the projection layer (e.g. HUDs, panels)
+		if ( m_xrFrameState.shouldRender )
+			AddLayersToFrame( false );
+
+		// Add app layers on top of everything else
+		if ( pAppLayers && m_xrFrameState.shouldRender )
+		{
+			for ( XrCompositionLayerBaseHeader *pAppLayer : *pAppLayers )
+			{
+				if ( !m_xrFrameArena.AddLayer( pAppLayer ) )
+				{
+					XR_LOG_DEFERRED(
+						m_pXRDeferredLog, spdlog::level::warn, 1, "Too many composition layers this frame. Only the first {} will be submitted", XRFrameArena::k_nMaxLayers );
+					break;
+				}
+			}
+		}
+
+		// ========================================================================
+		// (5) End current frame
+		// ========================================================================
+		XrFrameEndInfo xrEndFrameInfo { XR_TYPE_FRAME_END_INFO };
+		xrEndFrameInfo.displayTime = m_xrFrameState.predictedDisplayTime;
+		xrEndFrameInfo.environmentBlendMode =
+			XR_ENVIRONMENT_BLEND_MODE_OPAQUE; // TODO: XR_ENVIRONMENT_BLEND_MODE_ADDITIVE / XR_ENVIRONMENT_BLEND_MODE_ALPHA_BLEND (AR)
+		xrEndFrameInfo.layerCount = m_xrFrameArena.GetLayerCount();
+		xrEndFrameInfo.layers = m_xrFrameArena.GetLayers();
+
+		XrDuration nEndStart = XRFrameTelemetry::GetTimeNs();
+
+		// Latency probe - CPU time from sampling the eye poses this frame is submitted with to submitting it
+		if ( m_bViewsValid )
+			m_pXRCore->GetClock()->RecordLatency( LATENCY_POSE_TO_SUBMIT, nEndStart - m_nViewsLocatedTime );
+
+		m_xrLastCallResult = XR_CALL_DEFERRED( m_pXRDispatchTable->xrEndFrame( m_pXRCore->GetXRSession(), &xrEndFrameInfo ), m_pXRDeferredLog );
+		m_xrCurrentFrameStats.Durations[ FRAME_TIMING_END ] = XRFrameTelemetry::GetTimeNs() - nEndStart;
+
+		// Let the pacing thread begin the next frame
+		if ( m_nFramesInFlight > 0 )
+			SetPacedFrameEnded();
+
+		m_xrFrameTelemetry.Record( m_xrCurrentFrameStats );
+
+		if ( m_xrLastCallResult != XR_SUCCESS )
+		{
+			m_pXRCore->CheckSessionLost( m_xrLastCallResult );
+			return false;
+		}
+
+		return true;
+	}
+
+	void XRRender::SetDynamicResolution( const XRDynamicResolutionInfo &xrDynamicResolution )
+	{
+		m_xrDynamicResolution = xrDynamicResolution;
+
+		// Keep the bounds sane and within what the swapchains can hold
+		m_xrDynamicResolution.MaxScale = std::min( m_xrDynamicResolution.MaxScale, m_fMaxAllocatedScale );
+		m_xrDynamicResolution.MinScale = std::min( std::max( m_xrDynamicResolution.MinScale, 0.1f ), m_xrDynamicResolution.MaxScale );
+
+		m_fRenderScale = m_xrDynamicResolution.Enabled ? std::min( std::max( m_fRenderScale, m_xrDynamicResolution.MinScale ), m_xrDynamicResolution.MaxScale )
+													   : std::min( 1.0f, m_fMaxAllocatedScale );
+		m_nFramesOverBudget = 0;
+		m_nFramesUnderBudget = 0;
+
+		UpdateRenderRects();
+	}
+
+	void XRRender::ReportFrameTimes( XrDuration nCpuFrameTime, XrDuration nGpuFrameTime )
+	{
+		m_nCpuFrameTime = nCpuFrameTime;
+		m_nGpuFrameTime = nGpuFrameTime;
+	}
+
+	XrExtent2Di XRRender::GetSwapchainExtent( uint32_t nView ) const
+	{
+		const XrViewConfigurationView &xrViewConfig = m_vXRViewConfigs[ nView ];
+
+		if ( !m_xrDynamicResolution.Enabled )
+			return { ( int32_t )xrViewConfig.recommendedImageRectWidth, ( int32_t )xrViewConfig.recommendedImageRectHeight };
+
+		// Allocate for the largest rect the app can scale up to
+		float fMaxScale = std::max( m_xrDynamicResolution.MaxScale, 1.0f );
+		return { ( int32_t )std::min( ( uint32_t )( xrViewConfig.recommendedImageRectWidth * fMaxScale ), xrViewConfig.maxImageRectWidth ),
+				 ( int32_t )std::min( ( uint32_t )( xrViewConfig.recommendedImageRectHeight * fMaxScale ), xrViewConfig.maxImageRectHeight ) };
+	}
+
+	void XRRender::UpdateRenderScale()
+	{
+		if ( !m_xrDynamicResolution.Enabled || m_xrPredictedDisplayPeriod <= 0 )
+			return;
+
+		// Scale on whichever of the cpu or gpu is the bottleneck. Each report is only counted once
+		XrDuration nFrameTime = std::max( m_nCpuFrameTime, m_nGpuFrameTime );
+		if ( nFrameTime <= 0 )
+			return;
+
+		m_nCpuFrameTime = 0;
+		m_nGpuFrameTime = 0;
+
+		// ========================================================================
+		// (1) Check frame time against the budget, with separate thresholds for going up and down (hysteresis)
+		// ========================================================================
+		float fFrameTimeRatio = ( float )nFrameTime / ( float )m_xrPredictedDisplayPeriod;
+
+		if ( fFrameTimeRatio > m_xrDynamicResolution.TargetFrameTimeRatio )
+		{
+			m_nFramesOverBudget++;
+			m_nFramesUnderBudget = 0;
+		}
+		else if ( fFrameTimeRatio < m_xrDynamicResolution.IncreaseFrameTimeRatio )
+		{
+			m_nFramesUnderBudget++;
+			m_nFramesOverBudget = 0;
+		}
+		else
+		{
+			m_nFramesOverBudget = 0;
+			m_nFramesUnderBudget = 0;
+		}
+
+		// ========================================================================
+		// (2) Drop pixels quickly when over budget, add them back slowly
+		// ========================================================================
+		float fScale = m_fRenderScale;
 
-		// Generate Swapchain images (color)
-		for ( uint32_t i = 0; i < m_vXRSwapChainsColor.size(); i++ )
+		if ( m_nFramesOverBudget >= m_xrDynamicResolution.DecreaseFrameCount )
 		{
-			m_xrLastCallResult = m_pXRCore->GetGraphicsAPI()->GenerateSwapchainImages( m_vXRSwapChainsColor[ i ], i, false );
-
-			if ( m_xrLastCallResult != XR_SUCCESS )
-			{
-				const char *xrEnumStr = XrEnumToString( m_xrLastCallResult );
-				std::string eMessage = "Failed to generate swapchain color buffers with error ";
-				eMessage.append( xrEnumStr );
+			fScale -= m_xrDynamicResolution.ScaleStep;
+			m_nFramesOverBudget = 0;
+		}
+		else if ( m_nFramesUnderBudget >= m_xrDynamicResolution.IncreaseFrameCount )
+		{
+			fScale += m_xrDynamicResolution.ScaleStep;
+			m_nFramesUnderBudget = 0;
+		}
 
-				m_pXRLogger->error( "{} ({})", eMessage, std::to_string( m_xrLastCallResult ) );
-				throw std::runtime_error( eMessage );
-			}
+		fScale = std::min( std::max( fScale, m_xrDynamicResolution.MinScale ), m_xrDynamicResolution.MaxScale );
 
-			m_pXRLogger->info(
-				"{} Swapchain color buffers generated for eye ({})", m_pXRCore->GetGraphicsAPI()->GetSwapchainImageCount( i == 0 ? EYE_LEFT : EYE_RIGHT, false ), i );
+		if ( fScale != m_fRenderScale )
+		{
+			m_fRenderScale = fScale;
+			UpdateRenderRects();
 		}
+	}
 
-		// Generate Swapchain images (depth)
-		if ( m_bDepthHandling )
+	void XRRender::UpdateRenderRects()
+	{
+		for ( uint32_t i = 0; i < k_nVRViewCount && i < m_vXRViewConfigs.size(); i++ )
 		{
-			for ( uint32_t i = 0; i < m_vXRSwapChainsDepth.size(); i++ )
-			{
-				m_pXRCore->GetGraphicsAPI()->GenerateSwapchainImages( m_vXRSwapChainsDepth[ i ], i, true );
+			int32_t nWidth = ( int32_t )( m_vXRViewConfigs[ i ].recommendedImageRectWidth * m_fRenderScale );
+			int32_t nHeight = ( int32_t )( m_vXRViewConfigs[ i ].recommendedImageRectHeight * m_fRenderScale );
 
-				if ( m_xrLastCallResult != XR_SUCCESS )
-				{
-					const char *xrEnumStr = XrEnumToString( m_xrLastCallResult );
-					std::string eMessage = "Failed to generate swapchain depth buffers with error ";
-					eMessage.append( xrEnumStr );
+			m_xrRenderRects[ i ].offset = { 0, 0 };
+			m_xrRenderRects[ i ].extent.width = std::min( std::max( nWidth, 1 ), ( int32_t )m_nTextureWidth );
+			m_xrRenderRects[ i ].extent.height = std::min( std::max( nHeight, 1 ), ( int32_t )m_nTextureHeight );
+		}
+	}
 
-					m_pXRLogger->error( "{} ({})", eMessage, std::to_string( m_xrLastCallResult ) );
-					throw std::runtime_error( eMessage );
-				}
+	bool XRRender::CreateLayer( const XRLayerInfo &xrLayerInfo, uint32_t *pLayerId )
+	{
+		assert( m_pXRCore && m_pXRLogger );
+		assert( pLayerId );
 
-				m_pXRLogger->info(
-					"{} Swapchain depth buffers generated for eye ({})", m_pXRCore->GetGraphicsAPI()->GetSwapchainImageCount( i == 0 ? EYE_LEFT : EYE_RIGHT, true ), i );
-			}
-		}
-		else
+		// ========================================================================
+		// (1) Check that the runtime supports this layer type
+		// ========================================================================
+		if ( xrLayerInfo.LayerType == LAYER_CYLINDER && !m_pXRCore->GetIsCylinderLayerSupported() )
 		{
-			m_pXRLogger->info("Runtime does not support depth composition. No Swapchain depth buffers will be generated");
+			m_pXRLogger->error( "Unable to create cylinder layer. Runtime does not support {}", XR_KHR_COMPOSITION_LAYER_CYLINDER_EXTENSION_NAME );
+			return false;
 		}
 
-		// Add supported extension - Visibility Mask
-		for	each( void *xrExtension in m_pXRCore->GetXREnabledExtensions() )
-			{
-				XRBaseExt *xrInstanceExtension = static_cast< XRBaseExt * >( xrExtension );
+		if ( xrLayerInfo.LayerType == LAYER_EQUIRECT && !m_pXRCore->GetIsEquirectLayerSupported() )
+		{
+			m_pXRLogger->error( "Unable to create equirect layer. Runtime does not support {}", XR_KHR_COMPOSITION_LAYER_EQUIRECT_EXTENSION_NAME );
+			return false;
+		}
 
-				if ( strcmp( xrInstanceExtension->GetExtensionName(), XR_KHR_VISIBILITY_MASK_EXTENSION_NAME ) == 0 )
-				{
-					m_pXRVisibilityMask = static_cast< XRExtVisibilityMask * >( xrExtension );
+		// ========================================================================
+		// (2) Create the layer's swapchain and retrieve its images
+		// ========================================================================
+		XrSwapchain xrSwapchain = XR_NULL_HANDLE;
+		m_xrLastCallResult = CreateSwapchain(
+			xrLayerInfo.Width,
+			xrLayerInfo.Height,
+			xrLayerInfo.Format == 0 ? m_nTextureFormat : xrLayerInfo.Format,
+			1,
+			1,
+			1,
+			false,
+			xrLayerInfo.IsStatic ? XR_SWAPCHAIN_CREATE_STATIC_IMAGE_BIT : 0,
+			&xrSwapchain );
 
-					m_pXRVisibilityMask->m_xrInstance = m_pXRCore->GetXRInstance();
-					m_pXRVisibilityMask->m_xrSession = m_pXRCore->GetXRSession();
-					break;
-				}
-			}
+		if ( m_xrLastCallResult != XR_SUCCESS )
+			return false;
 
-		m_pXRLogger->info( "Render manager created successfully" );
-	}
+		uint32_t nLayerId = m_nNextLayerId++;
+		m_xrLastCallResult = m_pXRCore->GetGraphicsAPI()->GenerateLayerSwapchainImages( xrSwapchain, nLayerId );
 
-	XRRender::~XRRender()
-	{
-		// Destroy Swapchains
-		DestroySwapchains( m_vXRSwapChainsColor );
-		DestroySwapchains( m_vXRSwapChainsDepth );
+		if ( m_xrLastCallResult != XR_SUCCESS )
+		{
+			m_pXRLogger->error( "Failed to generate swapchain buffers for layer ({}) with error {}", nLayerId, XrEnumToString( m_xrLastCallResult ) );
+			XR_CALL_SILENT( m_pXRDispatchTable->xrDestroySwapchain( xrSwapchain ), m_pXRLogger );
+			return false;
+		}
 
-		// Clear Swapchains
-		m_vXRSwapChainsColor.clear();
-		m_vXRSwapChainsDepth.clear();
+		// ========================================================================
+		// (3) Add the layer, keeping the layers sorted by submission order
+		// ========================================================================
+		XRLayer xrLayer( nLayerId, xrLayerInfo );
+		xrLayer.Swapchain = xrSwapchain;
+		UpdateLayerStruct( xrLayer );
+
+		auto it = std::upper_bound( m_vXRLayers.begin(), m_vXRLayers.end(), xrLayerInfo.Order, []( int32_t nOrder, const XRLayer &xrOther ) {
+			return nOrder < xrOther.Info.Order;
+		} );
+		m_vXRLayers.insert( it, xrLayer );
+
+		m_pXRLogger->info(
+			"Composition layer ({}) created. Type {}, textures are {}x{} with {} image(s), update interval {}{}",
+			nLayerId,
+			xrLayerInfo.LayerType,
+			xrLayerInfo.Width,
+			xrLayerInfo.Height,
+			m_pXRCore->GetGraphicsAPI()->GetLayerSwapchainImageCount( nLayerId ),
+			xrLayerInfo.UpdateInterval,
+			xrLayerInfo.IsStatic ? " (static)" : "" );
+
+		*pLayerId = nLayerId;
+		return true;
 	}
 
-	void XRRender::DestroySwapchains( std::vector< XrSwapchain > &vXRSwapchains )
+	void XRRender::DestroyLayer( uint32_t nLayerId )
 	{
-		uint32_t nSwapChains = ( uint32_t )vXRSwapchains.size();
-		for ( uint32_t i = 0; i < nSwapChains; i++ )
+		for ( auto it = m_vXRLayers.begin(); it != m_vXRLayers.end(); ++it )
 		{
-			if ( vXRSwapchains[ i ] != XR_NULL_HANDLE )
-			{
-				m_xrLastCallResult = XR_CALL_SILENT( xrDestroySwapchain( vXRSwapchains[ i ] ), m_pXRLogger );
-				if ( m_xrLastCallResult != XR_SUCCESS )
-				{
-					const char *xrEnumStr = XrEnumToString( m_xrLastCallResult );
-					std::string eMessage = "Unable to destroy swapchain with error ";
-					eMessage.append( xrEnumStr );
+			if ( it->Id != nLayerId )
+				continue;
 
-					m_pXRLogger->error( "{} ({})", eMessage, std::to_string( m_xrLastCallResult ) );
-					throw std::runtime_error( eMessage );
-				}
-				else
-				{
-					m_pXRLogger->info( "Swapchain destroyed for eye ({})", i );
-				}
+			if ( it->IsImageAcquired )
+			{
+				XrSwapchainImageReleaseInfo xrSwapChainReleaseInfo { XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO };
+				XR_CALL_SILENT( m_pXRDispatchTable->xrReleaseSwapchainImage( it->Swapchain, &xrSwapChainReleaseInfo ), m_pXRLogger );
 			}
+
+			// Swapchain may not have survived a session recreation
+			if ( it->Swapchain != XR_NULL_HANDLE )
+				m_xrLastCallResult = XR_CALL_SILENT( m_pXRDispatchTable->xrDestroySwapchain( it->Swapchain ), m_pXRLogger );
+			m_pXRCore->GetGraphicsAPI()->ClearLayerSwapchainImages( nLayerId );
+			m_vXRLayers.erase( it );
+
+			m_pXRLogger->info( "Composition layer ({}) destroyed", nLayerId );
+			return;
 		}
 	}
 
-	void XRRender::ResetHMDState()
+	bool XRRender::GetLayerNeedsUpdate( uint32_t nLayerId )
 	{
-		m_pXRHMDState->LeftEye.Pose = { { 0.f, 0.f, 0.f, 1.f }, { 0.f, 0.f, 0.f } };
-		m_pXRHMDState->RightEye.Pose = { { 0.f, 0.f, 0.f, 1.f }, { 0.f, 0.f, 0.f } };
+		XRLayer *pLayer = GetLayer( nLayerId );
+		if ( !pLayer )
+			return false;
 
-		m_pXRHMDState->LeftEye.FoV = { -k_fTau, k_fTau, k_fTau, -k_fTau };
-		m_pXRHMDState->RightEye.FoV = { -k_fTau, k_fTau, k_fTau, -k_fTau };
+		if ( !pLayer->HasContent )
+			return true;
 
-		m_pXRHMDState->IsPositionTracked = false;
-		m_pXRHMDState->IsOrientationTracked = false;
+		if ( pLayer->Info.IsStatic )
+			return false;
+
+		return pLayer->FramesSinceUpdate >= pLayer->Info.UpdateInterval;
 	}
 
-	bool XRRender::ProcessXRFrame()
+	bool XRRender::AcquireLayerImage( uint32_t nLayerId, uint32_t *pImageIndex )
 	{
-		assert( m_pXRCore && m_pXRLogger );
-
-		// ========================================================================
-		// (1) Wait for a new frame
-		// ========================================================================
-		XrFrameWaitInfo xrWaitFrameInfo { XR_TYPE_FRAME_WAIT_INFO };
-		XrFrameState xrFrameState { XR_TYPE_FRAME_STATE };
+		assert( pImageIndex );
 
-		m_xrLastCallResult = XR_CALL_SILENT( xrWaitFrame( m_pXRCore->GetXRSession(), &xrWaitFrameInfo, &xrFrameState ), m_pXRLogger );
-		if ( m_xrLastCallResult != XR_SUCCESS )
+		if ( !m_bFrameBegun || !m_xrFrameState.shouldRender )
 			return false;
 
-		m_xrPredictedDisplayTime = xrFrameState.predictedDisplayTime;
-		m_xrPredictedDisplayPeriod = xrFrameState.predictedDisplayPeriod;
-
-		// ========================================================================
-		// (2) Begin frame before doing any GPU work
-		// ========================================================================
-		XrFrameBeginInfo xrBeginFrameInfo { XR_TYPE_FRAME_BEGIN_INFO };
-		m_xrLastCallResult = XR_CALL_SILENT( xrBeginFrame( m_pXRCore->GetXRSession(), &xrBeginFrameInfo ), m_pXRLogger );
-		if ( m_xrLastCallResult != XR_SUCCESS )
+		XRLayer *pLayer = GetLayer( nLayerId );
+		if ( !pLayer )
 			return false;
 
-		std::vector< XrCompositionLayerBaseHeader * > xrFrameLayers;
-		XrCompositionLayerProjectionView xrFrameLayerProjectionViews[ k_nVRViewCount ];
-		XrCompositionLayerProjection xrFrameLayerProjection { XR_TYPE_COMPOSITION_LAYER_PROJECTION };
+		// Static swapchains can only ever be acquired once
+		if ( pLayer->Info.IsStatic && pLayer->HasContent )
+			return false;
 
-		if ( xrFrameState.shouldRender )
+		if ( !pLayer->IsImageAcquired )
 		{
-			// ========================================================================
-			// (3) Get space and time information for this frame
-			// ========================================================================
-
-			XrViewLocateInfo xrFrameSpaceTimeInfo { XR_TYPE_VIEW_LOCATE_INFO };
-			xrFrameSpaceTimeInfo.displayTime = xrFrameState.predictedDisplayTime;
-			xrFrameSpaceTimeInfo.space = m_pXRCore->GetXRSpace();
+			XrSwapchainImageAcquireInfo xrAcquireInfo { XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO };
+			m_xrLastCallResult = XR_CALL_DEFERRED( m_pXRDispatchTable->xrAcquireSwapchainImage( pLayer->Swapchain, &xrAcquireInfo, &pLayer->AcquiredImageIndex ), m_pXRDeferredLog );
+			if ( m_xrLastCallResult != XR_SUCCESS )
+				return false;
 
-			XrViewState xrFrameViewState { XR_TYPE_VIEW_STATE };
-			uint32_t nFoundViewsCount;
-			m_xrLastCallResult = XR_CALL_SILENT(
-				xrLocateViews(
-					m_pXRCore->GetXRSession(), &xrFrameSpaceTimeInfo, &xrFrameViewState, ( uint32_t )m_vXRViews.size(), &nFoundViewsCount, m_vXRViews.data() ),
-				m_pXRLogger );
+			pLayer->IsImageAcquired = true;
 
+			XrSwapchainImageWaitInfo xrWaitInfo { XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO };
+			xrWaitInfo.timeout = XR_INFINITE_DURATION;
+			m_xrLastCallResult = XR_CALL_DEFERRED( m_pXRDispatchTable->xrWaitSwapchainImage( pLayer->Swapchain, &xrWaitInfo ), m_pXRDeferredLog );
 			if ( m_xrLastCallResult != XR_SUCCESS )
 				return false;
+		}
 
-			// ========================================================================
-			// (4) Grab image from swapchain and render
-			// ========================================================================
+		*pImageIndex = pLayer->AcquiredImageIndex;
+		return true;
+	}
 
-			// Update HMD State
-			m_pXRHMDState->IsPositionTracked = xrFrameViewState.viewStateFlags & XR_VIEW_STATE_POSITION_TRACKED_BIT;
-			m_pXRHMDState->IsOrientationTracked = xrFrameViewState.viewStateFlags & XR_VIEW_STATE_ORIENTATION_TRACKED_BIT;
+	void XRRender::SetLayerPose( uint32_t nLayerId, const XrPosef &xrPose )
+	{
+		XRLayer *pLayer = GetLayer( nLayerId );
+		if ( !pLayer )
+			return;
 
-			if ( xrFrameViewState.viewStateFlags & XR_VIEW_STATE_POSITION_VALID_BIT && xrFrameViewState.viewStateFlags & XR_VIEW_STATE_ORIENTATION_VALID_BIT )
-			{
-				// Update hmd state
-				SetHMDState( EXREye::EYE_LEFT, &( m_pXRHMDState->LeftEye ) );
-				SetHMDState( EXREye::EYE_RIGHT, &( m_pXRHMDState->RightEye ) );
+		pLayer->Info.Pose = xrPose;
+		UpdateLayerStruct( *pLayer );
+	}
 
-				// Grab the corresponding swapchain for each view location
-				uint32_t nViewCount = ( uint32_t )m_vXRViewConfigs.size();
+	void XRRender::SetLayerVisible( uint32_t nLayerId, bool bIsVisible )
+	{
+		XRLayer *pLayer = GetLayer( nLayerId );
+		if ( pLayer )
+			pLayer->IsVisible = bIsVisible;
+	}
 
-				for ( uint32_t i = 0; i < nViewCount; i++ )
-				{
-					// ----------------------------------------------------------------
-					// (a) Acquire swapchain image
-					// ----------------------------------------------------------------
-					const XrSwapchain xrSwapchain = m_vXRSwapChainsColor[ i ];
-					XrSwapchainImageAcquireInfo xrAcquireInfo { XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO };
-					uint32_t nImageIndex;
-					m_xrLastCallResult = XR_CALL_SILENT( xrAcquireSwapchainImage( xrSwapchain, &xrAcquireInfo, &nImageIndex ), m_pXRLogger );
-
-					if ( m_xrLastCallResult != XR_SUCCESS )
-						return false;
-
-					// ----------------------------------------------------------------
-					// (b) Wait for swapchain image
-					// ----------------------------------------------------------------
-					XrSwapchainImageWaitInfo xrWaitInfo { XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO };
-					xrWaitInfo.timeout = XR_INFINITE_DURATION;
-					m_xrLastCallResult = XR_CALL_SILENT( xrWaitSwapchainImage( xrSwapchain, &xrWaitInfo ), m_pXRLogger );
-
-					if ( m_xrLastCallResult != XR_SUCCESS )
-						return false;
-
-					// ----------------------------------------------------------------
-					// (c) Add projection view to swapchain image
-					// ----------------------------------------------------------------
-
-					xrFrameLayerProjectionViews[ i ] = { XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW };
-					xrFrameLayerProjectionViews[ i ].pose = m_vXRViews[ i ].pose;
-					xrFrameLayerProjectionViews[ i ].fov = m_vXRViews[ i ].fov;
-					xrFrameLayerProjectionViews[ i ].subImage.swapchain = xrSwapchain;
-					xrFrameLayerProjectionViews[ i ].subImage.imageArrayIndex = 0;
-					xrFrameLayerProjectionViews[ i ].subImage.imageRect.offset = { 0, 0 };
-					xrFrameLayerProjectionViews[ i ].subImage.imageRect.extent = { ( int32_t )m_nTextureWidth, ( int32_t )m_nTextureHeight };
-
-					if ( m_bDepthHandling )
-					{
-						XrCompositionLayerDepthInfoKHR xrDepthInfo{ XR_TYPE_COMPOSITION_LAYER_DEPTH_INFO_KHR };
-						xrDepthInfo.subImage.swapchain = m_vXRSwapChainsDepth[ i ];
-						xrDepthInfo.subImage.imageArrayIndex = 0;
-						xrDepthInfo.subImage.imageRect.offset = { 0, 0 };
-						xrDepthInfo.subImage.imageRect.extent = { ( int32_t )m_nTextureWidth, ( int32_t )m_nTextureHeight };
-						xrDepthInfo.minDepth = 0.0f;
-						xrDepthInfo.maxDepth = 1.0f;
-						xrDepthInfo.nearZ = 0.1f;
-						xrDepthInfo.farZ = FLT_MAX;
-
-						xrFrameLayerProjectionViews[i].next = &xrDepthInfo;
-					}
+	XRLayer *XRRender::GetLayer( uint32_t nLayerId )
+	{
+		for ( XRLayer &xrLayer : m_vXRLayers )
+		{
+			if ( xrLayer.Id == nLayerId )
+				return &xrLayer;
+		}
 
-					// ----------------------------------------------------------------
-					// (d) Release swapchain image
-					// ----------------------------------------------------------------
-					XrSwapchainImageReleaseInfo xrSwapChainRleaseInfo { XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO };
-					m_xrLastCallResult = XR_CALL_SILENT( xrReleaseSwapchainImage( xrSwapchain, &xrSwapChainRleaseInfo ), m_pXRLogger );
+		return nullptr;
+	}
 
-					if ( m_xrLastCallResult != XR_SUCCESS )
-						return false;
-				}
+	void XRRender::UpdateLayerStruct( XRLayer &xrLayer )
+	{
+		const XRLayerInfo &xrInfo = xrLayer.Info;
+
+		XrSwapchainSubImage xrSubImage {};
+		xrSubImage.swapchain = xrLayer.Swapchain;
+		xrSubImage.imageArrayIndex = 0;
+		xrSubImage.imageRect.offset = { 0, 0 };
+		xrSubImage.imageRect.extent = { ( int32_t )xrInfo.Width, ( int32_t )xrInfo.Height };
+
+		XrSpace xrSpace = xrInfo.Space == XR_NULL_HANDLE ? m_pXRCore->GetXRSpace() : xrInfo.Space;
+
+		switch ( xrInfo.LayerType )
+		{
+			case LAYER_QUAD:
+				xrLayer.Quad = { XR_TYPE_COMPOSITION_LAYER_QUAD };
+				xrLayer.Quad.layerFlags = xrInfo.LayerFlags;
+				xrLayer.Quad.space = xrSpace;
+				xrLayer.Quad.eyeVisibility = xrInfo.EyeVisibility;
+				xrLayer.Quad.subImage = xrSubImage;
+				xrLayer.Quad.pose = xrInfo.Pose;
+				xrLayer.Quad.size = xrInfo.QuadSize;
+				break;
+
+			case LAYER_CYLINDER:
+				xrLayer.Cylinder = { XR_TYPE_COMPOSITION_LAYER_CYLINDER_KHR };
+				xrLayer.Cylinder.layerFlags = xrInfo.LayerFlags;
+				xrLayer.Cylinder.space = xrSpace;
+				xrLayer.Cylinder.eyeVisibility = xrInfo.EyeVisibility;
+				xrLayer.Cylinder.subImage = xrSubImage;
+				xrLayer.Cylinder.pose = xrInfo.Pose;
+				xrLayer.Cylinder.radius = xrInfo.CylinderRadius;
+				xrLayer.Cylinder.centralAngle = xrInfo.CylinderCentralAngle;
+				xrLayer.Cylinder.aspectRatio = xrInfo.CylinderAspectRatio;
+				break;
+
+			case LAYER_EQUIRECT:
+				xrLayer.Equirect = { XR_TYPE_COMPOSITION_LAYER_EQUIRECT_KHR };
+				xrLayer.Equirect.layerFlags = xrInfo.LayerFlags;
+				xrLayer.Equirect.space = xrSpace;
+				xrLayer.Equirect.eyeVisibility = xrInfo.EyeVisibility;
+				xrLayer.Equirect.subImage = xrSubImage;
+				xrLayer.Equirect.pose = xrInfo.Pose;
+				xrLayer.Equirect.radius = xrInfo.EquirectRadius;
+				xrLayer.Equirect.scale = xrInfo.EquirectScale;
+				xrLayer.Equirect.bias = xrInfo.EquirectBias;
+				break;
+		}
+	}
+
+	void XRRender::ReleaseLayerImages()
+	{
+		XrSwapchainImageReleaseInfo xrSwapChainReleaseInfo { XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO };
+
+		for ( XRLayer &xrLayer : m_vXRLayers )
+		{
+			if ( !xrLayer.IsImageAcquired )
+			{
+				xrLayer.FramesSinceUpdate++;
+				continue;
 			}
 
-			// ----------------------------------------------------------------
-			// (e) Assemble projection layers
-			// ----------------------------------------------------------------
-			xrFrameLayerProjection.layerFlags = XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT;
-			xrFrameLayerProjection.space = m_pXRCore->GetXRSpace();
-			xrFrameLayerProjection.viewCount = k_nVRViewCount;
-			xrFrameLayerProjection.views = xrFrameLayerProjectionViews;
-			xrFrameLayers.push_back( reinterpret_cast< XrCompositionLayerBaseHeader * >( &xrFrameLayerProjection ) );
+			m_xrLastCallResult = XR_CALL_DEFERRED( m_pXRDispatchTable->xrReleaseSwapchainImage( xrLayer.Swapchain, &xrSwapChainReleaseInfo ), m_pXRDeferredLog );
+			xrLayer.IsImageAcquired = false;
+
+			if ( m_xrLastCallResult == XR_SUCCESS )
+			{
+				xrLayer.HasContent = true;
+				xrLayer.FramesSinceUpdate = 1;
+			}
 		}
+	}
 
-		// ========================================================================
-		// (5) End current frame
-		// ========================================================================
-		XrFrameEndInfo xrEndFrameInfo { XR_TYPE_FRAME_END_INFO };
-		xrEndFrameInfo.displayTime = xrFrameState.predictedDisplayTime;
-		xrEndFrameInfo.environmentBlendMode =
-			XR_ENVIRONMENT_BLEND_MODE_OPAQUE; // TODO: XR_ENVIRONMENT_BLEND_MODE_ADDITIVE / XR_ENVIRONMENT_BLEND_MODE_ALPHA_BLEND (AR)
-		xrEndFrameInfo.layerCount = ( uint32_t )xrFrameLayers.size();
-		xrEndFrameInfo.layers = xrFrameLayers.data();
+	void XRRender::AddLayersToFrame( bool bUnderlay )
+	{
+		for ( XRLayer &xrLayer : m_vXRLayers )
+		{
+			if ( ( xrLayer.Info.Order < 0 ) != bUnderlay || !xrLayer.IsVisible || !xrLayer.HasContent )
+				continue;
 
-		m_xrLastCallResult = XR_CALL_SILENT( xrEndFrame( m_pXRCore->GetXRSession(), &xrEndFrameInfo ), m_pXRLogger );
-		if ( m_xrLastCallResult != XR_SUCCESS )
+			if ( !m_xrFrameArena.AddLayer( &xrLayer.Header ) )
+			{
+				m_pXRLogger->warn( "Too many composition layers this frame. Only the first {} will be submitted", XRFrameArena::k_nMaxLayers );
+				return;
+			}
+		}
+	}
+
+	bool XRRender::ProcessXRFrame()
+	{
+		if ( !WaitFrame() || !BeginFrame() )
 			return false;
 
-		return true;
+		AcquireViewImages();
+		return EndFrame();
 	}
 
 	OpenXRProvider::XRGraphicsAPI *XRRender::GetGraphicsAPI()
@@ -434,6 +1600,14 @@ namespace OpenXRProvider
 		return m_pXRCore->GetGraphicsAPI();
 	}
 
+#ifdef XR_USE_GRAPHICS_API_OPENGL
+	uint32_t XRRender::GetRenderTarget( EXREye eEye )
+	{
+		uint32_t nSwapchainIndex = GetSwapchainIndex( eEye );
+		return m_pXRCore->GetGraphicsAPI()->GetRenderTarget( eEye, m_nAcquiredColorImageIndex[ nSwapchainIndex ], m_nAcquiredDepthImageIndex[ nSwapchainIndex ] );
+	}
+#endif
+
 	void XRRender::SetHMDState( EXREye eEye, XREyeState *pEyeState )
 	{
 		assert( pEyeState );
@@ -485,18 +1659,43 @@ namespace OpenXRProvider
 		assert( m_pXRCore );
 		assert( m_pXRCore->GetXRSession() != XR_NULL_HANDLE );
 
+		// Key the chosen formats on what the app requested (and whether depth can be handled at all)
+		uint64_t nRequestedFormatsHash = XRCapabilityCache::Hash( vAppTextureFormats.data(), vAppTextureFormats.size() * sizeof( int64_t ) );
+		nRequestedFormatsHash = XRCapabilityCache::Hash( vAppDepthFormats.data(), vAppDepthFormats.size() * sizeof( int64_t ), nRequestedFormatsHash );
+		nRequestedFormatsHash = XRCapabilityCache::Hash( &m_bDepthHandling, sizeof( m_bDepthHandling ), nRequestedFormatsHash );
+
+		// Use the formats chosen on the last launch if neither the runtime nor the app's request changed
+		XRCapabilityCache *pXRCapabilityCache = m_pXRCore->GetCapabilityCache();
+		if ( pXRCapabilityCache && pXRCapabilityCache->GetIsValid() && pXRCapabilityCache->GetCapabilities().ColorFormat != 0 &&
+			 pXRCapabilityCache->GetCapabilities().RequestedFormatsHash == nRequestedFormatsHash )
+		{
+			const XRRuntimeCapabilities &xrCapabilities = pXRCapabilityCache->GetCapabilities();
+
+			m_nTextureFormat = xrCapabilities.ColorFormat;
+			m_nDepthFormat = xrCapabilities.DepthFormat;
+			m_bDepthHandling = m_nDepthFormat != 0;
+
+			m_pXRLogger->info(
+				"Using cached texture formats. Color {} ({}), depth {} ({})",
+				m_pXRCore->GetGraphicsAPI()->GetTextureFormatName( m_nTextureFormat ),
+				m_nTextureFormat,
+				m_bDepthHandling ? m_pXRCore->GetGraphicsAPI()->GetTextureFormatName( m_nDepthFormat ) : "none",
+				m_nDepthFormat );
+			return;
+		}
+
 		// Check number of swapchain formats supported by the runtime
 		uint32_t nNumOfSupportedFormats = 0;
-		m_xrLastCallResult = XR_CALL( xrEnumerateSwapchainFormats( m_pXRCore->GetXRSession(), 0, &nNumOfSupportedFormats, nullptr ), m_pXRLogger, true )
+		m_xrLastCallResult = XR_CALL( m_pXRDispatchTable->xrEnumerateSwapchainFormats( m_pXRCore->GetXRSession(), 0, &nNumOfSupportedFormats, nullptr ), m_pXRLogger, true );
 
 		// Get swapchain formats supported by the runtime
 		std::vector< int64_t > vRuntimeSwapChainFormats;
 		vRuntimeSwapChainFormats.resize( nNumOfSupportedFormats );
 
 		m_xrLastCallResult = XR_CALL(
-				xrEnumerateSwapchainFormats( m_pXRCore->GetXRSession(), nNumOfSupportedFormats, &nNumOfSupportedFormats, vRuntimeSwapChainFormats.data() ),
+				m_pXRDispatchTable->xrEnumerateSwapchainFormats( m_pXRCore->GetXRSession(), nNumOfSupportedFormats, &nNumOfSupportedFormats, vRuntimeSwapChainFormats.data() ),
 			m_pXRLogger,
-			true )
+			true );
 
 		// Look for a matching texture format that the app requested vs what's supported by the runtime
 		m_pXRLogger->info( "Runtime supports the following texture formats in order of preference:" );
@@ -550,57 +1749,173 @@ namespace OpenXRProvider
 		{
 			m_pXRLogger->info( "Session will not support depth textures" );
 			m_bDepthHandling = false;
-		}	
+		}
+
+		// Store what was negotiated for the next launch
+		if ( pXRCapabilityCache )
+		{
+			XRRuntimeCapabilities &xrCapabilities = pXRCapabilityCache->GetCapabilities();
+			xrCapabilities.SwapchainFormats = vRuntimeSwapChainFormats;
+			xrCapabilities.RequestedFormatsHash = nRequestedFormatsHash;
+			xrCapabilities.ColorFormat = m_nTextureFormat;
+			xrCapabilities.DepthFormat = m_bDepthHandling ? m_nDepthFormat : 0;
+
+			if ( pXRCapabilityCache->Save() )
+				m_pXRLogger->info( "Runtime capabilities written to the capability cache" );
+		}
+	}
+
+	XrResult XRRender::CreateSwapchain(
+		uint32_t nWidth,
+		uint32_t nHeight,
+		int64_t nFormat,
+		uint32_t nArraySize,
+		uint32_t nMipCount,
+		uint32_t nSampleCount,
+		bool bIsDepth,
+		XrSwapchainCreateFlags xrCreateFlags,
+		XrSwapchain *pSwapchain,
+		XrSwapchainCreateInfo *pCreateInfo /*= nullptr */ )
+	{
+		XrSwapchainCreateInfo xrSwapChainCreateInfo { XR_TYPE_SWAPCHAIN_CREATE_INFO };
+		xrSwapChainCreateInfo.createFlags = xrCreateFlags;
+		xrSwapChainCreateInfo.arraySize = nArraySize;
+		xrSwapChainCreateInfo.format = nFormat;
+		xrSwapChainCreateInfo.width = nWidth;
+		xrSwapChainCreateInfo.height = nHeight;
+		xrSwapChainCreateInfo.mipCount = nMipCount;
+		xrSwapChainCreateInfo.faceCount = 1;
+		xrSwapChainCreateInfo.sampleCount = nSampleCount;
+
+		if ( bIsDepth )
+		{
+			xrSwapChainCreateInfo.usageFlags = XR_SWAPCHAIN_USAGE_SAMPLED_BIT | XR_SWAPCHAIN_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+		}
+		else
+		{
+			xrSwapChainCreateInfo.usageFlags = XR_SWAPCHAIN_USAGE_SAMPLED_BIT | XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT;
+		}
+
+		if ( pCreateInfo )
+			*pCreateInfo = xrSwapChainCreateInfo;
+
+		return XR_CALL_SILENT( m_pXRDispatchTable->xrCreateSwapchain( m_pXRCore->GetXRSession(), &xrSwapChainCreateInfo, pSwapchain ), m_pXRLogger );
 	}
 
 	void XRRender::GenerateSwapchains( bool bIsDepth )
 	{
-		for ( size_t i = 0; i < m_vXRViews.size(); i++ )
+		// In stereo texture array mode both eyes share a single swapchain, each eye rendering to its own array slice
+		size_t nSwapchainCount = m_bStereoTextureArray ? 1 : m_vXRViews.size();
+		for ( size_t i = 0; i < nSwapchainCount; i++ )
 		{
 			XrSwapchain xrSwapChain;
 			XrSwapchainCreateInfo xrSwapChainCreateInfo { XR_TYPE_SWAPCHAIN_CREATE_INFO };
-			xrSwapChainCreateInfo.arraySize = m_nTextureArraySize;
-			xrSwapChainCreateInfo.format = bIsDepth ? m_nDepthFormat : m_nTextureFormat;
-			xrSwapChainCreateInfo.width = m_vXRViewConfigs[ i ].recommendedImageRectWidth;
-			xrSwapChainCreateInfo.height = m_vXRViewConfigs[ i ].recommendedImageRectHeight;
-			xrSwapChainCreateInfo.mipCount = m_nTextureMipCount;
-			xrSwapChainCreateInfo.faceCount = 1;
-			xrSwapChainCreateInfo.sampleCount = m_vXRViewConfigs[ i ].recommendedSwapchainSampleCount;
+			XrExtent2Di xrSwapchainExtent = GetSwapchainExtent( ( uint32_t )i );
+			m_xrLastCallResult = CreateSwapchain(
+				( uint32_t )xrSwapchainExtent.width,
+				( uint32_t )xrSwapchainExtent.height,
+				bIsDepth ? m_nDepthFormat : m_nTextureFormat,
+				m_nTextureArraySize,
+				m_nTextureMipCount,
+				m_vXRViewConfigs[ i ].recommendedSwapchainSampleCount,
+				bIsDepth,
+				0,
+				&xrSwapChain,
+				&xrSwapChainCreateInfo );
 
-			if ( bIsDepth )
-			{
-				xrSwapChainCreateInfo.usageFlags = XR_SWAPCHAIN_USAGE_SAMPLED_BIT | XR_SWAPCHAIN_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
-			}
-			else
+			if ( m_xrLastCallResult != XR_SUCCESS )
 			{
-				xrSwapChainCreateInfo.usageFlags = XR_SWAPCHAIN_USAGE_SAMPLED_BIT | XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT;
-			}
+				std::string eMessage = "Failed to create swapchain with error ";
+				eMessage.append( XrEnumToString( m_xrLastCallResult ) );
 
-			m_xrLastCallResult = XR_CALL( xrCreateSwapchain( m_pXRCore->GetXRSession(), &xrSwapChainCreateInfo, &xrSwapChain ), m_pXRLogger, true );
+				m_pXRLogger->error( "{} ({})", eMessage, std::to_string( m_xrLastCallResult ) );
+				throw std::runtime_error( eMessage );
+			}
 
 			if ( bIsDepth )
 			{
 				m_vXRSwapChainsDepth.push_back( xrSwapChain );
+				m_vXRSwapChainInfosDepth.push_back( xrSwapChainCreateInfo );
 				m_pXRLogger->info(
-					"Depth Swapchain created for eye ({}). Textures are {}x{} with {} sample(s) and {} Mip(s)",
-					i,
+					"Depth Swapchain created for eye ({}). Textures are {}x{} with {} sample(s), {} Mip(s) and {} array slice(s)",
+					m_bStereoTextureArray ? "both" : std::to_string( i ),
 					m_nTextureWidth,
 					m_nTextureHeight,
 					m_vXRViewConfigs[ i ].recommendedSwapchainSampleCount,
-					m_nTextureMipCount );
+					m_nTextureMipCount,
+					m_nTextureArraySize );
 			}
 			else
 			{
 				m_vXRSwapChainsColor.push_back( xrSwapChain );
+				m_vXRSwapChainInfosColor.push_back( xrSwapChainCreateInfo );
 				m_pXRLogger->info(
-					"Color Swapchain created for eye ({}). Textures are {}x{} with {} sample(s) and {} Mip(s)",
-					i,
+					"Color Swapchain created for eye ({}). Textures are {}x{} with {} sample(s), {} Mip(s) and {} array slice(s)",
+					m_bStereoTextureArray ? "both" : std::to_string( i ),
 					m_nTextureWidth,
 					m_nTextureHeight,
 					m_vXRViewConfigs[ i ].recommendedSwapchainSampleCount,
-					m_nTextureMipCount );
+					m_nTextureMipCount,
+					m_nTextureArraySize );
+			}
+		}
+	}
+
+	bool XRRender::ValidateDepthSwapchains()
+	{
+		if ( m_vXRSwapChainInfosDepth.size() != m_vXRSwapChainInfosColor.size() )
+		{
+			m_pXRLogger->error( "{} depth swapchain(s) were created for {} color swapchain(s)", m_vXRSwapChainInfosDepth.size(), m_vXRSwapChainInfosColor.size() );
+			return false;
+		}
+
+		// Compare what the runtime was actually asked to create, the depth sub image is submitted with the color sub image's rect and array index
+		for ( size_t i = 0; i < m_vXRSwapChainInfosDepth.size(); i++ )
+		{
+			const XrSwapchainCreateInfo &xrDepthInfo = m_vXRSwapChainInfosDepth[ i ];
+			const XrSwapchainCreateInfo &xrColorInfo = m_vXRSwapChainInfosColor[ i ];
+
+			if ( xrDepthInfo.width != xrColorInfo.width || xrDepthInfo.height != xrColorInfo.height || xrDepthInfo.sampleCount != xrColorInfo.sampleCount ||
+				 xrDepthInfo.arraySize != xrColorInfo.arraySize )
+			{
+				m_pXRLogger->error(
+					"Depth swapchain ({}x{}, {} sample(s), {} array slice(s)) doesn't match its color swapchain ({}x{}, {} sample(s), {} array slice(s))",
+					xrDepthInfo.width,
+					xrDepthInfo.height,
+					xrDepthInfo.sampleCount,
+					xrDepthInfo.arraySize,
+					xrColorInfo.width,
+					xrColorInfo.height,
+					xrColorInfo.sampleCount,
+					xrColorInfo.arraySize );
+				return false;
 			}
 		}
+
+		return true;
+	}
+
+	bool XRRender::SetDepthSubmitInfo( float fNearZ, float fFarZ, bool bReversedZ, bool bSubmit )
+	{
+		if ( !m_bDepthHandling )
+		{
+			m_pXRLogger->warn( "Depth submit info ignored. Depth textures weren't requested in XRRenderInfo, or the runtime doesn't support depth composition" );
+			return false;
+		}
+
+		// The runtime needs a positive, non-empty depth range to reproject with
+		if ( !( fNearZ > 0.0f ) || !( fFarZ > fNearZ ) )
+		{
+			m_pXRLogger->warn( "Invalid depth range submitted (near {}, far {}). Depth range not changed", fNearZ, fFarZ );
+			return false;
+		}
+
+		m_xrDepthSubmitInfo.NearZ = fNearZ;
+		m_xrDepthSubmitInfo.FarZ = fFarZ;
+		m_xrDepthSubmitInfo.ReversedZ = bReversedZ;
+		m_xrDepthSubmitInfo.Submit = bSubmit;
+
+		return bSubmit;
 	}
 
 } // namespace OpenXRProvider
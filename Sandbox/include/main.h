@@ -44,7 +44,7 @@ enum ESandboxScene
 /// Setup the sandbox application - windowing and opengl support
 int AppSetup();
 
-/// Setup the OpenGL objects (VAO, VBO, FBO) needed for rendering to textures from the OpenXR runtime
+/// Setup the OpenGL objects (VAO, VBO) needed for rendering to textures from the OpenXR runtime
 int GraphicsAPIObjectsSetup();
 
 /// Blit (copy) swapchain image that's rendered to the HMD to the desktop screem (XR Mirror)
@@ -53,16 +53,19 @@ void BlitToWindow();
 /// Render to the swapchain image (texture) that'll be rendered to the user's HMD and blitted (copied) to
 /// the Sandbox's window (XR Mirror)
 /// @param[in] eEye					The eye (left/right) texture that will be rendered on
-/// @param[in] nSwapchainIndex		The index of the swapchain image (texture)
 void DrawFrame(
-	OpenXRProvider::EXREye eEye,
-	uint32_t nSwapchainIndex
+	OpenXRProvider::EXREye eEye
 	);
 
-/// Callback for session state changes TODO: Use native OpenXR type
-/// @param[in] xrEventType	The type of event that triggered the callback (e.g. Session state change, reference space changed, etc)
-/// @param[in] xrEventData	The data payload of the event (e.g. The new session state, etc)
-static void Callback_XR_Event( XrEventDataBuffer xrEvent );
+/// Callback for session state changes
+/// @param[in] xrEvent			The event that triggered the callback (e.g. Session state change, reference space changed, etc)
+/// @param[in] pUserContext		App data registered with the callback (unused)
+static void Callback_XR_Event( const XrEventDataBuffer &xrEvent, void *pUserContext );
+
+/// Callback for the OpenXR Provider's asynchronous initialization progress
+/// @param[in] eXRInitPhase		The initialization phase that's starting
+/// @param[in] pUserContext		App data passed to CreateAsync (unused)
+static void Callback_XR_InitProgress( OpenXRProvider::EXRInitPhase eXRInitPhase, void *pUserContext );
 
 // Set callback for key input
 /// @param[in] pWindow		Pointer to the GLFW window
@@ -114,9 +117,6 @@ unsigned int lightVAO;
 /// The OpenGL Element Buffer Object (cube) used in rendering processes
 unsigned int cubeEBO;
 
-/// The OpenGL Frame Buffer Object (hmd texture) used in rendering processes
-unsigned int FBO;
-
 /// The width of the desktop window (XR Mirror)
 int nScreenWidth = 1920;
 
@@ -126,9 +126,6 @@ int nScreenHeight = 1080;
 /// The number of images (Texture2D) that are in the swapchain created by the OpenXR runtime
 uint32_t nSwapchainCapacity = 0;
 
-/// The current index of the swapchain array 
-uint32_t nSwapchainIndex = 0;
-
 /// The current frame number (internal to the sandbox application)
 uint64_t nFrameNumber = 1;
 
@@ -195,13 +192,18 @@ OpenXRProvider::XRExtHandJointsMotionRange* pXRHandJointsMotionRange = nullptr;
 XrActionSet xrActionSet_Main;
 
 // Action states
-XrActionStateBoolean xrActionState_SwitchScene;
 XrActionStatePose xrActionState_PoseLeft, xrActionState_PoseRight;
 
 // Actions
 XrAction xrAction_SwitchScene, xrAction_Haptic;
 XrAction xrAction_PoseLeft, xrAction_PoseRight;
 
+// Handle of the switch scene action in the input events
+uint32_t nActionHandle_SwitchScene = OpenXRProvider::XRInput::k_nInvalidActionHandle;
+
+// Slots of the controller action spaces in the space registry
+uint32_t nSpaceSlot_PoseLeft = 0, nSpaceSlot_PoseRight = 0;
+
 // Location and velocities for the controllers
 XrSpaceLocation xrLocation_Left { XR_TYPE_SPACE_LOCATION };
 XrSpaceLocation xrLocation_Right { XR_TYPE_SPACE_LOCATION };
@@ -211,7 +213,7 @@ XrSpaceVelocity xrVelocity_Right { XR_TYPE_SPACE_VELOCITY };
 
 /// Draw the controller meshes for each hand
 /// @param[in]	eEye				Current eye to render to
-/// @param[in]	nSwapchainIndex		Texture in the swapchain to render to
+/// @param[in]	eyeView				The eye view matrix
 void DrawControllers( OpenXRProvider::EXREye eEye, glm::mat4 eyeView );
 
 /// Generate all input action bindings to multiple controllers
@@ -314,18 +316,13 @@ glm::mat4 m_EyeProjectionLeft;
 /// The right eye view (camera) projection matrix
 glm::mat4 m_EyeProjectionRight;
 
-/// A OpenGL map of color texture id to depth texture id
-std::map< uint32_t, uint32_t > m_mapColorDepth;
-
 /// Draw a scene with a sea of instanced textured cubes in the scene based on the number of textures provided
 /// @param[in]	eEye				Current eye to render to
-/// @param[in]	nSwapchainIndex		Texture in the swapchain to render to
 /// @param[in]	cubeScale			Scale to apply to the cubes
 /// @param[in]	fSpacingPlane		The amount of spacing in between cubes in the x,z axis
 /// @param[in]	fSpacingHeight		The amount of spacing in between cubes in the y axis
 void DrawSeaOfCubesScene(
 	OpenXRProvider::EXREye eEye,
-	uint32_t nSwapchainIndex,
 	glm::vec3 cubeScale,
 	float fSpacingPlane,
 	float fSpacingHeight );
@@ -387,25 +384,6 @@ glm::mat4 GetEyeProjectionLeft() { return m_EyeProjectionLeft; }
 glm::mat4 GetEyeProjectionRight() { return m_EyeProjectionRight; }
 
 
-/// Get the corresponding depth texture for a give color texture, create one if it doesn't exist
-/// If the runtime supports the XR_KHR_composition_layer_depth extension, the runtime provided
-/// depth texture will be used instead
-/// @param[in]	nTexture			Color texture to match with a depth texture to return
-/// @param[in]	nMinFilter			(Optional: GL_LINEAR)
-/// @param[in]	nMagnitudeFilter	(Optional: GL_NEAREST)
-/// @param[in]	nWrapS				(Optional: GL_CLAMP_TO_EDGE)
-/// @param[in]	nWrapT				(Optional: GL_CLAMP_TO_EDGE)
-/// @param[in]	nDepthFormat		(Optional: GL_DEPTH_COMPONENT24)
-/// @return		uin32_t			Depth texture OpenGL id
-uint32_t GetDepth(
-	uint32_t nTexture,
-	GLint nMinFilter = GL_LINEAR,
-	GLint nMagnitudeFilter = GL_NEAREST,
-	GLint nWrapS = GL_REPEAT,
-	GLint nWrapT = GL_REPEAT,
-	GLint nDepthFormat = GL_DEPTH_COMPONENT24 );
-
-
 /// Get the inverse of a given projection matrix
 /// @param[in]	pProjectionMatrix	The matrix to invert
 /// @param[out]	glm::mat4			The inverted matrix
@@ -450,17 +428,15 @@ float vJointMesh[ ] =
 
 /// Draw the hand joints (hand tracking runtime support required)
 /// @param[in]	eEye				Current eye to render to
-/// @param[in]	nSwapchainIndex		Texture in the swapchain to render to
+/// @param[in]	eyeView				The eye view matrix
 void DrawHandJoints( OpenXRProvider::EXREye eEye, glm::mat4 eyeView );
 
 /// Draw a scene with hand tracked joints and four large rotating cubes around the center of the playspace
 /// @param[in]	eEye				Current eye to render to
-/// @param[in]	nSwapchainIndex		Texture in the swapchain to render to
-void DrawHandTrackingScene( OpenXRProvider::EXREye eEye, uint32_t nSwapchainIndex );
+void DrawHandTrackingScene( OpenXRProvider::EXREye eEye );
 
 /// Draw a single cube
 /// @param[in]	eEye					Current eye to render to
-/// @param[in]  nSwapchainIndex			Texture in the swapchain to render to
 /// @param[in]  eyeView					The eye view matrix
 /// @param[in]	nTexture				The texture id to use for the cube
 /// @param[in]	cubePosition			The position of the cube in world space
@@ -468,7 +444,6 @@ void DrawHandTrackingScene( OpenXRProvider::EXREye eEye, uint32_t nSwapchainInde
 /// @param[in]	cubeRotationOverTime	Amount of rotation of the cube over time
 void DrawCube(
 	OpenXRProvider::EXREye eEye,
-	uint32_t nSwapchainIndex,
 	glm::mat4 eyeView,
 	unsigned int nTexture,
 	glm::vec3 cubePosition,
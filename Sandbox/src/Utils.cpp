@@ -29,8 +29,8 @@ Utils::Utils( const char *pLogTitle, const char *pLogFile )
 {
 	// Initialize logger
 	std::vector< spdlog::sink_ptr > vLogSinks;
-	vLogSinks.push_back( std::make_shared< spdlog::sinks::stdout_color_sink_st >() );
-	vLogSinks.push_back( std::make_shared< spdlog::sinks::basic_file_sink_st >( pLogFile ) );
+	vLogSinks.push_back( std::make_shared< spdlog::sinks::stdout_color_sink_mt >() );
+	vLogSinks.push_back( std::make_shared< spdlog::sinks::basic_file_sink_mt >( pLogFile ) );
 	m_pLogger = std::make_shared< spdlog::logger >( pLogTitle, begin( vLogSinks ), end( vLogSinks ) );
 
 	m_pLogger->set_level( spdlog::level::trace );
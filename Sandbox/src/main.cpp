@@ -108,13 +108,27 @@ int main()
 
 		1,					// Texture array size. 1 if not an array.
 		1,					// Mip count
-		false				// optional: depth texture support if the active runtime supports it
+		true				// optional: depth texture support if the active runtime supports it
 	);
 
-	// (5) Finally, create an XRProvider class
+	// Have the provider build one framebuffer (color + depth) per swapchain image up front
+	xrRenderInfo.CacheRenderTargets = true;
+
+	// (5) Finally, create an XRProvider class. Creation starts on a worker thread so the sandbox
+	//     can set up its own graphics objects (shaders, textures, meshes) in the meantime
+	std::future< OpenXRProvider::XRProvider * > xrProviderFuture =
+		OpenXRProvider::XRProvider::CreateAsync( xrAppInfo, xrAppGraphicsInfo, xrRenderInfo, Callback_XR_InitProgress );
+
+	// Setup any graphics api objects needed by the sandbox.
+	// OpenXR provides the textures to render to, so simply
+	// retrieve them from the XR Provider's Render Manager swapchain
+	if ( GraphicsAPIObjectsSetup() != 0 )
+		return -1;
+
+	// Collect the provider on this thread, as the rest of its setup needs the graphics context
 	try
 	{
-		pXRProvider = new OpenXRProvider::XRProvider( xrAppInfo, xrAppGraphicsInfo, xrRenderInfo );
+		pXRProvider = xrProviderFuture.get();
 	}
 	catch ( const std::exception &e )
 	{
@@ -122,6 +136,9 @@ int main()
 		pUtils->GetLogger()->info( "OpenXR Instance and Session can't be established with the active OpenXR runtime" );
 		return -1;
 	}
+
+	// Depth range of the eye projections, submitted with the depth images if the runtime supports depth composition
+	pXRProvider->Render()->SetDepthSubmitInfo( 0.1f, 100.f );
 	
 	// (6) Create input bindings (if any)
 
@@ -139,8 +156,11 @@ int main()
 	xrActionState_PoseRight.type = XR_TYPE_ACTION_STATE_POSE;
 	xrAction_PoseRight = pXRProvider->Input()->CreateAction( xrActionSet_Main, "pose_right", "Pose (Right)", XR_ACTION_TYPE_POSE_INPUT, 0, NULL );
 
-	xrActionState_SwitchScene.type = XR_TYPE_ACTION_STATE_BOOLEAN;
+	pXRProvider->Input()->GetActionSpaceSlot( xrAction_PoseLeft, nSpaceSlot_PoseLeft );
+	pXRProvider->Input()->GetActionSpaceSlot( xrAction_PoseRight, nSpaceSlot_PoseRight );
+
 	xrAction_SwitchScene = pXRProvider->Input()->CreateAction( xrActionSet_Main, "switch_scene", "Switch Scenes", XR_ACTION_TYPE_BOOLEAN_INPUT, 0, NULL );
+	nActionHandle_SwitchScene = pXRProvider->Input()->GetActionHandle( xrAction_SwitchScene );
 	
 	xrAction_Haptic = pXRProvider->Input()->CreateAction( xrActionSet_Main, "haptic", "Haptic Feedback", XR_ACTION_TYPE_VIBRATION_OUTPUT, 0, NULL );
 
@@ -155,6 +175,9 @@ int main()
 	// 6.6 Activate all action sets that we want to update per frame (this can also be changed per frame or anytime app wants to sync a different action set data)
 	pXRProvider->Input()->ActivateActionSet( xrActionSet_Main );
 
+	// 6.7 Only react to input changes: each sync queues an event for every press, release, analog move and pose tracking change
+	pXRProvider->Input()->SetInputEventsEnabled( true );
+
 
 	// (7) Optional: Cache anything your app needs in the frame loop
 
@@ -177,6 +200,9 @@ int main()
 	pXRCallback->callback = Callback_XR_Event;
 	pXRProvider->Core()->GetXREventHandler()->RegisterCallback( pXRCallback );
 
+	OpenXRProvider::XRCallback xrCallback_InteractionProfile = { XR_TYPE_EVENT_DATA_INTERACTION_PROFILE_CHANGED, Callback_XR_Event };
+	pXRProvider->Core()->GetXREventHandler()->RegisterCallback( &xrCallback_InteractionProfile );
+
 	// (9) Optional: Use any pre-render loop extensions
 
 	// Retrieve visibility mask from runtime if available
@@ -198,12 +224,6 @@ int main()
 
 	#pragma endregion OPENXR_PROVIDER_SETUP
 
-	// Setup any graphics api objects needed by the sandbox.
-	// OpenXR provides the textures to render to, so simply
-	// retrieve them from the XR Provider's Render Manager swapchain
-	if ( GraphicsAPIObjectsSetup() != 0 )
-		return -1;
-
 	#pragma region SANDBOX_FRAME_LOOP
 
 	// FRAME LOOP
@@ -218,81 +238,81 @@ int main()
 		if ( xrCurrentSessionState == XR_SESSION_STATE_EXITING )
 			break;	
 
-		if ( xrCurrentSessionState == XR_SESSION_STATE_IDLE )
+		if ( xrCurrentSessionState == XR_SESSION_STATE_IDLE || pXRProvider->Core()->GetIsSessionLost() )
 		{
-			// HMD is not ready or inactive, clear window with clear color
+			// HMD is not ready or inactive (or the session is being recreated), clear window with clear color
 			glClearColor( 0.5f, 0.9f, 1.0f, 1.0f );
 			glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT );
 			BlitToWindow();
 		}
 		else if ( xrCurrentSessionState == XR_SESSION_STATE_READY )
 		{
-			// Begin the session - e.g. coming back from stopping state
-			XrResult xrResult = pXRProvider->Core()->XRBeginSession();
+			// Session was begun by the provider when it became ready - e.g. coming back from stopping state
 			bool bResult = pXRProvider->Render()->ProcessXRFrame();
 
-			pUtils->GetLogger()->info( "OpenXR Session started ({}) and initial frame processed ({})", OpenXRProvider::XrEnumToString( xrResult ), bResult );
-		}
-		else if (  xrCurrentSessionState == XR_SESSION_STATE_STOPPING )
-		{
-			// End session so runtime can safely transition back to idle
-			XrResult xrResult = pXRProvider->Core()->XREndSession();
-
-			pUtils->GetLogger()->info( "OpenXR Session ended ({})", OpenXRProvider::XrEnumToString( xrResult ) );
+			pUtils->GetLogger()->info( "OpenXR Session running ({}) and initial frame processed ({})", pXRProvider->Core()->GetIsSessionRunning(), bResult );
 		}
-		else if ( xrCurrentSessionState > XR_SESSION_STATE_IDLE )
+		else if ( xrCurrentSessionState > XR_SESSION_STATE_IDLE && xrCurrentSessionState != XR_SESSION_STATE_STOPPING )
 		{
-			// (2) Process frame - call ProcessXRFrame from the render manager 
-			if ( pXRProvider->Render() && pXRProvider->Render()->ProcessXRFrame() )
+			// (2) Wait for and begin the frame - this also updates the predicted display time and eye poses for this frame
+			if ( pXRProvider->Render() && pXRProvider->Render()->WaitFrame() && pXRProvider->Render()->BeginFrame() )
 			{
-				// 2.1 Render to swapchain image
-				nSwapchainIndex = nSwapchainIndex > nSwapchainCapacity - 1 ? 0 : nSwapchainIndex;
-
-				DrawFrame( OpenXRProvider::EYE_LEFT, nSwapchainIndex );
-				DrawFrame( OpenXRProvider::EYE_RIGHT, nSwapchainIndex );
-
-				// Blit (copy) texture to XR Mirror
-				BlitToWindow();
-		
-				// Update app frame state
-				++nFrameNumber;
-				++nSwapchainIndex;
-				
-				// [DEBUG] pUtils->GetLogger()->info("HMD IPD is currently set to: {}", xrRenderManager->GetCurrentIPD());
-			}
-
-			// (3) Process input
-			if ( xrCurrentSessionState == XR_SESSION_STATE_FOCUSED && pXRProvider->Input() )
-			{
-				// 3.1 Sync data with runtime for all active action sets
-				pXRProvider->Input()->SyncActiveActionSetsData();
+				// (3) Process input
+				if ( xrCurrentSessionState == XR_SESSION_STATE_FOCUSED && pXRProvider->Input() )
+				{
+					// 3.1 Sync data with runtime for all active action sets
+					pXRProvider->Input()->SyncActiveActionSetsData();
 
-				// 3.2 Process all received input states from previous sync call
-				ProcessInputStates();
+					// 3.2 Process all received input states from previous sync call
+					ProcessInputStates();
 
-				// 3.3 Update controller and/or other action poses
-				//     as we are not a pipelined app (single threaded), we're using one time period ahead of the current frame pose
-				uint64_t nPredictedTime = pXRProvider->Render()->GetPredictedDisplayTime() + pXRProvider->Render()->GetPredictedDisplayPeriod();
+					// 3.3 Update controller and/or other action poses
+					//     input is processed after the frame is begun, so locate poses for the time this frame will be displayed
+					uint64_t nPredictedTime = pXRProvider->Render()->GetPredictedDisplayTime();
 
-				pXRProvider->Input()->GetActionPose( xrAction_PoseLeft, nPredictedTime, &xrLocation_Left );
-				pXRProvider->Input()->GetActionPose( xrAction_PoseRight, nPredictedTime, &xrLocation_Right );
+					//     all registered spaces (hmd, controllers) are located in a single pass
+					OpenXRProvider::XRSpaceRegistry *pSpaceRegistry = pXRProvider->Core()->GetSpaceRegistry();
+					pSpaceRegistry->LocateSpaces( nPredictedTime );
 
-				// 3.4 Update any other input dependent poses (e.g. handtracking extension)
-				if ( bDrawHandJoints )
-				{
-					// Left Hand (Open Hand/Unobstructed)
-					pXRProvider->Core()->GetExtHandTracking()->LocateHandJoints( XR_HAND_LEFT_EXT, pXRProvider->Core()->GetXRSpace(), nPredictedTime );
+					pSpaceRegistry->GetPose( nSpaceSlot_PoseLeft, xrLocation_Left.pose );
+					pSpaceRegistry->GetPose( nSpaceSlot_PoseRight, xrLocation_Right.pose );
 
-					// Right Hand (With Controller if motion range is available)
-					if ( pXRHandJointsMotionRange!= nullptr )
+					// 3.4 Update any other input dependent poses (e.g. handtracking extension)
+					if ( bDrawHandJoints )
 					{
-						pXRProvider->Core()->GetExtHandTracking()->LocateHandJoints(XR_HAND_RIGHT_EXT, pXRProvider->Core()->GetXRSpace(), nPredictedTime, XR_HAND_JOINTS_MOTION_RANGE_CONFORMING_TO_CONTROLLER_EXT );
-					}
-					else
-					{
-						pXRProvider->Core()->GetExtHandTracking()->LocateHandJoints(XR_HAND_RIGHT_EXT, pXRProvider->Core()->GetXRSpace(), nPredictedTime );
+						// Left Hand (Open Hand/Unobstructed)
+						pXRProvider->Core()->GetExtHandTracking()->LocateHandJoints( XR_HAND_LEFT_EXT, pXRProvider->Core()->GetXRSpace(), nPredictedTime );
+
+						// Right Hand (With Controller if motion range is available)
+						if ( pXRHandJointsMotionRange!= nullptr )
+						{
+							pXRProvider->Core()->GetExtHandTracking()->LocateHandJoints(XR_HAND_RIGHT_EXT, pXRProvider->Core()->GetXRSpace(), nPredictedTime, XR_HAND_JOINTS_MOTION_RANGE_CONFORMING_TO_CONTROLLER_EXT );
+						}
+						else
+						{
+							pXRProvider->Core()->GetExtHandTracking()->LocateHandJoints(XR_HAND_RIGHT_EXT, pXRProvider->Core()->GetXRSpace(), nPredictedTime );
+						}
 					}
 				}
+
+				// (4) Acquire this frame's swapchain images and render to them
+				uint32_t nImageIndices[ 2 ] = { 0, 0 };
+				if ( pXRProvider->Render()->AcquireViewImages( nImageIndices ) )
+				{
+					DrawFrame( OpenXRProvider::EYE_LEFT );
+					DrawFrame( OpenXRProvider::EYE_RIGHT );
+
+					// Blit (copy) texture to XR Mirror
+					BlitToWindow();
+
+					// Update app frame state
+					++nFrameNumber;
+
+					// [DEBUG] pUtils->GetLogger()->info("HMD IPD is currently set to: {}", xrRenderManager->GetCurrentIPD());
+				}
+
+				// (5) Release the rendered images and submit the frame to the runtime
+				pXRProvider->Render()->EndFrame();
 			}
 		}
 
@@ -303,6 +323,9 @@ int main()
 
 	#pragma endregion SANDBOX_FRAME_LOOP
 
+	// Report end-to-end latencies measured during the session
+	pXRProvider->Core()->GetClock()->LogLatencies();
+
 	// CLEANUP
 	delete pXRMirror;
 	delete pXRProvider;
@@ -311,12 +334,12 @@ int main()
 	return 0;
 }
 
-static void Callback_XR_Event( XrEventDataBuffer xrEvent )
+static void Callback_XR_Event( const XrEventDataBuffer &xrEvent, void *pUserContext )
 {
 	assert( pUtils && pUtils->GetLogger() );
 
-	const XrEventDataSessionStateChanged& xrEventDataSessionStateChanged = *reinterpret_cast<XrEventDataSessionStateChanged*>(&xrEvent);
-	const XrEventDataInteractionProfileChanged& xrEventDataInteractionProfileChanged = *reinterpret_cast<XrEventDataInteractionProfileChanged*>(&xrEvent);
+	const XrEventDataSessionStateChanged& xrEventDataSessionStateChanged = *reinterpret_cast<const XrEventDataSessionStateChanged*>(&xrEvent);
+	const XrEventDataInteractionProfileChanged& xrEventDataInteractionProfileChanged = *reinterpret_cast<const XrEventDataInteractionProfileChanged*>(&xrEvent);
 
 	switch ( xrEvent.type )
 	{
@@ -339,6 +362,13 @@ static void Callback_XR_Event( XrEventDataBuffer xrEvent )
 	}
 }
 
+static void Callback_XR_InitProgress( OpenXRProvider::EXRInitPhase eXRInitPhase, void *pUserContext )
+{
+	// Called from the provider's worker thread for the first phase (the sandbox log sinks are thread safe)
+	static const char *k_pInitPhaseNames[] = { "instance", "session", "render", "input", "ready", "failed" };
+	pUtils->GetLogger()->info( "OpenXR Provider initialization phase: {}", k_pInitPhaseNames[ eXRInitPhase ] );
+}
+
 void Callback_GLFW_Input_Key( GLFWwindow *pWindow, int nKey, int nScancode, int nAction, int nModifier ) 
 {
 	// Only process presses
@@ -511,10 +541,6 @@ int GraphicsAPIObjectsSetup()
 	}
 	glBindVertexArray( 0 );
 
-	// Setup frame buffer object
-	glGenFramebuffers( 1, &FBO );
-	glBindFramebuffer( GL_FRAMEBUFFER, FBO );
-
 	// Create shader programs
 	nShaderVisMask = pUtils->CreateShaderProgram( ( sCurrentPath + VIS_MASK_VERTEX_SHADER ).c_str(), ( sCurrentPath + VIS_MASK_FRAGMENT_SHADER ).c_str() );
 	nShaderLit = pUtils->CreateShaderProgram( ( sCurrentPath + LIT_VERTEX_SHADER ).c_str(), ( sCurrentPath + LIT_FRAGMENT_SHADER ).c_str() );
@@ -545,45 +571,67 @@ int GraphicsAPIObjectsSetup()
 
 void CreateInputActionBindings()
 {
+	using namespace OpenXRProvider;
+
+	// Bindings are checked against the interaction profile tables at compile time, a component the controller doesn't have won't build
+
 	// Valve Index
-	OpenXRProvider::XRInputProfile_ValveIndex *pValveIndex = pXRProvider->Input()->ValveIndex();
-	pXRProvider->Input()->CreateActionBinding( xrAction_PoseLeft, pValveIndex->Hand_Left, pValveIndex->Pose_Grip, pValveIndex->ActionBindings() );
-	pXRProvider->Input()->CreateActionBinding( xrAction_PoseRight, pValveIndex->Hand_Right, pValveIndex->Pose_Grip, pValveIndex->ActionBindings() );
+	constexpr XRInputBinding xrBinding_ValveIndex_PoseLeft( XRInputProfile_ValveIndex::Descriptor, USER_PATH_HAND_LEFT, XRInputProfile_ValveIndex::Pose_Grip );
+	constexpr XRInputBinding xrBinding_ValveIndex_PoseRight( XRInputProfile_ValveIndex::Descriptor, USER_PATH_HAND_RIGHT, XRInputProfile_ValveIndex::Pose_Grip );
+	constexpr XRInputBinding xrBinding_ValveIndex_TriggerLeft( XRInputProfile_ValveIndex::Descriptor, USER_PATH_HAND_LEFT, XRInputProfile_ValveIndex::Button_Trigger_Click );
+	constexpr XRInputBinding xrBinding_ValveIndex_TriggerRight( XRInputProfile_ValveIndex::Descriptor, USER_PATH_HAND_RIGHT, XRInputProfile_ValveIndex::Button_Trigger_Click );
+	constexpr XRInputBinding xrBinding_ValveIndex_HapticLeft( XRInputProfile_ValveIndex::Descriptor, USER_PATH_HAND_LEFT, XRInputProfile_ValveIndex::Output_Haptic );
+	constexpr XRInputBinding xrBinding_ValveIndex_HapticRight( XRInputProfile_ValveIndex::Descriptor, USER_PATH_HAND_RIGHT, XRInputProfile_ValveIndex::Output_Haptic );
 
-	pXRProvider->Input()->CreateActionBinding( xrAction_SwitchScene, pValveIndex->Hand_Left, pValveIndex->Button_Trigger_Click, pValveIndex->ActionBindings() );
-	pXRProvider->Input()->CreateActionBinding( xrAction_SwitchScene, pValveIndex->Hand_Right, pValveIndex->Button_Trigger_Click, pValveIndex->ActionBindings() );
+	pXRProvider->Input()->CreateActionBinding( xrAction_PoseLeft, xrBinding_ValveIndex_PoseLeft );
+	pXRProvider->Input()->CreateActionBinding( xrAction_PoseRight, xrBinding_ValveIndex_PoseRight );
 
-	pXRProvider->Input()->CreateActionBinding( xrAction_Haptic, pValveIndex->Hand_Left, pValveIndex->Output_Haptic, pValveIndex->ActionBindings() );
-	pXRProvider->Input()->CreateActionBinding( xrAction_Haptic, pValveIndex->Hand_Right, pValveIndex->Output_Haptic, pValveIndex->ActionBindings() );
+	pXRProvider->Input()->CreateActionBinding( xrAction_SwitchScene, xrBinding_ValveIndex_TriggerLeft );
+	pXRProvider->Input()->CreateActionBinding( xrAction_SwitchScene, xrBinding_ValveIndex_TriggerRight );
+
+	pXRProvider->Input()->CreateActionBinding( xrAction_Haptic, xrBinding_ValveIndex_HapticLeft );
+	pXRProvider->Input()->CreateActionBinding( xrAction_Haptic, xrBinding_ValveIndex_HapticRight );
 
 	// Vive
-	OpenXRProvider::XRInputProfile_HTCVive *pHTCVive = pXRProvider->Input()->HTCVive();
-	pXRProvider->Input()->CreateActionBinding( xrAction_PoseLeft, pHTCVive->Hand_Left, pHTCVive->Pose_Grip, pHTCVive->ActionBindings() );
-	pXRProvider->Input()->CreateActionBinding( xrAction_PoseRight, pHTCVive->Hand_Right, pHTCVive->Pose_Grip, pHTCVive->ActionBindings() );
+	constexpr XRInputBinding xrBinding_HTCVive_PoseLeft( XRInputProfile_HTCVive::Descriptor, USER_PATH_HAND_LEFT, XRInputProfile_HTCVive::Pose_Grip );
+	constexpr XRInputBinding xrBinding_HTCVive_PoseRight( XRInputProfile_HTCVive::Descriptor, USER_PATH_HAND_RIGHT, XRInputProfile_HTCVive::Pose_Grip );
+	constexpr XRInputBinding xrBinding_HTCVive_TriggerLeft( XRInputProfile_HTCVive::Descriptor, USER_PATH_HAND_LEFT, XRInputProfile_HTCVive::Button_Trigger_Click );
+	constexpr XRInputBinding xrBinding_HTCVive_TriggerRight( XRInputProfile_HTCVive::Descriptor, USER_PATH_HAND_RIGHT, XRInputProfile_HTCVive::Button_Trigger_Click );
+	constexpr XRInputBinding xrBinding_HTCVive_HapticLeft( XRInputProfile_HTCVive::Descriptor, USER_PATH_HAND_LEFT, XRInputProfile_HTCVive::Output_Haptic );
+	constexpr XRInputBinding xrBinding_HTCVive_HapticRight( XRInputProfile_HTCVive::Descriptor, USER_PATH_HAND_RIGHT, XRInputProfile_HTCVive::Output_Haptic );
+
+	pXRProvider->Input()->CreateActionBinding( xrAction_PoseLeft, xrBinding_HTCVive_PoseLeft );
+	pXRProvider->Input()->CreateActionBinding( xrAction_PoseRight, xrBinding_HTCVive_PoseRight );
 
-	pXRProvider->Input()->CreateActionBinding( xrAction_SwitchScene, pHTCVive->Hand_Left, pHTCVive->Button_Trigger_Click, pHTCVive->ActionBindings() );
-	pXRProvider->Input()->CreateActionBinding( xrAction_SwitchScene, pHTCVive->Hand_Right, pHTCVive->Button_Trigger_Click, pHTCVive->ActionBindings() );
+	pXRProvider->Input()->CreateActionBinding( xrAction_SwitchScene, xrBinding_HTCVive_TriggerLeft );
+	pXRProvider->Input()->CreateActionBinding( xrAction_SwitchScene, xrBinding_HTCVive_TriggerRight );
 
-	pXRProvider->Input()->CreateActionBinding( xrAction_Haptic, pHTCVive->Hand_Left, pHTCVive->Output_Haptic, pHTCVive->ActionBindings() );
-	pXRProvider->Input()->CreateActionBinding( xrAction_Haptic, pHTCVive->Hand_Right, pHTCVive->Output_Haptic, pHTCVive->ActionBindings() );
+	pXRProvider->Input()->CreateActionBinding( xrAction_Haptic, xrBinding_HTCVive_HapticLeft );
+	pXRProvider->Input()->CreateActionBinding( xrAction_Haptic, xrBinding_HTCVive_HapticRight );
 
 	// Oculus Touch
-	OpenXRProvider::XRInputProfile_OculusTouch *pOculus = pXRProvider->Input()->OculusTouch();
-	pXRProvider->Input()->CreateActionBinding( xrAction_PoseLeft, pOculus->Hand_Left, pOculus->Pose_Grip, pOculus->ActionBindings() );
-	pXRProvider->Input()->CreateActionBinding( xrAction_PoseRight, pOculus->Hand_Right, pOculus->Pose_Grip, pOculus->ActionBindings() );
+	constexpr XRInputBinding xrBinding_OculusTouch_PoseLeft( XRInputProfile_OculusTouch::Descriptor, USER_PATH_HAND_LEFT, XRInputProfile_OculusTouch::Pose_Grip );
+	constexpr XRInputBinding xrBinding_OculusTouch_PoseRight( XRInputProfile_OculusTouch::Descriptor, USER_PATH_HAND_RIGHT, XRInputProfile_OculusTouch::Pose_Grip );
+	constexpr XRInputBinding xrBinding_OculusTouch_TriggerLeft( XRInputProfile_OculusTouch::Descriptor, USER_PATH_HAND_LEFT, XRInputProfile_OculusTouch::Button_Trigger_Value );
+	constexpr XRInputBinding xrBinding_OculusTouch_TriggerRight( XRInputProfile_OculusTouch::Descriptor, USER_PATH_HAND_RIGHT, XRInputProfile_OculusTouch::Button_Trigger_Value );
+	constexpr XRInputBinding xrBinding_OculusTouch_HapticLeft( XRInputProfile_OculusTouch::Descriptor, USER_PATH_HAND_LEFT, XRInputProfile_OculusTouch::Output_Haptic );
+	constexpr XRInputBinding xrBinding_OculusTouch_HapticRight( XRInputProfile_OculusTouch::Descriptor, USER_PATH_HAND_RIGHT, XRInputProfile_OculusTouch::Output_Haptic );
+
+	pXRProvider->Input()->CreateActionBinding( xrAction_PoseLeft, xrBinding_OculusTouch_PoseLeft );
+	pXRProvider->Input()->CreateActionBinding( xrAction_PoseRight, xrBinding_OculusTouch_PoseRight );
 
-	pXRProvider->Input()->CreateActionBinding( xrAction_SwitchScene, pOculus->Hand_Left, pOculus->Button_Trigger_Value, pOculus->ActionBindings() );
-	pXRProvider->Input()->CreateActionBinding( xrAction_SwitchScene, pOculus->Hand_Right, pOculus->Button_Trigger_Value, pOculus->ActionBindings() );
+	pXRProvider->Input()->CreateActionBinding( xrAction_SwitchScene, xrBinding_OculusTouch_TriggerLeft );
+	pXRProvider->Input()->CreateActionBinding( xrAction_SwitchScene, xrBinding_OculusTouch_TriggerRight );
 
-	pXRProvider->Input()->CreateActionBinding( xrAction_Haptic, pOculus->Hand_Left, pOculus->Output_Haptic, pOculus->ActionBindings() );
-	pXRProvider->Input()->CreateActionBinding( xrAction_Haptic, pOculus->Hand_Right, pOculus->Output_Haptic, pOculus->ActionBindings() );
+	pXRProvider->Input()->CreateActionBinding( xrAction_Haptic, xrBinding_OculusTouch_HapticLeft );
+	pXRProvider->Input()->CreateActionBinding( xrAction_Haptic, xrBinding_OculusTouch_HapticRight );
 }
 
 
-void DrawFrame(	OpenXRProvider::EXREye eEye, uint32_t nSwapchainIndex )
+void DrawFrame(	OpenXRProvider::EXREye eEye )
 {
-	glBindFramebuffer( GL_FRAMEBUFFER, FBO );
-	glFramebufferTexture2D( GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, pXRProvider->Render()->GetGraphicsAPI()->GetTexture2D( eEye, nSwapchainIndex ), 0 );
+	// Bind the prebuilt framebuffer for this frame's acquired swapchain images
+	glBindFramebuffer( GL_FRAMEBUFFER, pXRProvider->Render()->GetRenderTarget( eEye ) );
 
 	glClearColor( 0.5f, 0.9f, 1.0f, 1.0f );
 	glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT );
@@ -605,12 +653,12 @@ void DrawFrame(	OpenXRProvider::EXREye eEye, uint32_t nSwapchainIndex )
 	switch ( eCurrentScene )
 	{
 		case SANDBOX_SCENE_HAND_TRACKING:
-			DrawHandTrackingScene( eEye, nSwapchainIndex );
+			DrawHandTrackingScene( eEye );
 			break;
 
 		case SANDBOX_SCENE_SEA_OF_CUBES:
 			glm::vec3 cubeScale = glm::vec3( 0.5f, 0.5f, 0.5f );
-			DrawSeaOfCubesScene( eEye, nSwapchainIndex, cubeScale, 1.5f, 1.5f );
+			DrawSeaOfCubesScene( eEye, cubeScale, 1.5f, 1.5f );
 		default:
 			break;
 	}
@@ -679,23 +727,24 @@ void DrawControllers( OpenXRProvider::EXREye eEye, glm::mat4 eyeView )
 
 void ProcessInputStates() 
 {
-	// Check if we need to respond to an action
-	XrResult xrResult = pXRProvider->Input()->GetActionStateBoolean( xrAction_SwitchScene, &xrActionState_SwitchScene );
-	if ( xrResult == XR_SUCCESS && xrActionState_SwitchScene.changedSinceLastSync && xrActionState_SwitchScene.currentState )
+	// Respond only to the actions that changed since the last sync
+	OpenXRProvider::XRInputEvent xrInputEvent;
+	while ( pXRProvider->Input()->PopInputEvent( xrInputEvent ) )
 	{
+		if ( xrInputEvent.ActionHandle != nActionHandle_SwitchScene || xrInputEvent.Type != OpenXRProvider::INPUT_EVENT_PRESSED )
+			continue;
+
 		// Switch active scene
 		eCurrentScene = eCurrentScene == SANDBOX_SCENE_HAND_TRACKING ? SANDBOX_SCENE_SEA_OF_CUBES : SANDBOX_SCENE_HAND_TRACKING;
 
 		// Apply haptic
 		pXRProvider->Input()->GenerateHaptic( xrAction_Haptic, XR_MIN_HAPTIC_DURATION, 0.5f, XR_FREQUENCY_UNSPECIFIED );
-		pUtils->GetLogger()->info( "Input Detected: Action Switch Scene ({}) last changed on ({}) nanoseconds", 
-			( bool )xrActionState_SwitchScene.currentState, ( uint64_t )xrActionState_SwitchScene.lastChangeTime );
+		pUtils->GetLogger()->info( "Input Detected: Action Switch Scene pressed on ({}) nanoseconds", ( uint64_t )xrInputEvent.Time );
 	}
 }
 
 void DrawCube(
 	OpenXRProvider::EXREye eEye,
-	uint32_t nSwapchainIndex,
 	glm::mat4 eyeView,
 	unsigned int nTexture,
 	glm::vec3 cubePosition,
@@ -737,7 +786,6 @@ void DrawCube(
 
 void DrawSeaOfCubesScene(
 	OpenXRProvider::EXREye eEye,
-	uint32_t nSwapchainIndex,
 	glm::vec3 cubeScale,
 	float fSpacingPlane,
 	float fSpacingHeight )
@@ -798,10 +846,6 @@ void DrawSeaOfCubesScene(
 			}
 		}
 
-		// Set depth texture
-		const uint32_t depthTexture = GetDepth( pXRProvider->Render()->GetGraphicsAPI()->GetTexture2D( eEye, nSwapchainIndex ) );
-		glFramebufferTexture2D( GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, depthTexture, 0 );
-
 		// Set shader
 		glUseProgram( nShaderTextured );
 
@@ -891,7 +935,7 @@ void DrawHandJoints( OpenXRProvider::EXREye eEye, glm::mat4 eyeView )
 	delete[] vEyeProjections_RightHand;
 }
 
-void DrawHandTrackingScene( OpenXRProvider::EXREye eEye, uint32_t nSwapchainIndex )
+void DrawHandTrackingScene( OpenXRProvider::EXREye eEye )
 {
 	assert( pXRProvider->Render() );
 	assert( vCubeTextures.size() > 3 );	// We'll draw four large cubes in the scene
@@ -927,7 +971,6 @@ void DrawHandTrackingScene( OpenXRProvider::EXREye eEye, uint32_t nSwapchainInde
 	{
 		DrawCube(
 			eEye,
-			nSwapchainIndex,
 			eyeViewInverted,
 			vCubeTextures[ i ], 
 			vFourCubePositions [ i ], 
@@ -1051,35 +1094,3 @@ glm::mat4 InvertMatrix( const glm::mat4 mMatrix )
 	return mInvertedMatrix;
 }
 
-uint32_t GetDepth( uint32_t nTexture, GLint nMinFilter, GLint nMagnitudeFilter, GLint nWrapS, GLint nWrapT, GLint nDepthFormat )
-{
-	// Check if we already generated a depth texture for this
-	std::map< uint32_t, uint32_t >::iterator const it = m_mapColorDepth.find( nTexture );
-	if ( it != m_mapColorDepth.end() )
-		return it->second;
-
-	// Create a new depth buffer
-	// TODO: Pickup from depth swapchain if supported
-	uint32_t nDepth;
-	GLint nWidth, nHeight;
-
-	glBindTexture( GL_TEXTURE_2D, nTexture );
-
-	glGetTexLevelParameteriv( GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &nWidth );
-	glGetTexLevelParameteriv( GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &nHeight );
-
-	glGenTextures( 1, &nDepth );
-	glBindTexture( GL_TEXTURE_2D, nDepth );
-
-	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, nMinFilter );
-	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, nMagnitudeFilter );
-
-	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, nWrapS );
-	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, nWrapT );
-
-	glTexImage2D( GL_TEXTURE_2D, 0, nDepthFormat, nWidth, nHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr );
-
-	m_mapColorDepth.insert( std::make_pair( nTexture, nDepth ) );
-
-	return nDepth;
-}